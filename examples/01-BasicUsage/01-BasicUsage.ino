@@ -64,7 +64,6 @@ std::vector<ESPRIC::ESPRIC_Condition> getMyESPRIC_Conditions() {
 void setup() {
   // Initialize serial interface for debugging and output
   Serial.begin(115200);
-  while (!Serial) {};  // Wait for the serial interface to be ready (important for some ESP32 boards)
   Serial.println("Firmware started: ESPRIC - BasicUsage");
 
   // Create and initialize ESPRIC analyzer with the defined conditions
@@ -20,7 +20,6 @@
 void setup() {
   // Initialize the serial interface
   Serial.begin(115200);
-  while (!Serial) {};  // Wait until the serial connection is ready
   Serial.println("Firmware started: ESPRIC - Modular Example");
 
   // Instantiate and run the analyzer
@@ -20,7 +20,6 @@
 void setup() {
     // Initialize the serial connection
     Serial.begin(115200);
-    while (!Serial) {}; // Wait for the serial connection to be ready (important for some devices like ESP32-C3)
     Serial.println("Firmware started: ESP32StartupErrorAnalyzer - AddConditionsInSetup");
 
     // Initialize the restart error analyzer with predefined conditions
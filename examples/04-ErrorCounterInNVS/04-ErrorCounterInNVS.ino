@@ -53,7 +53,6 @@ std::vector<ESP32StartupErrorAnalyzer::ErrorCondition> getStartupConditions() {
 void setup() {
     // Initialize the serial connection
     Serial.begin(115200);
-    while (!Serial) {}; // Wait until the serial connection is ready (important for ESP32-C3)
     Serial.println("Firmware started: ESP32StartupErrorAnalyzer - ErrorCounterInNVS");
 
     // Initialize the preferences storage
@@ -76,7 +76,6 @@ std::vector<ESP32StartupErrorAnalyzer::ErrorCondition> getStartupConditions() {
 void setup() {
     // Initialize the serial connection
     Serial.begin(115200);
-    while (!Serial) {};
     Serial.println("Firmware started: ESP32StartupErrorAnalyzer - ErrorCounterWithDefault");
 
     // Load counters from NVS
@@ -21,7 +21,6 @@
 void setup() {
     // Initialize the serial interface for debugging purposes
     Serial.begin(115200);
-    while (!Serial) {}; // Wait for the serial interface to be ready
 
     Serial.println("Firmware started: ESP32StartupErrorAnalyzer - ErrorCounterInFileWithDefault");
 
@@ -23,7 +23,6 @@ const uint32_t SLEEP_DURATION_US = 10 * 1000000; // 10 Sekunden
 void setup() {
   // Initialize the serial connection
   Serial.begin(115200);
-  while (!Serial) {};  // Wait until the serial connection is ready (important for some devices like ESP32-C3)
   Serial.println("Firmware started: ESP32StartupErrorAnalyzer - ConditionsInFile");
 
   // Create an instance of the analyzer and pass the defined conditions
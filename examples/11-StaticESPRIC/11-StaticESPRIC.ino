@@ -0,0 +1,63 @@
+/**
+ * @file 11-StaticESPRIC.ino
+ * @brief Example of the compile-time `StaticESPRIC` analyzer.
+ * 
+ * This example defines its reset and wakeup conditions as a `constexpr` table of 
+ * `ESPRIC_StaticCondition` descriptors. The table lives in flash, the analyzer allocates 
+ * nothing on the heap, and the compiler can inline the complete dispatch. This makes it a 
+ * good fit for RAM-constrained parts such as the ESP32-C2 and ESP32-C3.
+ */
+
+#include <ESPRIC_Static.h>
+
+/**
+ * @brief Handler for a panic reset.
+ */
+static void onPanic() {
+  Serial.println("Panic reset detected. STOP!");
+  while (1) {}; // Halt the program
+}
+
+/**
+ * @brief Handler executed if no condition matched.
+ */
+static void onUnhandled() {
+  Serial.println("No condition matched.");
+}
+
+/**
+ * @brief The condition table, resident in .rodata.
+ * 
+ * Predicates are plain functions of the `ESPRIC_StartupContext`. The helpers 
+ * `espricResetReasonIs<>` and `espricWakeupCauseIs<>` cover the common cases; 
+ * captureless lambdas can be used for everything else.
+ */
+static constexpr ESPRIC_StaticCondition kConditions[] = {
+  {espricResetReasonIs<ESP_RST_POWERON>, []() { Serial.println("Power-on detected."); }},
+  {espricResetReasonIs<ESP_RST_UNKNOWN>, []() { Serial.println("Memory reflashed? (Unknown reset reason)"); }},
+  {espricResetReasonIs<ESP_RST_PANIC>, onPanic},
+  {espricWakeupCauseIs<ESP_SLEEP_WAKEUP_TIMER>, []() { Serial.println("Wakeup caused by timer."); }},
+  {[](const ESPRIC_StartupContext& context) { return context.wakeupCause == ESP_SLEEP_WAKEUP_EXT1 && context.ext1WakeupMask != 0; },
+   []() { Serial.println("Wakeup caused by EXT1 GPIO."); }},
+};
+
+/**
+ * @brief Sets up the serial interface and runs the static analyzer.
+ */
+void setup() {
+  Serial.begin(115200);
+  Serial.println("Firmware started: ESPRIC - StaticESPRIC");
+
+  StaticESPRIC<kConditions, onUnhandled> espric;
+  auto result = espric.analyze();
+
+  Serial.printf("Conditions matched: %d, unmatched: %d\n", result.matched, result.unmatched);
+  Serial.println("Ready!");
+}
+
+/**
+ * @brief Main loop of the program.
+ */
+void loop() {
+  // Main logic
+}
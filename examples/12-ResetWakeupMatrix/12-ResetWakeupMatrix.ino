@@ -0,0 +1,46 @@
+/**
+ * @file 12-ResetWakeupMatrix.ino
+ * @brief Demonstrates the combined reset x wakeup analysis with `ESPRIC_Matrix`.
+ * 
+ * Instead of two independent analyzers for reset reasons and wakeup causes (see 
+ * 10-ResetWakeupDemo), this example binds handlers to combinations of both. Wildcard rows 
+ * and columns cover the remaining cases. The handler of a boot is found with one lookup.
+ * 
+ * @note Resolution order: exact combination, reset row wildcard, wakeup column wildcard, 
+ *       default callback. Exactly one handler runs.
+ */
+
+#include <ESPRIC_Matrix.h>
+
+void setup() {
+    // Initialize the serial communication for debugging.
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n=== ESP Reset x Wakeup Matrix Analysis with ESPRIC ===");
+
+    ESPRIC_Matrix matrix([]() { Serial.println("No handler for this reset/wakeup combination."); });
+
+    // Deep sleep wakeups: distinguish the wakeup source.
+    matrix.on(ESP_RST_DEEPSLEEP, ESP_SLEEP_WAKEUP_TIMER,
+              []() { Serial.println("Periodic wakeup from deep sleep (timer)."); });
+    matrix.on(ESP_RST_DEEPSLEEP, ESP_SLEEP_WAKEUP_EXT0,
+              []() { Serial.println("Deep sleep ended by external signal (EXT0)."); });
+    matrix.onReset(ESP_RST_DEEPSLEEP,
+                   []() { Serial.println("Deep sleep ended by another wakeup source."); });
+
+    // Reset reasons that do not depend on the wakeup cause.
+    matrix.onReset(ESP_RST_POWERON, []() { Serial.println("Power-on reset detected."); });
+    matrix.onReset(ESP_RST_PANIC, []() { Serial.println("Panic reset detected."); });
+    matrix.onReset(ESP_RST_BROWNOUT, []() { Serial.println("Brownout reset detected."); });
+
+    // Any reset reason together with an ULP wakeup.
+    matrix.onWakeup(ESP_SLEEP_WAKEUP_ULP, []() { Serial.println("Wakeup caused by ULP program."); });
+
+    matrix.analyze();
+}
+
+void loop() {
+    // No additional logic required in this example.
+    delay(5000);
+}
@@ -0,0 +1,72 @@
+/**
+ * @file 13-TimingReport.ino
+ * @brief Demonstrates the timing instrumentation of `ESPRIC::analyze()`.
+ * 
+ * The analyzer is run with an `ESPRIC_TimingReport`, which records the duration of every 
+ * predicate and every callback. The report is printed after the analysis, so a slow callback 
+ * (here a simulated NVS write) stands out without reading log timestamps by hand.
+ * 
+ * @note Define `ESPRIC_TIMING_CYCLE_COUNTER` in the build flags for nanosecond resolution; 
+ *       the default time source is `esp_timer_get_time()` with 1 us resolution.
+ */
+
+#include <ESPRIC.h>
+
+// Static storage: the report is too large for comfortable use on the loop task stack.
+static ESPRIC_TimingReport report;
+
+/**
+ * @brief Prints one statistics line of the timing report.
+ */
+void printStats(const char* label, const ESPRIC_TimingStats& stats) {
+    if (stats.count == 0) {
+        return;
+    }
+    Serial.printf("%-16s n=%-3lu min=%8lu ns  avg=%8lu ns  max=%8lu ns  total=%9llu ns\n",
+                  label, (unsigned long)stats.count, (unsigned long)stats.minNs,
+                  (unsigned long)stats.averageNs(), (unsigned long)stats.maxNs,
+                  (unsigned long long)stats.totalNs);
+}
+
+void setup() {
+    // Initialize the serial communication for debugging.
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n=== ESPRIC Timing Report ===");
+
+    std::vector<ESPRIC::ESPRIC_Condition> conditions = {
+        {
+            [](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_POWERON; },
+            []() { Serial.println("Power-on reset detected."); }
+        },
+        {
+            [](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_SW; },
+            []() { delay(5); Serial.println("Software reset detected, counters saved."); } // Simulated NVS write
+        },
+        {
+            [](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_DEEPSLEEP; },
+            []() { Serial.println("Wakeup from deep sleep."); }
+        }
+    };
+
+    ESPRIC analyzer(std::move(conditions), []() { Serial.println("No condition met."); });
+    analyzer.analyze(report);
+
+    Serial.println("\n--- Per condition ---");
+    for (size_t i = 0; i < report.entryCount; ++i) {
+        Serial.printf("Condition %u\n", (unsigned)i);
+        printStats("  predicate", report.entries[i].predicate);
+        printStats("  callback", report.entries[i].callback);
+    }
+
+    Serial.println("\n--- Totals ---");
+    printStats("predicates", report.predicates);
+    printStats("callbacks", report.callbacks);
+    printStats("analyze()", report.analyses);
+}
+
+void loop() {
+    // No additional logic required in this example.
+    delay(5000);
+}
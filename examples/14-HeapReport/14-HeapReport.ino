@@ -0,0 +1,70 @@
+/**
+ * @file 14-HeapReport.ino
+ * @brief Demonstrates heap allocation accounting for analyzer construction, analysis and callbacks.
+ * 
+ * The construction of the analyzer is measured with an `ESPRIC_HeapScope`; `analyze()` fills 
+ * the rest of an `ESPRIC_HeapReport`. The report shows allocations, requested bytes, retained 
+ * bytes and peak heap growth per phase and per callback, which exposes callbacks that allocate 
+ * (here a `String` built for a log line) or keep memory alive after the boot.
+ * 
+ * @note Allocation counts on the ESP32 require `CONFIG_HEAP_USE_HOOKS=y` and the build flag 
+ *       `-DESPRIC_HEAP_HOOKS`. Without them only retained bytes and peak growth are reported.
+ */
+
+#include <ESPRIC.h>
+
+// Static storage: keeps the report itself out of the measured heap and off the task stack.
+static ESPRIC_HeapReport report;
+
+/**
+ * @brief Prints one statistics line of the heap report.
+ */
+void printStats(const char* label, const ESPRIC_HeapStats& stats) {
+    Serial.printf("%-14s allocs=%-4lu frees=%-4lu bytes=%-6lu retained=%-6ld peak=%lu\n",
+                  label, (unsigned long)stats.allocations, (unsigned long)stats.frees,
+                  (unsigned long)stats.bytes, (long)stats.netBytes, (unsigned long)stats.peakBytes);
+}
+
+void setup() {
+    // Initialize the serial communication for debugging.
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n=== ESPRIC Heap Report ===");
+
+    ESPRIC_HeapScope construction(report.construction);
+    ESPRIC analyzer({
+        {
+            [](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_POWERON; },
+            []() {
+                String message = "Power-on reset at " + String(millis()) + " ms."; // Allocates
+                Serial.println(message);
+            }
+        },
+        {
+            [](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_SW; },
+            []() { Serial.println("Software reset detected."); }
+        }
+    }, []() { Serial.println("No condition met."); });
+    construction.stop();
+
+    analyzer.analyze(report);
+
+    Serial.println("\n--- Phases ---");
+    printStats("construction", report.construction);
+    printStats("analyze()", report.analysis);
+    printStats("predicates", report.predicates);
+    printStats("callbacks", report.callbacks);
+
+    Serial.println("\n--- Callbacks per condition ---");
+    for (size_t i = 0; i < report.entryCount; ++i) {
+        char label[16];
+        snprintf(label, sizeof(label), "condition %u", (unsigned)i);
+        printStats(label, report.entries[i]);
+    }
+}
+
+void loop() {
+    // No additional logic required in this example.
+    delay(5000);
+}
@@ -0,0 +1,64 @@
+/**
+ * @file 15-DeferredCallbacks.ino
+ * @brief Demonstrates immediate and deferred callbacks with `ESPRIC_DeferredWorker`.
+ * 
+ * Safety-critical reactions run immediately inside `analyze()`. Logging and statistics are 
+ * marked `CallbackMode::Deferred` and run on a background task, so `setup()` continues while 
+ * they finish.
+ * 
+ * @note If the worker queue is full (`ESPRIC_DEFERRED_QUEUE_LENGTH`), a deferred callback 
+ *       runs immediately instead of being dropped.
+ */
+
+#include <ESPRIC.h>
+#include <ESPRIC_Deferred.h>
+#include <Preferences.h>
+
+// The worker must outlive every analyzer that posts to it.
+static ESPRIC_DeferredWorker worker;
+static Preferences preferences;
+
+void setup() {
+    // Initialize the serial communication for debugging.
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n=== ESPRIC Deferred Callbacks ===");
+    worker.begin(4096, 1);
+
+    ESPRIC analyzer({});
+    analyzer.setDeferredWorker(&worker);
+
+    // Safety-critical: stop the actuators before anything else runs.
+    analyzer.addCondition(
+        [](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_BROWNOUT; },
+        []() { pinMode(LED_BUILTIN, OUTPUT); digitalWrite(LED_BUILTIN, LOW); });
+
+    // Statistics: one NVS write, off the boot path.
+    analyzer.addCondition(
+        [](const ESPRIC::StartupContext& ctx) { return ctx.resetReason != ESP_RST_DEEPSLEEP; },
+        []() {
+            preferences.begin("espric", false);
+            preferences.putUInt("boots", preferences.getUInt("boots", 0) + 1);
+            preferences.end();
+            Serial.println("[worker] Boot counter updated.");
+        },
+        0, ESPRIC::CallbackMode::Deferred);
+
+    // Logging: runs on the worker as well.
+    analyzer.addCondition(
+        [](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_POWERON; },
+        []() { Serial.println("[worker] Power-on reset detected."); },
+        0, ESPRIC::CallbackMode::Deferred);
+
+    const unsigned long start = micros();
+    ESPRIC::AnalysisResult result = analyzer.analyze();
+    Serial.printf("analyze() returned after %lu us: %u matched, %u deferred\n",
+                  micros() - start, (unsigned)result.matched, (unsigned)result.deferred);
+    Serial.println("Application started.");
+}
+
+void loop() {
+    // The deferred callbacks finish in the background.
+    delay(5000);
+}
@@ -0,0 +1,58 @@
+/**
+ * @file 16-ResetStatistics.ino
+ * @brief Demonstrates boot counters with `ESPRIC_ResetStatistics`.
+ * 
+ * Examples 04 to 06 update every counter with its own `putInt`. Here the analyzer counts every 
+ * boot per reset reason and wakeup cause in RAM and the store writes the counters that changed 
+ * after the analysis, also when a callback clears counters.
+ * 
+ * @note The device goes to deep sleep for 10 seconds after each boot, so the counters grow 
+ *       without flash traffic beyond the boot counter and the counters of this boot's reason 
+ *       and cause.
+ */
+
+#include <ESPRIC.h>
+#include <ESPRIC_ResetStatistics.h>
+
+// Counters in namespace "espric_stats", the changed ones written at the end of each analysis.
+static ESPRIC_ResetStatistics statistics("espric_stats", ESPRIC_ResetStatistics::CommitPolicy::AfterAnalyze);
+
+void setup() {
+    // Initialize the serial communication for debugging.
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n=== ESPRIC Reset Statistics ===");
+    statistics.begin();
+
+    ESPRIC analyzer({});
+    analyzer.setResetStatistics(&statistics);
+
+    // A brownout invalidates the crash history: clear it in RAM, the commit follows the analysis.
+    analyzer.addCondition(
+        [](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_BROWNOUT; },
+        []() {
+            statistics.clear(ESP_RST_PANIC);
+            statistics.clear(ESP_RST_INT_WDT);
+            statistics.clear(ESP_RST_TASK_WDT);
+            Serial.println("Brownout detected! Crash counters cleared.");
+        });
+
+    analyzer.analyze();
+
+    Serial.printf("Boots: %lu, power-on: %lu, panic: %lu, deep sleep: %lu, timer wakeups: %lu\n",
+                  (unsigned long)statistics.boots(),
+                  (unsigned long)statistics.resetCount(ESP_RST_POWERON),
+                  (unsigned long)statistics.resetCount(ESP_RST_PANIC),
+                  (unsigned long)statistics.resetCount(ESP_RST_DEEPSLEEP),
+                  (unsigned long)statistics.wakeupCount(ESP_SLEEP_WAKEUP_TIMER));
+    Serial.printf("NVS writes during this boot: %lu\n", (unsigned long)statistics.commits());
+
+    esp_sleep_enable_timer_wakeup(10ULL * 1000000ULL);
+    Serial.flush();
+    esp_deep_sleep_start();
+}
+
+void loop() {
+    // Not reached: the device sleeps at the end of setup().
+}
@@ -0,0 +1,77 @@
+/**
+ * @file 17-BootHistory.ino
+ * @brief Demonstrates a boot history in RTC memory with `ESPRIC_BootHistory`.
+ * 
+ * The analyzer appends every boot to a ring buffer in RTC memory, which survives deep sleep and 
+ * software resets without flash writes. The history is written to NVS only on a power-on reset 
+ * and every 8 boots; a condition uses the history to detect repeated panics.
+ * 
+ * @note The device goes to deep sleep for 10 seconds after each boot.
+ */
+
+#include <ESPRIC.h>
+#include <ESPRIC_BootHistory.h>
+#include <Preferences.h>
+
+static ESPRIC_BootHistory history; // Uses the ring buffer in RTC memory
+
+/**
+ * @brief Counts the panics among the last `boots` boots of the history.
+ */
+static size_t recentPanics(size_t boots) {
+    size_t panics = 0;
+    for (size_t i = history.size() > boots ? history.size() - boots : 0; i < history.size(); i++) {
+        panics += history.at(i).resetReason == ESP_RST_PANIC;
+    }
+    return panics;
+}
+
+void setup() {
+    // Initialize the serial communication for debugging.
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n=== ESPRIC Boot History ===");
+    if (history.begin() != ESPRIC_BootHistory::State::Valid) {
+        Serial.println("RTC memory held no valid history, starting a new one.");
+    }
+
+    // Lazy flush: one NVS write per 8 boots instead of one per boot.
+    history.setFlushHandler([](const ESPRIC_BootHistory& flushed) {
+        ESPRIC_BootRecord records[ESPRIC_BOOT_HISTORY_LENGTH] = {};
+        for (size_t i = 0; i < flushed.size(); i++) {
+            records[i] = flushed.at(i);
+        }
+        Preferences preferences;
+        preferences.begin("espric_boots", false);
+        const bool written = preferences.putBytes("history", records, sizeof(records)) == sizeof(records);
+        preferences.end();
+        Serial.println("Boot history flushed to NVS.");
+        return written;
+    }, 8);
+
+    ESPRIC analyzer({});
+    analyzer.setBootHistory(&history);
+
+    // The current boot is already in the history when the predicates run.
+    analyzer.addCondition(
+        [](const ESPRIC::StartupContext&) { return recentPanics(5) >= 3; },
+        []() { Serial.println("3 or more panics within the last 5 boots!"); });
+
+    analyzer.analyze();
+
+    for (size_t i = 0; i < history.size(); i++) {
+        const ESPRIC_BootRecord& record = history.at(i);
+        Serial.printf("#%lu reset %u wakeup %u at %lu s\n", (unsigned long)record.bootSequence,
+                      record.resetReason, record.wakeupCause, (unsigned long)record.timestamp);
+    }
+    Serial.printf("Boots not yet flushed: %lu\n", (unsigned long)history.unflushed());
+
+    esp_sleep_enable_timer_wakeup(10ULL * 1000000ULL);
+    Serial.flush();
+    esp_deep_sleep_start();
+}
+
+void loop() {
+    // Not reached: the device sleeps at the end of setup().
+}
@@ -0,0 +1,58 @@
+/**
+ * @file 18-BootEventLog.ino
+ * @brief Demonstrates the binary boot-event log `ESPRIC_BootLog` in a raw data partition.
+ * 
+ * Every boot is written as one 16-byte record (reset reason, wakeup cause, boot id, uptime of the 
+ * previous run, firmware tag, CRC) instead of a text line. Records wait in RTC memory and are 
+ * written with one flash write every `ESPRIC_BOOT_LOG_BATCH` boots. The log wraps inside the 
+ * partition and recovers from records torn by a power loss.
+ * 
+ * @note Requires a data partition labeled "espric_log" in a custom partitions.csv, e.g.
+ *       `espric_log, data, 0x99, , 0x10000`. Read it on a host with
+ *       `esptool.py read_flash <offset> 0x10000 bootlog.bin`.
+ */
+
+#include <ESPRIC.h>
+#include <ESPRIC_BootLog.h>
+
+static ESPRIC_BootLogPartition partition("espric_log");
+static ESPRIC_BootLog bootLog(partition, 0x0100); // Firmware tag 1.0
+
+void setup() {
+    // Initialize the serial communication for debugging.
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n=== ESPRIC Boot Event Log ===");
+    if (!partition.begin() || !bootLog.begin()) {
+        Serial.println("Partition 'espric_log' not found or unusable.");
+        return;
+    }
+    Serial.printf("Records: %u, torn: %u, pending in RTC memory: %u, this boot: #%lu\n",
+                  (unsigned)bootLog.recordsFound(), (unsigned)bootLog.tornFound(), (unsigned)bootLog.pending(),
+                  (unsigned long)bootLog.nextBootId());
+
+    const ESPRIC::StartupContext context = ESPRIC::StartupContext::capture();
+    bootLog.append(context); // Written to flash together with the next boots, once the batch is full
+
+    ESPRIC analyzer({});
+    analyzer.addCondition(
+        [](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_PANIC; },
+        []() { Serial.println("Panic detected!"); });
+    analyzer.analyze(context);
+
+    // Print the last records written to flash, oldest first.
+    const uint32_t first = bootLog.nextBootId() > 5 ? bootLog.nextBootId() - 5 : 1;
+    bootLog.replay([first](const ESPRIC_BootEvent& event) {
+        if (event.bootId >= first) {
+            Serial.printf("#%lu reset %u wakeup %u previous uptime %lu ms\n", (unsigned long)event.bootId,
+                          event.resetReason, event.wakeupCause, (unsigned long)event.uptimeMs);
+        }
+    });
+}
+
+void loop() {
+    // Saves the uptime in RTC memory; the next boot logs it as the uptime of the previous run.
+    ESPRIC_BootLog::heartbeat();
+    delay(1000);
+}
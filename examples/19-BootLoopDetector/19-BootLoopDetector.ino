@@ -0,0 +1,72 @@
+/**
+ * @file 19-BootLoopDetector.ino
+ * @brief Demonstrates crash-loop detection with `ESPRIC_BootLoopDetector`.
+ *
+ * 02-ModularESPRICExample halts with `while (true)` after a panic, which keeps the CPU busy and
+ * lets the task watchdog reset the device into the same loop. Here the detector counts panics
+ * and watchdog resets within 10 minutes in RTC memory before anything else is initialized, and
+ * the firmware escalates: skip optional features, start only the recovery path, and finally
+ * enter deep sleep without wakeup sources until the device is power cycled.
+ *
+ * @note Send 'p' on the serial monitor to trigger a panic and watch the escalation.
+ */
+
+#include <ESPRIC.h>
+#include <ESPRIC_BootLoop.h>
+#include <ESPRIC_CauseNames.h>
+
+static ESPRIC_BootLoopDetector detector; // Uses the crash window in RTC memory
+
+static const char* const kStateNames[] = {"Normal", "Degraded", "SafeMode", "Halt"};
+
+void setup() {
+    // First thing on every boot: no drivers, no network, no file system yet.
+    const ESPRIC_BootLoopState state = detector.update();
+
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n=== ESPRIC Boot Loop Detector ===");
+    Serial.printf("Boot-loop state: %s (%u crashes within %lu s)\n", kStateNames[static_cast<int>(state)],
+                  (unsigned)detector.crashes(), (unsigned long)detector.config().windowSeconds);
+    for (size_t i = 0; i < detector.crashes(); i++) {
+        Serial.printf("  %s at %lu s\n", espricResetReasonName(detector.crashReason(i)),
+                      (unsigned long)detector.crashTime(i));
+    }
+
+    ESPRIC analyzer({});
+    analyzer.setBootLoopDetector(&detector); // Conditions see the state of the update above
+
+    analyzer.addCondition(
+        [](const ESPRIC::StartupContext& context) { return context.bootLoopState == ESPRIC_BootLoopState::Halt; },
+        []() {
+            Serial.println("[ESPRIC] Persistent boot loop: sleeping until power cycled.");
+            Serial.flush();
+            esp_deep_sleep_start(); // No wakeup source: draws microamps instead of spinning
+        });
+    analyzer.addCondition(
+        [](const ESPRIC::StartupContext& context) { return context.bootLoopState == ESPRIC_BootLoopState::SafeMode; },
+        []() { Serial.println("[ESPRIC] Safe mode: starting the recovery path only."); });
+    analyzer.addCondition(
+        [](const ESPRIC::StartupContext& context) { return context.bootLoopState == ESPRIC_BootLoopState::Degraded; },
+        []() { Serial.println("[ESPRIC] Degraded: skipping optional features."); });
+
+    analyzer.analyze();
+}
+
+void loop() {
+    // One minute without a crash counts as stable.
+    static bool stable = false;
+    if (!stable && millis() > 60000) {
+        detector.markStable();
+        stable = true;
+        Serial.println("Running stable, crash window cleared.");
+    }
+
+    if (Serial.available() && Serial.read() == 'p') {
+        Serial.println("Triggering a panic...");
+        Serial.flush();
+        volatile int* invalid = nullptr;
+        *invalid = 0;
+    }
+}
@@ -0,0 +1,48 @@
+/**
+ * @file 20-ConditionGroups.ino
+ * @brief Demonstrates gated condition groups with `ESPRIC_ConditionGroup`.
+ *
+ * The predefined conditions of `ESPRIC_Conditions.h` (a copy of `variants/ESPRIC_Conditions.h`)
+ * are organized in groups: the wakeup conditions behind a deep-sleep gate and the crash resets
+ * behind a crash gate with a nested watchdog gate. When a gate fails, its whole group is skipped, so a timer wakeup
+ * evaluates the gates and the wakeup conditions but none of the crash conditions.
+ *
+ * @note The device goes to deep sleep for 10 seconds after each boot.
+ */
+
+#include <ESPRIC.h>
+#include <ESPRIC_ConditionGroup.h>
+#include "ESPRIC_Conditions.h"
+
+void setup() {
+    // Initialize the serial communication for debugging.
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n=== ESPRIC Condition Groups ===");
+
+    ESPRIC analyzer({});
+    analyzer.addGroup(getCrashGroup());
+    analyzer.addGroup(getDeepSleepWakeupGroup());
+
+    // A group built in place: sensor wakeups only count after a deep-sleep reset.
+    ESPRIC_ConditionGroup sensor([](const ESPRIC::StartupContext& ctx) {
+        return ctx.resetReason == ESP_RST_DEEPSLEEP && ctx.wakeupCause == ESP_SLEEP_WAKEUP_EXT0;
+    });
+    sensor.add([](const ESPRIC::StartupContext&) { return digitalRead(GPIO_NUM_4) == HIGH; },
+               []() { Serial.println("Sensor still active after the wakeup."); });
+    analyzer.addGroup(sensor);
+
+    const ESPRIC::AnalysisResult result = analyzer.analyze();
+    Serial.printf("Matched: %u, unmatched: %u, skipped by gates: %u\n", (unsigned)result.matched,
+                  (unsigned)result.unmatched, (unsigned)result.gated);
+
+    esp_sleep_enable_timer_wakeup(10ULL * 1000000ULL);
+    esp_sleep_enable_ext0_wakeup(GPIO_NUM_4, 1);
+    Serial.flush();
+    esp_deep_sleep_start();
+}
+
+void loop() {
+    // Not reached: the device sleeps at the end of setup().
+}
@@ -0,0 +1,44 @@
+/**
+ * @file 21-TargetTables.ino
+ * @brief Demonstrates the generated per-target cause tables of `ESPRIC_TargetTables.h`.
+ *
+ * `ESPRIC_TargetTables.h` (a copy of `variants/ESPRIC_TargetTables.h`) is generated by
+ * `tools/ConditionTableGenerator` from the ESP-IDF headers. `ESPRIC_CurrentTarget` holds the
+ * reset reasons and wakeup causes the chip the sketch is built for can report. They are bound to
+ * one report function with table dispatch, without a lambda per cause.
+ */
+
+#include <ESPRIC.h>
+#include <ESPRIC_TargetTable.h>
+#include "ESPRIC_TargetTables.h"
+
+/**
+ * @brief Prints the table entry of the detected reset reason or wakeup cause.
+ */
+static void report(const ESPRIC_TargetCause& cause) {
+    Serial.printf("%s: %s\n", cause.name, cause.description);
+}
+
+void setup() {
+    // Initialize the serial communication for debugging.
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n=== ESPRIC Target Tables ===");
+    Serial.printf("Target %s: %u reset reasons, %u wakeup causes\n", ESPRIC_CurrentTarget::kName,
+                  (unsigned)(sizeof(ESPRIC_CurrentTarget::kResetReasons) / sizeof(ESPRIC_TargetCause)),
+                  (unsigned)(sizeof(ESPRIC_CurrentTarget::kWakeupCauses) / sizeof(ESPRIC_TargetCause)));
+
+    ESPRIC analyzer({});
+    espricBindTargetCauses<ESPRIC_CurrentTarget>(analyzer, report);
+
+    // The masks cover every cause of the target; anything else comes from a newer ESP-IDF.
+    analyzer.addMaskCondition(~ESPRIC_CurrentTarget::kResetMask, 0,
+                              []() { Serial.println("Reset reason not in the table of this target."); });
+
+    analyzer.analyze();
+}
+
+void loop() {
+    // Nothing to do here.
+}
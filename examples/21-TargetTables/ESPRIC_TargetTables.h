@@ -0,0 +1,414 @@
+/**
+ * @file ESPRIC_TargetTables.h
+ * @brief Reset reasons and wakeup causes per ESP32 target, generated from the ESP-IDF headers.
+ *
+ * Generated by tools/ConditionTableGenerator/generate_condition_tables.py from:
+ * - `esp_reset_reason_t` in resources/idf-5_3_2/esp_system.h
+ * - `esp_sleep_wakeup_cause_t` in resources/Arduino-IDE/esp_sleep.h
+ *
+ * Do not edit this file; change tools/ConditionTableGenerator/targets.json or the headers and run the generator again.
+ * See `src/ESPRIC_TargetTable.h` for the table layout and `espricBindTargetCauses()`.
+ */
+
+#ifndef ESPRIC_TARGETTABLES_H
+#define ESPRIC_TARGETTABLES_H
+
+#include <ESPRIC_TargetTable.h>
+
+/**
+ * @struct ESPRIC_Target_ESP32
+ * @brief Causes the ESP32 can report.
+ */
+struct ESPRIC_Target_ESP32 {
+    static constexpr const char* kName = "ESP32";
+    static constexpr ESPRIC_TargetCause kResetReasons[] = {
+        { 0, "ESP_RST_UNKNOWN",   "Reset reason can not be determined"},
+        { 1, "ESP_RST_POWERON",   "Reset due to power-on event"},
+        { 3, "ESP_RST_SW",        "Software reset via esp_restart"},
+        { 4, "ESP_RST_PANIC",     "Software reset due to exception/panic"},
+        { 5, "ESP_RST_INT_WDT",   "Reset (software or hardware) due to interrupt watchdog"},
+        { 6, "ESP_RST_TASK_WDT",  "Reset due to task watchdog"},
+        { 7, "ESP_RST_WDT",       "Reset due to other watchdogs"},
+        { 8, "ESP_RST_DEEPSLEEP", "Reset after exiting deep sleep mode"},
+        { 9, "ESP_RST_BROWNOUT",  "Brownout reset (software or hardware)"},
+        {10, "ESP_RST_SDIO",      "Reset over SDIO"}
+    };
+    static constexpr uint32_t kResetMask = 0x000007FBu;
+    static constexpr ESPRIC_TargetCause kWakeupCauses[] = {
+        { 0, "ESP_SLEEP_WAKEUP_UNDEFINED", "In case of deep sleep, reset was not caused by exit from deep sleep"},
+        { 2, "ESP_SLEEP_WAKEUP_EXT0",      "Wakeup caused by external signal using RTC_IO"},
+        { 3, "ESP_SLEEP_WAKEUP_EXT1",      "Wakeup caused by external signal using RTC_CNTL"},
+        { 4, "ESP_SLEEP_WAKEUP_TIMER",     "Wakeup caused by timer"},
+        { 5, "ESP_SLEEP_WAKEUP_TOUCHPAD",  "Wakeup caused by touchpad"},
+        { 6, "ESP_SLEEP_WAKEUP_ULP",       "Wakeup caused by ULP program"},
+        { 7, "ESP_SLEEP_WAKEUP_GPIO",      "Wakeup caused by GPIO (light sleep only)"},
+        { 8, "ESP_SLEEP_WAKEUP_UART",      "Wakeup caused by UART (light sleep only)"},
+        { 9, "ESP_SLEEP_WAKEUP_WIFI",      "Wakeup caused by WIFI (light sleep only)"},
+        {12, "ESP_SLEEP_WAKEUP_BT",        "Wakeup caused by BT (light sleep only)"}
+    };
+    static constexpr uint32_t kWakeupMask = 0x000013FDu;
+};
+
+/**
+ * @struct ESPRIC_Target_ESP32S2
+ * @brief Causes the ESP32-S2 can report.
+ */
+struct ESPRIC_Target_ESP32S2 {
+    static constexpr const char* kName = "ESP32-S2";
+    static constexpr ESPRIC_TargetCause kResetReasons[] = {
+        { 0, "ESP_RST_UNKNOWN",    "Reset reason can not be determined"},
+        { 1, "ESP_RST_POWERON",    "Reset due to power-on event"},
+        { 2, "ESP_RST_EXT",        "Reset by external pin (not applicable for ESP32)"},
+        { 3, "ESP_RST_SW",         "Software reset via esp_restart"},
+        { 4, "ESP_RST_PANIC",      "Software reset due to exception/panic"},
+        { 5, "ESP_RST_INT_WDT",    "Reset (software or hardware) due to interrupt watchdog"},
+        { 6, "ESP_RST_TASK_WDT",   "Reset due to task watchdog"},
+        { 7, "ESP_RST_WDT",        "Reset due to other watchdogs"},
+        { 8, "ESP_RST_DEEPSLEEP",  "Reset after exiting deep sleep mode"},
+        { 9, "ESP_RST_BROWNOUT",   "Brownout reset (software or hardware)"},
+        {11, "ESP_RST_USB",        "Reset by USB peripheral"},
+        {13, "ESP_RST_EFUSE",      "Reset due to efuse error"},
+        {14, "ESP_RST_PWR_GLITCH", "Reset due to power glitch detected"},
+        {15, "ESP_RST_CPU_LOCKUP", "Reset due to CPU lock up (double exception)"}
+    };
+    static constexpr uint32_t kResetMask = 0x0000EBFFu;
+    static constexpr ESPRIC_TargetCause kWakeupCauses[] = {
+        { 0, "ESP_SLEEP_WAKEUP_UNDEFINED",       "In case of deep sleep, reset was not caused by exit from deep sleep"},
+        { 2, "ESP_SLEEP_WAKEUP_EXT0",            "Wakeup caused by external signal using RTC_IO"},
+        { 3, "ESP_SLEEP_WAKEUP_EXT1",            "Wakeup caused by external signal using RTC_CNTL"},
+        { 4, "ESP_SLEEP_WAKEUP_TIMER",           "Wakeup caused by timer"},
+        { 5, "ESP_SLEEP_WAKEUP_TOUCHPAD",        "Wakeup caused by touchpad"},
+        { 6, "ESP_SLEEP_WAKEUP_ULP",             "Wakeup caused by ULP program"},
+        { 7, "ESP_SLEEP_WAKEUP_GPIO",            "Wakeup caused by GPIO (light sleep only)"},
+        { 8, "ESP_SLEEP_WAKEUP_UART",            "Wakeup caused by UART (light sleep only)"},
+        { 9, "ESP_SLEEP_WAKEUP_WIFI",            "Wakeup caused by WIFI (light sleep only)"},
+        {10, "ESP_SLEEP_WAKEUP_COCPU",           "Wakeup caused by COCPU int"},
+        {11, "ESP_SLEEP_WAKEUP_COCPU_TRAP_TRIG", "Wakeup caused by COCPU crash"}
+    };
+    static constexpr uint32_t kWakeupMask = 0x00000FFDu;
+};
+
+/**
+ * @struct ESPRIC_Target_ESP32S3
+ * @brief Causes the ESP32-S3 can report.
+ */
+struct ESPRIC_Target_ESP32S3 {
+    static constexpr const char* kName = "ESP32-S3";
+    static constexpr ESPRIC_TargetCause kResetReasons[] = {
+        { 0, "ESP_RST_UNKNOWN",    "Reset reason can not be determined"},
+        { 1, "ESP_RST_POWERON",    "Reset due to power-on event"},
+        { 2, "ESP_RST_EXT",        "Reset by external pin (not applicable for ESP32)"},
+        { 3, "ESP_RST_SW",         "Software reset via esp_restart"},
+        { 4, "ESP_RST_PANIC",      "Software reset due to exception/panic"},
+        { 5, "ESP_RST_INT_WDT",    "Reset (software or hardware) due to interrupt watchdog"},
+        { 6, "ESP_RST_TASK_WDT",   "Reset due to task watchdog"},
+        { 7, "ESP_RST_WDT",        "Reset due to other watchdogs"},
+        { 8, "ESP_RST_DEEPSLEEP",  "Reset after exiting deep sleep mode"},
+        { 9, "ESP_RST_BROWNOUT",   "Brownout reset (software or hardware)"},
+        {11, "ESP_RST_USB",        "Reset by USB peripheral"},
+        {12, "ESP_RST_JTAG",       "Reset by JTAG"},
+        {13, "ESP_RST_EFUSE",      "Reset due to efuse error"},
+        {14, "ESP_RST_PWR_GLITCH", "Reset due to power glitch detected"},
+        {15, "ESP_RST_CPU_LOCKUP", "Reset due to CPU lock up (double exception)"}
+    };
+    static constexpr uint32_t kResetMask = 0x0000FBFFu;
+    static constexpr ESPRIC_TargetCause kWakeupCauses[] = {
+        { 0, "ESP_SLEEP_WAKEUP_UNDEFINED",       "In case of deep sleep, reset was not caused by exit from deep sleep"},
+        { 2, "ESP_SLEEP_WAKEUP_EXT0",            "Wakeup caused by external signal using RTC_IO"},
+        { 3, "ESP_SLEEP_WAKEUP_EXT1",            "Wakeup caused by external signal using RTC_CNTL"},
+        { 4, "ESP_SLEEP_WAKEUP_TIMER",           "Wakeup caused by timer"},
+        { 5, "ESP_SLEEP_WAKEUP_TOUCHPAD",        "Wakeup caused by touchpad"},
+        { 6, "ESP_SLEEP_WAKEUP_ULP",             "Wakeup caused by ULP program"},
+        { 7, "ESP_SLEEP_WAKEUP_GPIO",            "Wakeup caused by GPIO (light sleep only)"},
+        { 8, "ESP_SLEEP_WAKEUP_UART",            "Wakeup caused by UART (light sleep only)"},
+        { 9, "ESP_SLEEP_WAKEUP_WIFI",            "Wakeup caused by WIFI (light sleep only)"},
+        {10, "ESP_SLEEP_WAKEUP_COCPU",           "Wakeup caused by COCPU int"},
+        {11, "ESP_SLEEP_WAKEUP_COCPU_TRAP_TRIG", "Wakeup caused by COCPU crash"},
+        {12, "ESP_SLEEP_WAKEUP_BT",              "Wakeup caused by BT (light sleep only)"}
+    };
+    static constexpr uint32_t kWakeupMask = 0x00001FFDu;
+};
+
+/**
+ * @struct ESPRIC_Target_ESP32C2
+ * @brief Causes the ESP32-C2 can report.
+ */
+struct ESPRIC_Target_ESP32C2 {
+    static constexpr const char* kName = "ESP32-C2";
+    static constexpr ESPRIC_TargetCause kResetReasons[] = {
+        { 0, "ESP_RST_UNKNOWN",    "Reset reason can not be determined"},
+        { 1, "ESP_RST_POWERON",    "Reset due to power-on event"},
+        { 2, "ESP_RST_EXT",        "Reset by external pin (not applicable for ESP32)"},
+        { 3, "ESP_RST_SW",         "Software reset via esp_restart"},
+        { 4, "ESP_RST_PANIC",      "Software reset due to exception/panic"},
+        { 5, "ESP_RST_INT_WDT",    "Reset (software or hardware) due to interrupt watchdog"},
+        { 6, "ESP_RST_TASK_WDT",   "Reset due to task watchdog"},
+        { 7, "ESP_RST_WDT",        "Reset due to other watchdogs"},
+        { 8, "ESP_RST_DEEPSLEEP",  "Reset after exiting deep sleep mode"},
+        { 9, "ESP_RST_BROWNOUT",   "Brownout reset (software or hardware)"},
+        {13, "ESP_RST_EFUSE",      "Reset due to efuse error"},
+        {14, "ESP_RST_PWR_GLITCH", "Reset due to power glitch detected"},
+        {15, "ESP_RST_CPU_LOCKUP", "Reset due to CPU lock up (double exception)"}
+    };
+    static constexpr uint32_t kResetMask = 0x0000E3FFu;
+    static constexpr ESPRIC_TargetCause kWakeupCauses[] = {
+        { 0, "ESP_SLEEP_WAKEUP_UNDEFINED", "In case of deep sleep, reset was not caused by exit from deep sleep"},
+        { 4, "ESP_SLEEP_WAKEUP_TIMER",     "Wakeup caused by timer"},
+        { 7, "ESP_SLEEP_WAKEUP_GPIO",      "Wakeup caused by GPIO (light sleep only)"},
+        { 8, "ESP_SLEEP_WAKEUP_UART",      "Wakeup caused by UART (light sleep only)"},
+        { 9, "ESP_SLEEP_WAKEUP_WIFI",      "Wakeup caused by WIFI (light sleep only)"},
+        {12, "ESP_SLEEP_WAKEUP_BT",        "Wakeup caused by BT (light sleep only)"}
+    };
+    static constexpr uint32_t kWakeupMask = 0x00001391u;
+};
+
+/**
+ * @struct ESPRIC_Target_ESP32C3
+ * @brief Causes the ESP32-C3 can report.
+ */
+struct ESPRIC_Target_ESP32C3 {
+    static constexpr const char* kName = "ESP32-C3";
+    static constexpr ESPRIC_TargetCause kResetReasons[] = {
+        { 0, "ESP_RST_UNKNOWN",    "Reset reason can not be determined"},
+        { 1, "ESP_RST_POWERON",    "Reset due to power-on event"},
+        { 2, "ESP_RST_EXT",        "Reset by external pin (not applicable for ESP32)"},
+        { 3, "ESP_RST_SW",         "Software reset via esp_restart"},
+        { 4, "ESP_RST_PANIC",      "Software reset due to exception/panic"},
+        { 5, "ESP_RST_INT_WDT",    "Reset (software or hardware) due to interrupt watchdog"},
+        { 6, "ESP_RST_TASK_WDT",   "Reset due to task watchdog"},
+        { 7, "ESP_RST_WDT",        "Reset due to other watchdogs"},
+        { 8, "ESP_RST_DEEPSLEEP",  "Reset after exiting deep sleep mode"},
+        { 9, "ESP_RST_BROWNOUT",   "Brownout reset (software or hardware)"},
+        {11, "ESP_RST_USB",        "Reset by USB peripheral"},
+        {12, "ESP_RST_JTAG",       "Reset by JTAG"},
+        {13, "ESP_RST_EFUSE",      "Reset due to efuse error"},
+        {14, "ESP_RST_PWR_GLITCH", "Reset due to power glitch detected"},
+        {15, "ESP_RST_CPU_LOCKUP", "Reset due to CPU lock up (double exception)"}
+    };
+    static constexpr uint32_t kResetMask = 0x0000FBFFu;
+    static constexpr ESPRIC_TargetCause kWakeupCauses[] = {
+        { 0, "ESP_SLEEP_WAKEUP_UNDEFINED", "In case of deep sleep, reset was not caused by exit from deep sleep"},
+        { 4, "ESP_SLEEP_WAKEUP_TIMER",     "Wakeup caused by timer"},
+        { 7, "ESP_SLEEP_WAKEUP_GPIO",      "Wakeup caused by GPIO (light sleep only)"},
+        { 8, "ESP_SLEEP_WAKEUP_UART",      "Wakeup caused by UART (light sleep only)"},
+        { 9, "ESP_SLEEP_WAKEUP_WIFI",      "Wakeup caused by WIFI (light sleep only)"},
+        {12, "ESP_SLEEP_WAKEUP_BT",        "Wakeup caused by BT (light sleep only)"}
+    };
+    static constexpr uint32_t kWakeupMask = 0x00001391u;
+};
+
+/**
+ * @struct ESPRIC_Target_ESP32C5
+ * @brief Causes the ESP32-C5 can report.
+ */
+struct ESPRIC_Target_ESP32C5 {
+    static constexpr const char* kName = "ESP32-C5";
+    static constexpr ESPRIC_TargetCause kResetReasons[] = {
+        { 0, "ESP_RST_UNKNOWN",    "Reset reason can not be determined"},
+        { 1, "ESP_RST_POWERON",    "Reset due to power-on event"},
+        { 2, "ESP_RST_EXT",        "Reset by external pin (not applicable for ESP32)"},
+        { 3, "ESP_RST_SW",         "Software reset via esp_restart"},
+        { 4, "ESP_RST_PANIC",      "Software reset due to exception/panic"},
+        { 5, "ESP_RST_INT_WDT",    "Reset (software or hardware) due to interrupt watchdog"},
+        { 6, "ESP_RST_TASK_WDT",   "Reset due to task watchdog"},
+        { 7, "ESP_RST_WDT",        "Reset due to other watchdogs"},
+        { 8, "ESP_RST_DEEPSLEEP",  "Reset after exiting deep sleep mode"},
+        { 9, "ESP_RST_BROWNOUT",   "Brownout reset (software or hardware)"},
+        {10, "ESP_RST_SDIO",       "Reset over SDIO"},
+        {11, "ESP_RST_USB",        "Reset by USB peripheral"},
+        {12, "ESP_RST_JTAG",       "Reset by JTAG"},
+        {13, "ESP_RST_EFUSE",      "Reset due to efuse error"},
+        {14, "ESP_RST_PWR_GLITCH", "Reset due to power glitch detected"},
+        {15, "ESP_RST_CPU_LOCKUP", "Reset due to CPU lock up (double exception)"}
+    };
+    static constexpr uint32_t kResetMask = 0x0000FFFFu;
+    static constexpr ESPRIC_TargetCause kWakeupCauses[] = {
+        { 0, "ESP_SLEEP_WAKEUP_UNDEFINED", "In case of deep sleep, reset was not caused by exit from deep sleep"},
+        { 3, "ESP_SLEEP_WAKEUP_EXT1",      "Wakeup caused by external signal using RTC_CNTL"},
+        { 4, "ESP_SLEEP_WAKEUP_TIMER",     "Wakeup caused by timer"},
+        { 6, "ESP_SLEEP_WAKEUP_ULP",       "Wakeup caused by ULP program"},
+        { 7, "ESP_SLEEP_WAKEUP_GPIO",      "Wakeup caused by GPIO (light sleep only)"},
+        { 8, "ESP_SLEEP_WAKEUP_UART",      "Wakeup caused by UART (light sleep only)"},
+        { 9, "ESP_SLEEP_WAKEUP_WIFI",      "Wakeup caused by WIFI (light sleep only)"},
+        {12, "ESP_SLEEP_WAKEUP_BT",        "Wakeup caused by BT (light sleep only)"}
+    };
+    static constexpr uint32_t kWakeupMask = 0x000013D9u;
+};
+
+/**
+ * @struct ESPRIC_Target_ESP32C6
+ * @brief Causes the ESP32-C6 can report.
+ */
+struct ESPRIC_Target_ESP32C6 {
+    static constexpr const char* kName = "ESP32-C6";
+    static constexpr ESPRIC_TargetCause kResetReasons[] = {
+        { 0, "ESP_RST_UNKNOWN",    "Reset reason can not be determined"},
+        { 1, "ESP_RST_POWERON",    "Reset due to power-on event"},
+        { 2, "ESP_RST_EXT",        "Reset by external pin (not applicable for ESP32)"},
+        { 3, "ESP_RST_SW",         "Software reset via esp_restart"},
+        { 4, "ESP_RST_PANIC",      "Software reset due to exception/panic"},
+        { 5, "ESP_RST_INT_WDT",    "Reset (software or hardware) due to interrupt watchdog"},
+        { 6, "ESP_RST_TASK_WDT",   "Reset due to task watchdog"},
+        { 7, "ESP_RST_WDT",        "Reset due to other watchdogs"},
+        { 8, "ESP_RST_DEEPSLEEP",  "Reset after exiting deep sleep mode"},
+        { 9, "ESP_RST_BROWNOUT",   "Brownout reset (software or hardware)"},
+        {10, "ESP_RST_SDIO",       "Reset over SDIO"},
+        {11, "ESP_RST_USB",        "Reset by USB peripheral"},
+        {12, "ESP_RST_JTAG",       "Reset by JTAG"},
+        {13, "ESP_RST_EFUSE",      "Reset due to efuse error"},
+        {14, "ESP_RST_PWR_GLITCH", "Reset due to power glitch detected"},
+        {15, "ESP_RST_CPU_LOCKUP", "Reset due to CPU lock up (double exception)"}
+    };
+    static constexpr uint32_t kResetMask = 0x0000FFFFu;
+    static constexpr ESPRIC_TargetCause kWakeupCauses[] = {
+        { 0, "ESP_SLEEP_WAKEUP_UNDEFINED", "In case of deep sleep, reset was not caused by exit from deep sleep"},
+        { 3, "ESP_SLEEP_WAKEUP_EXT1",      "Wakeup caused by external signal using RTC_CNTL"},
+        { 4, "ESP_SLEEP_WAKEUP_TIMER",     "Wakeup caused by timer"},
+        { 6, "ESP_SLEEP_WAKEUP_ULP",       "Wakeup caused by ULP program"},
+        { 7, "ESP_SLEEP_WAKEUP_GPIO",      "Wakeup caused by GPIO (light sleep only)"},
+        { 8, "ESP_SLEEP_WAKEUP_UART",      "Wakeup caused by UART (light sleep only)"},
+        { 9, "ESP_SLEEP_WAKEUP_WIFI",      "Wakeup caused by WIFI (light sleep only)"},
+        {12, "ESP_SLEEP_WAKEUP_BT",        "Wakeup caused by BT (light sleep only)"}
+    };
+    static constexpr uint32_t kWakeupMask = 0x000013D9u;
+};
+
+/**
+ * @struct ESPRIC_Target_ESP32H2
+ * @brief Causes the ESP32-H2 can report.
+ */
+struct ESPRIC_Target_ESP32H2 {
+    static constexpr const char* kName = "ESP32-H2";
+    static constexpr ESPRIC_TargetCause kResetReasons[] = {
+        { 0, "ESP_RST_UNKNOWN",    "Reset reason can not be determined"},
+        { 1, "ESP_RST_POWERON",    "Reset due to power-on event"},
+        { 2, "ESP_RST_EXT",        "Reset by external pin (not applicable for ESP32)"},
+        { 3, "ESP_RST_SW",         "Software reset via esp_restart"},
+        { 4, "ESP_RST_PANIC",      "Software reset due to exception/panic"},
+        { 5, "ESP_RST_INT_WDT",    "Reset (software or hardware) due to interrupt watchdog"},
+        { 6, "ESP_RST_TASK_WDT",   "Reset due to task watchdog"},
+        { 7, "ESP_RST_WDT",        "Reset due to other watchdogs"},
+        { 8, "ESP_RST_DEEPSLEEP",  "Reset after exiting deep sleep mode"},
+        { 9, "ESP_RST_BROWNOUT",   "Brownout reset (software or hardware)"},
+        {11, "ESP_RST_USB",        "Reset by USB peripheral"},
+        {12, "ESP_RST_JTAG",       "Reset by JTAG"},
+        {13, "ESP_RST_EFUSE",      "Reset due to efuse error"},
+        {14, "ESP_RST_PWR_GLITCH", "Reset due to power glitch detected"},
+        {15, "ESP_RST_CPU_LOCKUP", "Reset due to CPU lock up (double exception)"}
+    };
+    static constexpr uint32_t kResetMask = 0x0000FBFFu;
+    static constexpr ESPRIC_TargetCause kWakeupCauses[] = {
+        { 0, "ESP_SLEEP_WAKEUP_UNDEFINED", "In case of deep sleep, reset was not caused by exit from deep sleep"},
+        { 3, "ESP_SLEEP_WAKEUP_EXT1",      "Wakeup caused by external signal using RTC_CNTL"},
+        { 4, "ESP_SLEEP_WAKEUP_TIMER",     "Wakeup caused by timer"},
+        { 7, "ESP_SLEEP_WAKEUP_GPIO",      "Wakeup caused by GPIO (light sleep only)"},
+        { 8, "ESP_SLEEP_WAKEUP_UART",      "Wakeup caused by UART (light sleep only)"},
+        {12, "ESP_SLEEP_WAKEUP_BT",        "Wakeup caused by BT (light sleep only)"}
+    };
+    static constexpr uint32_t kWakeupMask = 0x00001199u;
+};
+
+/**
+ * @struct ESPRIC_Target_ESP32P4
+ * @brief Causes the ESP32-P4 can report.
+ */
+struct ESPRIC_Target_ESP32P4 {
+    static constexpr const char* kName = "ESP32-P4";
+    static constexpr ESPRIC_TargetCause kResetReasons[] = {
+        { 0, "ESP_RST_UNKNOWN",    "Reset reason can not be determined"},
+        { 1, "ESP_RST_POWERON",    "Reset due to power-on event"},
+        { 2, "ESP_RST_EXT",        "Reset by external pin (not applicable for ESP32)"},
+        { 3, "ESP_RST_SW",         "Software reset via esp_restart"},
+        { 4, "ESP_RST_PANIC",      "Software reset due to exception/panic"},
+        { 5, "ESP_RST_INT_WDT",    "Reset (software or hardware) due to interrupt watchdog"},
+        { 6, "ESP_RST_TASK_WDT",   "Reset due to task watchdog"},
+        { 7, "ESP_RST_WDT",        "Reset due to other watchdogs"},
+        { 8, "ESP_RST_DEEPSLEEP",  "Reset after exiting deep sleep mode"},
+        { 9, "ESP_RST_BROWNOUT",   "Brownout reset (software or hardware)"},
+        {11, "ESP_RST_USB",        "Reset by USB peripheral"},
+        {12, "ESP_RST_JTAG",       "Reset by JTAG"},
+        {13, "ESP_RST_EFUSE",      "Reset due to efuse error"},
+        {14, "ESP_RST_PWR_GLITCH", "Reset due to power glitch detected"},
+        {15, "ESP_RST_CPU_LOCKUP", "Reset due to CPU lock up (double exception)"}
+    };
+    static constexpr uint32_t kResetMask = 0x0000FBFFu;
+    static constexpr ESPRIC_TargetCause kWakeupCauses[] = {
+        { 0, "ESP_SLEEP_WAKEUP_UNDEFINED", "In case of deep sleep, reset was not caused by exit from deep sleep"},
+        { 3, "ESP_SLEEP_WAKEUP_EXT1",      "Wakeup caused by external signal using RTC_CNTL"},
+        { 4, "ESP_SLEEP_WAKEUP_TIMER",     "Wakeup caused by timer"},
+        { 5, "ESP_SLEEP_WAKEUP_TOUCHPAD",  "Wakeup caused by touchpad"},
+        { 6, "ESP_SLEEP_WAKEUP_ULP",       "Wakeup caused by ULP program"},
+        { 7, "ESP_SLEEP_WAKEUP_GPIO",      "Wakeup caused by GPIO (light sleep only)"},
+        { 8, "ESP_SLEEP_WAKEUP_UART",      "Wakeup caused by UART (light sleep only)"}
+    };
+    static constexpr uint32_t kWakeupMask = 0x000001F9u;
+};
+
+/**
+ * @brief Table of the target the sketch is built for.
+ *
+ * Host builds define no `CONFIG_IDF_TARGET_*` macro and name a table explicitly.
+ */
+#if defined(CONFIG_IDF_TARGET_ESP32)
+#define ESPRIC_HAS_CURRENT_TARGET 1
+using ESPRIC_CurrentTarget = ESPRIC_Target_ESP32;
+#elif defined(CONFIG_IDF_TARGET_ESP32S2)
+#define ESPRIC_HAS_CURRENT_TARGET 1
+using ESPRIC_CurrentTarget = ESPRIC_Target_ESP32S2;
+#elif defined(CONFIG_IDF_TARGET_ESP32S3)
+#define ESPRIC_HAS_CURRENT_TARGET 1
+using ESPRIC_CurrentTarget = ESPRIC_Target_ESP32S3;
+#elif defined(CONFIG_IDF_TARGET_ESP32C2)
+#define ESPRIC_HAS_CURRENT_TARGET 1
+using ESPRIC_CurrentTarget = ESPRIC_Target_ESP32C2;
+#elif defined(CONFIG_IDF_TARGET_ESP32C3)
+#define ESPRIC_HAS_CURRENT_TARGET 1
+using ESPRIC_CurrentTarget = ESPRIC_Target_ESP32C3;
+#elif defined(CONFIG_IDF_TARGET_ESP32C5)
+#define ESPRIC_HAS_CURRENT_TARGET 1
+using ESPRIC_CurrentTarget = ESPRIC_Target_ESP32C5;
+#elif defined(CONFIG_IDF_TARGET_ESP32C6)
+#define ESPRIC_HAS_CURRENT_TARGET 1
+using ESPRIC_CurrentTarget = ESPRIC_Target_ESP32C6;
+#elif defined(CONFIG_IDF_TARGET_ESP32H2)
+#define ESPRIC_HAS_CURRENT_TARGET 1
+using ESPRIC_CurrentTarget = ESPRIC_Target_ESP32H2;
+#elif defined(CONFIG_IDF_TARGET_ESP32P4)
+#define ESPRIC_HAS_CURRENT_TARGET 1
+using ESPRIC_CurrentTarget = ESPRIC_Target_ESP32P4;
+#endif
+
+#if defined(ESP_IDF_VERSION) && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+// The tables store plain numbers; the enums of the framework must still agree with them.
+static_assert(ESP_RST_UNKNOWN == 0, "ESP_RST_UNKNOWN changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_RST_POWERON == 1, "ESP_RST_POWERON changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_RST_EXT == 2, "ESP_RST_EXT changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_RST_SW == 3, "ESP_RST_SW changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_RST_PANIC == 4, "ESP_RST_PANIC changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_RST_INT_WDT == 5, "ESP_RST_INT_WDT changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_RST_TASK_WDT == 6, "ESP_RST_TASK_WDT changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_RST_WDT == 7, "ESP_RST_WDT changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_RST_DEEPSLEEP == 8, "ESP_RST_DEEPSLEEP changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_RST_BROWNOUT == 9, "ESP_RST_BROWNOUT changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_RST_SDIO == 10, "ESP_RST_SDIO changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_RST_USB == 11, "ESP_RST_USB changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_RST_JTAG == 12, "ESP_RST_JTAG changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_RST_EFUSE == 13, "ESP_RST_EFUSE changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_RST_PWR_GLITCH == 14, "ESP_RST_PWR_GLITCH changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_RST_CPU_LOCKUP == 15, "ESP_RST_CPU_LOCKUP changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_SLEEP_WAKEUP_UNDEFINED == 0, "ESP_SLEEP_WAKEUP_UNDEFINED changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_SLEEP_WAKEUP_ALL == 1, "ESP_SLEEP_WAKEUP_ALL changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_SLEEP_WAKEUP_EXT0 == 2, "ESP_SLEEP_WAKEUP_EXT0 changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_SLEEP_WAKEUP_EXT1 == 3, "ESP_SLEEP_WAKEUP_EXT1 changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_SLEEP_WAKEUP_TIMER == 4, "ESP_SLEEP_WAKEUP_TIMER changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_SLEEP_WAKEUP_TOUCHPAD == 5, "ESP_SLEEP_WAKEUP_TOUCHPAD changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_SLEEP_WAKEUP_ULP == 6, "ESP_SLEEP_WAKEUP_ULP changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_SLEEP_WAKEUP_GPIO == 7, "ESP_SLEEP_WAKEUP_GPIO changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_SLEEP_WAKEUP_UART == 8, "ESP_SLEEP_WAKEUP_UART changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_SLEEP_WAKEUP_WIFI == 9, "ESP_SLEEP_WAKEUP_WIFI changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_SLEEP_WAKEUP_COCPU == 10, "ESP_SLEEP_WAKEUP_COCPU changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_SLEEP_WAKEUP_COCPU_TRAP_TRIG == 11, "ESP_SLEEP_WAKEUP_COCPU_TRAP_TRIG changed, regenerate ESPRIC_TargetTables.h");
+static_assert(ESP_SLEEP_WAKEUP_BT == 12, "ESP_SLEEP_WAKEUP_BT changed, regenerate ESPRIC_TargetTables.h");
+#endif
+
+#endif // ESPRIC_TARGETTABLES_H
@@ -0,0 +1,47 @@
+/**
+ * @file 22-CoverageCheck.ino
+ * @brief Demonstrates the compile-time coverage check of `ESPRIC_Coverage.h`.
+ *
+ * `ESPRIC_CHECK_COVERAGE` compares the causes the build target can report (`ESPRIC_TargetTables.h`,
+ * a copy of `variants/ESPRIC_TargetTables.h`) with the handled causes of the predefined conditions
+ * (`ESPRIC_Conditions.h`, a copy of `variants/ESPRIC_Conditions.h`). A gap produces a compiler
+ * warning, or an error with `ESPRIC_COVERAGE_STRICT`. The names of unhandled causes of a smaller
+ * handler set are printed from flash; the check itself costs no RAM and no boot time.
+ */
+
+#include <ESPRIC.h>
+#include <ESPRIC_Coverage.h>
+#include "ESPRIC_Conditions.h"
+#include "ESPRIC_TargetTables.h"
+
+// The predefined conditions handle every cause of every target: no warning.
+ESPRIC_CHECK_COVERAGE(ESPRIC_CurrentTarget, ESPRIC_CONDITIONS_RESET_MASK, ESPRIC_CONDITIONS_WAKEUP_MASK);
+
+// A sensor firmware that only cares about crashes, power-on and timer wakeups.
+constexpr uint32_t kHandledResets = ESPRIC_RESET_MASK_ANY_CRASH | espricResetMask(ESP_RST_POWERON, ESP_RST_DEEPSLEEP);
+constexpr uint32_t kHandledWakeups = espricWakeupMask(ESP_SLEEP_WAKEUP_UNDEFINED, ESP_SLEEP_WAKEUP_TIMER);
+using SensorCoverage = ESPRIC_Coverage<ESPRIC_CurrentTarget, kHandledResets, kHandledWakeups>;
+
+void setup() {
+    // Initialize the serial communication for debugging.
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n=== ESPRIC Coverage Check ===");
+    Serial.printf("Sensor handlers on %s, unhandled:\n", ESPRIC_CurrentTarget::kName);
+    for (const char* name : SensorCoverage::kMissingResets) {
+        Serial.printf("  %s\n", name);
+    }
+    for (const char* name : SensorCoverage::kMissingWakeups) {
+        Serial.printf("  %s\n", name);
+    }
+
+    ESPRIC resetAnalyzer(getResetConditions());
+    ESPRIC wakeupAnalyzer(getWakeupConditions());
+    resetAnalyzer.analyze();
+    wakeupAnalyzer.analyze();
+}
+
+void loop() {
+    // Nothing to do here.
+}
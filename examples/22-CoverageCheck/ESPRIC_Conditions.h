@@ -0,0 +1,213 @@
+/**
+ * @file ESPRIC_Conditions.h
+ * @brief Defines conditions for ESP32 reset and wakeup causes.
+ *
+ * This header provides a set of conditions for analyzing the reset and wakeup
+ * causes of an ESP32 device using the ESPRIC library. It covers all documented
+ * reset and wakeup causes, allowing developers to handle specific scenarios
+ * programmatically.
+ *
+ * @author Thomas Walloschke <artkeller@gmc.de>
+ * @date 20250101 
+ */
+
+#ifndef ESPRIC_CONDITIONS_H
+#define ESPRIC_CONDITIONS_H
+
+#include <ESPRIC.h>
+#include <esp_system.h>			// Arduino version != IDF-Version
+#include <esp_sleep.h>
+#include <esp_idf_version.h>
+#include <ESPRIC_CauseNames.h>
+#include <ESPRIC_ConditionGroup.h>
+
+// The shared name tables are indexed by the numeric value of the ESP-IDF enums.
+// ESP-IDF < 5.1 (Arduino-ESP32 2.x) ends esp_reset_reason_t at ESP_RST_SDIO.
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+static_assert(ESP_RST_CPU_LOCKUP == 15 && ESPRIC_RESET_REASON_NAME_COUNT == 16,
+              "ESPRIC_RESET_REASON_NAMES does not match esp_reset_reason_t");
+#else
+static_assert(ESP_RST_SDIO == 10 && ESPRIC_RESET_REASON_NAME_COUNT > ESP_RST_SDIO,
+              "ESPRIC_RESET_REASON_NAMES does not match esp_reset_reason_t");
+#endif
+static_assert(ESP_SLEEP_WAKEUP_BT == 12 && ESPRIC_WAKEUP_CAUSE_NAME_COUNT == 13,
+              "ESPRIC_WAKEUP_CAUSE_NAMES does not match esp_sleep_wakeup_cause_t");
+
+/**
+ * @brief Reset reasons handled by `getResetConditions()`, for `ESPRIC_CHECK_COVERAGE`.
+ */
+#ifdef CONFIG_IDF_TARGET_ESP32
+constexpr uint32_t ESPRIC_CONDITIONS_RESET_MASK =
+    espricResetMask(ESP_RST_UNKNOWN, ESP_RST_POWERON, ESP_RST_SW, ESP_RST_PANIC, ESP_RST_INT_WDT, ESP_RST_TASK_WDT,
+                    ESP_RST_WDT, ESP_RST_DEEPSLEEP, ESP_RST_BROWNOUT, ESP_RST_SDIO);
+#else
+constexpr uint32_t ESPRIC_CONDITIONS_RESET_MASK = espricCauseBit(ESP_RST_CPU_LOCKUP + 1) - 1;
+#endif
+
+/**
+ * @brief Wakeup causes handled by `getWakeupConditions()`, all but `ESP_SLEEP_WAKEUP_ALL`.
+ */
+constexpr uint32_t ESPRIC_CONDITIONS_WAKEUP_MASK =
+    (espricCauseBit(ESP_SLEEP_WAKEUP_BT + 1) - 1) & ~espricWakeupMask(ESP_SLEEP_WAKEUP_ALL);
+
+/**
+ * @brief Get predefined reset conditions for the ESP32.
+ * 
+ * This function defines a vector of conditions for various ESP_RST causes.
+ * Each condition includes a detection function, evaluated against the startup context
+ * captured once by `ESPRIC::analyze()`, and an associated callback.
+ * 
+ * @return A vector of `ESPRIC_Condition` objects for reset analysis.
+ *
+ * @note The additional reset codes (e.g., USB reset, power glitch reset, etc.)
+ *       are only available on newer ESP32 chips (ESP32-S2, ESP32-S3). For older
+ *       ESP32 models, these reset codes are not supported and will not be included
+ *       in the analysis. Ensure compatibility with your target chip.
+ */
+std::vector<ESPRIC::ESPRIC_Condition> getResetConditions() {
+    return {
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_UNKNOWN; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_UNKNOWN)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_POWERON; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_POWERON)); }},
+	#ifndef CONFIG_IDF_TARGET_ESP32
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_EXT; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_EXT)); }},
+	#endif
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_SW; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_SW)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_PANIC; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_PANIC)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_INT_WDT; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_INT_WDT)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_TASK_WDT; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_TASK_WDT)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_WDT; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_WDT)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_DEEPSLEEP; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_DEEPSLEEP)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_BROWNOUT; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_BROWNOUT)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_SDIO; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_SDIO)); }},
+    #ifndef CONFIG_IDF_TARGET_ESP32
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_USB; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_USB)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_JTAG; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_JTAG)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_EFUSE; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_EFUSE)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_PWR_GLITCH; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_PWR_GLITCH)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_CPU_LOCKUP; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_CPU_LOCKUP)); }}
+    #endif
+    };
+}
+
+/**
+ * @brief Get predefined wakeup conditions for the ESP32.
+ * 
+ * This function defines a vector of conditions for various wakeup causes.
+ * Each condition includes a detection function, evaluated against the startup context
+ * captured once by `ESPRIC::analyze()`, and an associated callback.
+ * 
+ * @return A vector of `ESPRIC_Condition` objects for wakeup analysis.
+ */
+std::vector<ESPRIC::ESPRIC_Condition> getWakeupConditions() {
+    return {
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_UNDEFINED; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_UNDEFINED)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_EXT0; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_EXT0)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_EXT1; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_EXT1)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_TIMER; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_TIMER)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_TOUCHPAD; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_TOUCHPAD)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_ULP; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_ULP)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_GPIO; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_GPIO)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_UART; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_UART)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_WIFI; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_WIFI)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_COCPU; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_COCPU)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_COCPU_TRAP_TRIG; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_COCPU_TRAP_TRIG)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_BT; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_BT)); }}
+    };
+}
+
+/**
+ * @brief Add grouped reset conditions to an analyzer.
+ * 
+ * Each group covers several reset reasons with one mask condition instead of one 
+ * condition per reason, e.g. all watchdog resets. The groups are matched with a single 
+ * AND operation each.
+ * 
+ * @param analyzer The `ESPRIC` instance that receives the grouped conditions.
+ */
+void addResetGroupConditions(ESPRIC& analyzer) {
+    analyzer.addMaskCondition(ESPRIC_RESET_MASK_ANY_CRASH, 0,
+        []() { Serial.println("Firmware crash detected (panic, watchdog or CPU lockup)."); });
+    analyzer.addMaskCondition(ESPRIC_RESET_MASK_ANY_WATCHDOG, 0,
+        []() { Serial.println("Watchdog reset detected."); });
+    analyzer.addMaskCondition(ESPRIC_RESET_MASK_ANY_POWER, 0,
+        []() { Serial.println("Power supply problem detected."); });
+    analyzer.addMaskCondition(espricResetMask(ESP_RST_DEEPSLEEP), ESPRIC_WAKEUP_MASK_ANY_EXTERNAL,
+        []() { Serial.println("Deep sleep ended by an external signal."); });
+}
+
+/**
+ * @brief Get the wakeup conditions as a group gated on a deep-sleep reset.
+ * 
+ * A wakeup cause is only meaningful after `ESP_RST_DEEPSLEEP`. On every other boot the 
+ * analyzer evaluates the gate only and skips all wakeup conditions with one jump.
+ * 
+ * @return A group with the conditions of `getWakeupConditions()`.
+ */
+ESPRIC_ConditionGroup getDeepSleepWakeupGroup() {
+    ESPRIC_ConditionGroup group([](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_DEEPSLEEP; });
+    group.add(getWakeupConditions());
+    return group;
+}
+
+/**
+ * @brief Get the firmware crash resets as a group with a nested watchdog group.
+ * 
+ * The outer gate matches `ESPRIC_RESET_MASK_ANY_CRASH`, the inner gate 
+ * `ESPRIC_RESET_MASK_ANY_WATCHDOG`. Boots without a crash evaluate one gate.
+ * 
+ * @return A group with the panic, watchdog and CPU lockup conditions.
+ */
+ESPRIC_ConditionGroup getCrashGroup() {
+    ESPRIC_ConditionGroup watchdogs([](const ESPRIC::StartupContext& ctx) {
+        return (espricCauseBit(ctx.resetReason) & ESPRIC_RESET_MASK_ANY_WATCHDOG) != 0;
+    });
+    watchdogs
+        .add([](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_INT_WDT; },
+             []() { Serial.println(espricResetReasonMessage(ESP_RST_INT_WDT)); })
+        .add([](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_TASK_WDT; },
+             []() { Serial.println(espricResetReasonMessage(ESP_RST_TASK_WDT)); })
+        .add([](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_WDT; },
+             []() { Serial.println(espricResetReasonMessage(ESP_RST_WDT)); });
+
+    ESPRIC_ConditionGroup crashes([](const ESPRIC::StartupContext& ctx) {
+        return (espricCauseBit(ctx.resetReason) & ESPRIC_RESET_MASK_ANY_CRASH) != 0;
+    });
+    crashes.add([](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_PANIC; },
+                []() { Serial.println(espricResetReasonMessage(ESP_RST_PANIC)); });
+    crashes.add(watchdogs);
+    #ifndef CONFIG_IDF_TARGET_ESP32
+    crashes.add([](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_CPU_LOCKUP; },
+                []() { Serial.println(espricResetReasonMessage(ESP_RST_CPU_LOCKUP)); });
+    #endif
+    return crashes;
+}
+
+#endif // ESPRIC_CONDITIONS_H
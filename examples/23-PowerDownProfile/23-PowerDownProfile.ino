@@ -0,0 +1,52 @@
+/**
+ * @file 23-PowerDownProfile.ino
+ * @brief Demonstrates declarative power-down profiles with `ESPRIC_PowerDown`.
+ *
+ * Instead of one `std::function` per domain that calls `esp_sleep_pd_config()` and logs
+ * (timing/ValidatePowerDownDomainConditions), the sleep configuration is a `constexpr` profile.
+ * `apply()` issues only the domains that differ from the options in effect and returns failures
+ * as a bitmask. The profile and errors of the previous cycle are read from RTC memory after the
+ * wakeup, so nothing is printed between configuring the domains and entering deep sleep.
+ *
+ * @note The device goes to deep sleep for 10 seconds after each boot; every fifth cycle keeps
+ *       the RTC peripherals powered for an EXT0 wakeup on GPIO 4.
+ */
+
+#include <ESPRIC.h>
+#include <ESPRIC_PowerDown.h>
+
+static ESPRIC_PowerDown powerDown; // Keeps the last profile in RTC memory
+
+RTC_DATA_ATTR static uint32_t cycle = 0; // Sleep cycles since power-on
+
+void setup() {
+    // Initialize the serial communication for debugging.
+    Serial.begin(115200);
+    delay(1000);
+
+    Serial.println("\n=== ESPRIC Power-Down Profile ===");
+    if (powerDown.begin() == ESPRIC_PowerDown::StoreState::Valid) {
+        Serial.printf("Previous cycle: profile %u, failed domains 0x%04X\n", (unsigned)powerDown.previousProfile(),
+                      (unsigned)powerDown.previousErrors());
+    }
+
+    ESPRIC analyzer({});
+    analyzer.onWakeupCause(ESP_SLEEP_WAKEUP_EXT0, []() { Serial.println("Woken up by GPIO 4."); });
+    analyzer.analyze();
+
+    cycle++;
+    const bool rtcPeripherals = cycle % 5 == 0;
+    if (rtcPeripherals) {
+        esp_sleep_enable_ext0_wakeup(GPIO_NUM_4, 1);
+    }
+    esp_sleep_enable_timer_wakeup(10ULL * 1000000ULL);
+    Serial.flush();
+
+    // One pass over the changed domains; failures are reported after the next wakeup.
+    powerDown.apply(rtcPeripherals ? ESPRIC_PD_PROFILE_RTC_PERIPH : ESPRIC_PD_PROFILE_DEEP_SLEEP);
+    esp_deep_sleep_start();
+}
+
+void loop() {
+    // Not reached: the device sleeps at the end of setup().
+}
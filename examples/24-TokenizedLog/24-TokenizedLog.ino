@@ -0,0 +1,41 @@
+/**
+ * @file 24-TokenizedLog.ino
+ * @brief Demonstrates deferred, tokenized logging with `ESPRIC_Log`.
+ *
+ * The analyzer and the handlers store message ids and integer arguments in a RAM ring buffer
+ * instead of printing text. Nothing is formatted and nothing waits for the UART until the ring
+ * is drained at the end of `setup()` and after every sensor reading. The drained bytes are
+ * binary frames: capture them, e.g. with `cat /dev/ttyUSB0 > boot.bin`, and expand them on the
+ * host with `tools/LogExpander`, built with `AppLogMessages.h` for the messages of this sketch.
+ */
+
+#include <ESPRIC.h>
+#include <ESPRIC_Log.h>
+#include <esp_timer.h>
+#include "ESPRIC_Conditions.h"
+#include "AppLogMessages.h"
+
+static ESPRIC_Log bootLog; // 512-byte ring, see ESPRIC_LOG_BUFFER_SIZE
+
+void setup() {
+    // Initialize the serial communication; no wait for a monitor, the log is buffered.
+    Serial.begin(115200);
+
+    ESPRIC analyzer({});
+    analyzer.setLog(&bootLog);                // ESPRIC_LOG_BOOT and ESPRIC_LOG_ANALYSIS
+    addLoggedCauseHandlers(analyzer, bootLog); // ESPRIC_LOG_RESET_REASON / _WAKEUP_CAUSE
+    analyzer.addMaskCondition(ESPRIC_RESET_MASK_ANY_CRASH, 0, []() {
+        bootLog.log(APP_LOG_CRASH_RECOVERY, esp_reset_reason());
+    });
+    analyzer.analyze();
+
+    bootLog.log(APP_LOG_SETUP_DONE, esp_timer_get_time());
+    bootLog.drainTo(Serial); // One burst of about 40 bytes instead of several lines of text
+}
+
+void loop() {
+    delay(10000);
+    const int millivolts = analogReadMilliVolts(A0);
+    bootLog.log(APP_LOG_SENSOR, 0, millivolts);
+    bootLog.drainTo(Serial);
+}
@@ -0,0 +1,24 @@
+/**
+ * @file AppLogMessages.h
+ * @brief Tokenized messages of the 24-TokenizedLog sketch.
+ *
+ * Shared by the sketch and the host expander:
+ * `g++ -std=c++17 -O2 -I. -Isrc -DESPRIC_LOG_APP_CATALOG='"examples/24-TokenizedLog/AppLogMessages.h"' tools/LogExpander/LogExpander.cpp` (from the repository root)
+ */
+
+#ifndef APP_LOG_MESSAGES_H
+#define APP_LOG_MESSAGES_H
+
+#include <ESPRIC_LogFormat.h>
+
+/**
+ * @brief Application messages as `X(id, "format")`. Append only: the position is the id.
+ */
+#define ESPRIC_LOG_APP_MESSAGES(X)                       \
+    X(APP_LOG_SETUP_DONE, "app: setup done after %u us")  \
+    X(APP_LOG_CRASH_RECOVERY, "app: recovering from %R")  \
+    X(APP_LOG_SENSOR, "app: sensor %u reads %d mV")
+
+ESPRIC_LOG_APP_IDS();
+
+#endif // APP_LOG_MESSAGES_H
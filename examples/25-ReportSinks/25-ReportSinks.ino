@@ -0,0 +1,60 @@
+/**
+ * @file 25-ReportSinks.ino
+ * @brief Demonstrates batched analysis reports with pluggable sinks.
+ *
+ * The analyzer and the cause handlers add structured events to an `ESPRIC_Report` instead of
+ * printing lines. After all callbacks ran, `analyze()` flushes the batch once: the serial sink
+ * formats it into one block and writes it with a single `Serial.write()`. The same events can
+ * go to a RAM buffer (e.g. for an upload) or be appended to a file on LittleFS by switching
+ * the sink; the conditions do not change.
+ *
+ * There is no `while (!Serial)`: the boot does not wait for a serial monitor.
+ */
+
+#include <ESPRIC.h>
+#include <ESPRIC_Report.h>
+#include <LittleFS.h>
+#include "ESPRIC_Conditions.h"
+
+/**
+ * @brief Transport of the report.
+ */
+enum class Transport { Serial, Buffer, File };
+static constexpr Transport kTransport = Transport::Serial;
+
+static ESPRIC_SerialSink serialSink(Serial);
+static char uploadText[512];
+static ESPRIC_BufferSink bufferSink(uploadText, sizeof(uploadText));
+static ESPRIC_FileSink fileSink(LittleFS, "/espric_report.txt");
+static ESPRIC_Report report(serialSink);
+
+void setup() {
+    // A TX buffer larger than one report lets the bulk write return without waiting for the UART.
+    Serial.setTxBufferSize(1024);
+    Serial.begin(115200);
+
+    if (kTransport == Transport::Buffer) {
+        report.setSink(bufferSink);
+    } else if (kTransport == Transport::File && LittleFS.begin(true)) {
+        report.setSink(fileSink);
+    }
+
+    ESPRIC analyzer({});
+    analyzer.setReport(&report);
+    addReportedCauseHandlers(analyzer, report);
+    analyzer.addMaskCondition(ESPRIC_RESET_MASK_ANY_CRASH, 0, []() {
+        report.note("Crash before this boot, restoring defaults");
+    });
+    analyzer.analyze(); // Boot context, causes, notes and result: one flush
+
+    if (kTransport == Transport::Buffer) {
+        // e.g. http.POST(uploadText), here printed once for the demo
+        Serial.write(uploadText, bufferSink.size());
+    }
+}
+
+void loop() {
+    delay(10000);
+    report.note("Free heap", static_cast<int32_t>(ESP.getFreeHeap()));
+    report.flush();
+}
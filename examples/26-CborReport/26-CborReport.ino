@@ -0,0 +1,53 @@
+/**
+ * @file 26-CborReport.ino
+ * @brief Demonstrates compact CBOR boot reports in a fixed buffer.
+ *
+ * After the analysis, `espricEncodeBootReport()` writes the boot context, the analysis result,
+ * the indices of the conditions that ran, their timings and the persistent boot counters as a
+ * CBOR map of a few dozen bytes into a stack buffer, without strings or heap. The report is
+ * kept in RTC memory, e.g. to be published once Wi-Fi is up, and printed as one hex line that
+ * `tools/CborReportDecoder --hex` turns into JSON.
+ */
+
+#include <ESPRIC.h>
+#include <ESPRIC_Cbor.h>
+
+static ESPRIC_ResetStatistics statistics;
+static ESPRIC_TimingReport timing;
+
+RTC_DATA_ATTR static uint8_t lastReport[ESPRIC_CBOR_REPORT_SIZE]; ///< Survives deep sleep.
+RTC_DATA_ATTR static size_t lastReportSize = 0;
+
+void setup() {
+    Serial.begin(115200);
+    statistics.begin();
+
+    ESPRIC analyzer({
+        {[](const ESPRIC::StartupContext& context) { return context.resetReason == ESP_RST_BROWNOUT; },
+         []() { /* Lower the CPU frequency */ }},
+    });
+    analyzer.setResetStatistics(&statistics);
+    analyzer.addMaskCondition(ESPRIC_RESET_MASK_ANY_CRASH, 0, []() { /* Restore defaults */ });
+    analyzer.onWakeupCause(ESP_SLEEP_WAKEUP_TIMER, []() { /* Take a measurement */ });
+
+    const ESPRIC::StartupContext context = ESPRIC::StartupContext::capture();
+    const ESPRIC::AnalysisResult result = analyzer.analyze(context, timing);
+
+    uint8_t payload[ESPRIC_CBOR_REPORT_SIZE];
+    const size_t size = espricEncodeBootReport(payload, sizeof(payload), context, result, &timing, &statistics);
+    memcpy(lastReport, payload, size);
+    lastReportSize = size;
+    // e.g. mqtt.publish("device/boot", payload, size) once connected
+
+    Serial.printf("CBOR report, %u bytes:\n", static_cast<unsigned>(size));
+    for (size_t i = 0; i < size; i++) {
+        Serial.printf("%02x", payload[i]);
+    }
+    Serial.println();
+}
+
+void loop() {
+    delay(10000);
+    esp_sleep_enable_timer_wakeup(5 * 1000000ULL);
+    esp_deep_sleep_start();
+}
@@ -8,20 +8,175 @@
  */
 
 #include "ESPRIC.h"
+#include "ESPRIC_BootHistory.h"
+#include "ESPRIC_BootLoop.h"
+#include "ESPRIC_ConditionGroup.h"
+#include "ESPRIC_Deferred.h"
+#include "ESPRIC_Log.h"
+#include "ESPRIC_Report.h"
+#include "ESPRIC_ResetStatistics.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+/**
+ * @brief Orders conditions by descending priority.
+ */
+bool higherPriority(const ESPRIC::ESPRIC_Condition& a, const ESPRIC::ESPRIC_Condition& b) {
+    return a.priority > b.priority;
+}
+
+/**
+ * @brief Returns true if the range contains the gate of a condition group.
+ */
+bool containsGate(const ESPRIC::ESPRIC_Condition* first, const ESPRIC::ESPRIC_Condition* last) {
+    return std::any_of(first, last, [](const ESPRIC::ESPRIC_Condition& condition) { return condition.gate; });
+}
+
+/**
+ * @brief Returns the number of entries a group gate covers, limited to the `remaining` entries after it.
+ */
+size_t spanOf(const ESPRIC::ESPRIC_Condition& condition, size_t remaining) {
+    const size_t span = condition.gate ? condition.span : 0;
+    return span < remaining ? span : remaining;
+}
+
+/**
+ * @brief Probe of the plain `analyze()` overloads; compiles to nothing.
+ */
+struct NoProbe {
+    int now() const { return 0; }
+    void predicate(size_t, int) const {}
+    void callback(size_t, int) const {}
+    void handler(int) const {}
+};
+
+/**
+ * @brief Probe of the instrumented `analyze()` overloads; adds durations to a report.
+ */
+struct TimingProbe {
+    ESPRIC_TimingReport& report;
+
+    uint32_t now() const { return espricTimingNow(); }
+
+    void predicate(size_t index, uint32_t start) const {
+        const uint32_t ns = espricTimingElapsedNs(start, espricTimingNow());
+        report.predicates.add(ns);
+        if (index < ESPRIC_TIMING_MAX_ENTRIES) {
+            report.entries[index].predicate.add(ns);
+        }
+    }
+
+    void callback(size_t index, uint32_t start) const {
+        const uint32_t ns = espricTimingElapsedNs(start, espricTimingNow());
+        report.callbacks.add(ns);
+        if (index < ESPRIC_TIMING_MAX_ENTRIES) {
+            report.entries[index].callback.add(ns);
+        }
+    }
+
+    void handler(uint32_t start) const {
+        report.callbacks.add(espricTimingElapsedNs(start, espricTimingNow()));
+    }
+};
+
+/**
+ * @brief Probe of the heap-accounting `analyze()` overloads; adds heap windows to a report.
+ */
+struct HeapProbe {
+    ESPRIC_HeapReport& report;
+
+    ESPRIC_HeapMark now() const { return espricHeapBegin(); }
+
+    void predicate(size_t, const ESPRIC_HeapMark& mark) const {
+        report.predicates.add(mark, espricHeapEnd(mark));
+    }
+
+    void callback(size_t index, const ESPRIC_HeapMark& mark) const {
+        const ESPRIC_HeapCounters end = espricHeapEnd(mark);
+        report.callbacks.add(mark, end);
+        if (index < ESPRIC_HEAP_MAX_ENTRIES) {
+            report.entries[index].add(mark, end);
+        }
+    }
+
+    void handler(const ESPRIC_HeapMark& mark) const {
+        report.callbacks.add(mark, espricHeapEnd(mark));
+    }
+};
+
+/**
+ * @brief Sizes the entry range of a report for an analysis of `conditions` conditions.
+ */
+template <typename Report>
+void prepareEntries(Report& report, size_t conditions, size_t capacity) {
+    const size_t entries = conditions < capacity ? conditions : capacity;
+    if (report.entryCount < entries) {
+        report.entryCount = entries;
+    }
+    report.overflow = conditions - entries;
+}
+
+} // namespace
 
 /**
  * @brief Constructs the ESPRIC with predefined conditions and an optional default callback.
  * 
  * @param conditions A vector of `ESPRIC_Condition` structures to evaluate.
  * @param defaultCallback An optional callback executed if no conditions are met.
+ * @param policy The evaluation policy used by `analyze()`.
  * 
  * This constructor initializes the analyzer with a list of predefined conditions and 
  * optionally sets a default callback to handle cases where no conditions match.
  */
 ESPRIC::ESPRIC(
     const std::vector<ESPRIC_Condition>& conditions,
-    Callback defaultCallback)
-    : conditions_(conditions), defaultCallback_(defaultCallback) {}
+    Callback defaultCallback,
+    EvaluationPolicy policy)
+    : conditions_(conditions), defaultCallback_(std::move(defaultCallback)), policy_(policy) {
+    hasGroups_ = containsGate(conditions_.data(), conditions_.data() + conditions_.size());
+    sortByPriority();
+}
+
+/**
+ * @brief Constructs the ESPRIC by taking ownership of a temporary condition vector.
+ * 
+ * @param conditions A vector of `ESPRIC_Condition` structures, moved into the analyzer.
+ * @param defaultCallback An optional callback executed if no conditions are met.
+ * @param policy The evaluation policy used by `analyze()`.
+ */
+ESPRIC::ESPRIC(
+    std::vector<ESPRIC_Condition>&& conditions,
+    Callback defaultCallback,
+    EvaluationPolicy policy)
+    : conditions_(std::move(conditions)), defaultCallback_(std::move(defaultCallback)), policy_(policy) {
+    hasGroups_ = containsGate(conditions_.data(), conditions_.data() + conditions_.size());
+    sortByPriority();
+}
+
+/**
+ * @brief Constructs a non-owning ESPRIC over a caller-owned range of conditions.
+ * 
+ * @param conditions Pointer to the first condition of the range.
+ * @param count Number of conditions in the range.
+ * @param defaultCallback An optional callback executed if no conditions are met.
+ * @param policy The evaluation policy used by `analyze()`.
+ */
+ESPRIC::ESPRIC(
+    const ESPRIC_Condition* conditions,
+    size_t count,
+    Callback defaultCallback,
+    EvaluationPolicy policy)
+    : view_(conditions), viewSize_(count), defaultCallback_(std::move(defaultCallback)), policy_(policy) {
+    hasGroups_ = containsGate(view_, view_ + viewSize_);
+    if (policy_ == EvaluationPolicy::PriorityOrdered &&
+        (hasGroups_ || !std::is_sorted(view_, view_ + viewSize_, higherPriority))) {
+        detachView(); // An unsorted range cannot be reordered in place, sort a private copy
+        sortByPriority();
+    }
+}
 
 /**
  * @brief Analyzes the defined conditions and executes the corresponding callbacks.
@@ -34,20 +189,240 @@ ESPRIC::ESPRIC(
  * @return AnalysisResult Struct containing counts of matched and unmatched conditions.
  */
 ESPRIC::AnalysisResult ESPRIC::analyze() {
+    return analyze(StartupContext::capture());
+}
+
+/**
+ * @brief Analyzes the defined conditions against a given startup context.
+ * 
+ * @param context The startup state shared by all conditions and dispatch handlers.
+ * @return AnalysisResult Struct containing counts of matched and unmatched conditions.
+ */
+ESPRIC::AnalysisResult ESPRIC::analyze(const StartupContext& context) {
+    NoProbe probe;
+    return analyzeWith(context, probe);
+}
+
+/**
+ * @brief Analyzes the defined conditions and records the duration of every predicate and callback.
+ * 
+ * @param report Timing report that receives the durations.
+ * @return AnalysisResult Struct containing counts of matched and unmatched conditions.
+ */
+ESPRIC::AnalysisResult ESPRIC::analyze(ESPRIC_TimingReport& report) {
+    return analyze(StartupContext::capture(), report);
+}
+
+/**
+ * @brief Analyzes the defined conditions against a given startup context with timing instrumentation.
+ * 
+ * @param context The startup state shared by all conditions and dispatch handlers.
+ * @param report Timing report that receives the durations.
+ * @return AnalysisResult Struct containing counts of matched and unmatched conditions.
+ */
+ESPRIC::AnalysisResult ESPRIC::analyze(const StartupContext& context, ESPRIC_TimingReport& report) {
+    prepareEntries(report, (view_ ? viewSize_ : conditions_.size()) + masks_.size(), ESPRIC_TIMING_MAX_ENTRIES);
+
+    TimingProbe probe{report};
+    const uint32_t start = espricTimingNow();
+    const AnalysisResult result = analyzeWith(context, probe);
+    report.analyses.add(espricTimingElapsedNs(start, espricTimingNow()));
+    return result;
+}
+
+/**
+ * @brief Analyzes the defined conditions and records the heap activity of every phase and callback.
+ * 
+ * @param report Heap report that receives the activity.
+ * @return AnalysisResult Struct containing counts of matched and unmatched conditions.
+ */
+ESPRIC::AnalysisResult ESPRIC::analyze(ESPRIC_HeapReport& report) {
+    return analyze(StartupContext::capture(), report);
+}
+
+/**
+ * @brief Analyzes the defined conditions against a given startup context with heap accounting.
+ * 
+ * @param context The startup state shared by all conditions and dispatch handlers.
+ * @param report Heap report that receives the activity.
+ * @return AnalysisResult Struct containing counts of matched and unmatched conditions.
+ */
+ESPRIC::AnalysisResult ESPRIC::analyze(const StartupContext& context, ESPRIC_HeapReport& report) {
+    prepareEntries(report, (view_ ? viewSize_ : conditions_.size()) + masks_.size(), ESPRIC_HEAP_MAX_ENTRIES);
+
+    HeapProbe probe{report};
+    const ESPRIC_HeapMark mark = espricHeapBegin();
+    const AnalysisResult result = analyzeWith(context, probe);
+    report.analysis.add(mark, espricHeapEnd(mark));
+    return result;
+}
+
+/**
+ * @brief Passes the boot-loop state of the attached detector to the conditions, if any.
+ * 
+ * @param context The startup state shared by all conditions and dispatch handlers.
+ * @param probe Timing or heap hook called around every predicate and callback.
+ * @return AnalysisResult Struct containing counts of matched and unmatched conditions.
+ */
+template <typename Probe>
+ESPRIC::AnalysisResult ESPRIC::analyzeWith(const StartupContext& context, Probe& probe) {
+    if (bootLoopDetector_ != nullptr) {
+        StartupContext updated = context; // The caller's context stays untouched
+        bootLoopDetector_->update(updated);
+        return record(updated, probe);
+    }
+    return record(context, probe);
+}
+
+/**
+ * @brief Records the boot in the statistics store, the boot history, the log and the report, 
+ *        evaluates, then applies the commit policy of the store and the flush policy of the 
+ *        history and flushes the report.
+ * 
+ * @param context The startup state shared by all conditions and dispatch handlers.
+ * @param probe Timing or heap hook called around every predicate and callback.
+ * @return AnalysisResult Struct containing counts of matched and unmatched conditions.
+ */
+template <typename Probe>
+ESPRIC::AnalysisResult ESPRIC::record(const StartupContext& context, Probe& probe) {
+    if (statistics_ == nullptr && bootHistory_ == nullptr && log_ == nullptr && report_ == nullptr) {
+        return evaluate(context, probe);
+    }
+    if (statistics_ != nullptr) {
+        statistics_->record(context);
+    }
+    if (bootHistory_ != nullptr) {
+        bootHistory_->append(context); // Before evaluation, so callbacks see the current boot
+    }
+    if (log_ != nullptr) {
+        log_->log(ESPRIC_LOG_BOOT, context.resetReason, context.wakeupCause, context.uptimeUs);
+        if (bootLoopDetector_ != nullptr) {
+            log_->log(ESPRIC_LOG_BOOT_LOOP, context.bootLoopState, context.recentCrashes);
+        }
+    }
+    if (report_ != nullptr) {
+        report_->boot(context);
+        if (bootLoopDetector_ != nullptr) {
+            report_->bootLoop(context);
+        }
+    }
+    const AnalysisResult result = evaluate(context, probe);
+    if (log_ != nullptr) {
+        log_->log(ESPRIC_LOG_ANALYSIS, result.matched, result.unmatched, result.skipped, result.deferred, result.gated);
+    }
+    if (statistics_ != nullptr) {
+        statistics_->analysisDone(); // Commits once, after callbacks that may have cleared counters
+    }
+    if (bootHistory_ != nullptr) {
+        bootHistory_->flushIfDue();
+    }
+    if (report_ != nullptr) {
+        report_->analysis(result.matched, result.unmatched, result.skipped, result.deferred, result.gated);
+        report_->flush(); // One transport write per analysis
+    }
+    return result;
+}
+
+/**
+ * @brief Evaluates predicates, mask conditions and dispatch handlers in that order.
+ * 
+ * @param context The startup state shared by all conditions and dispatch handlers.
+ * @param probe Timing or heap hook called around every predicate and callback.
+ * @return AnalysisResult Struct containing counts of matched and unmatched conditions.
+ */
+template <typename Probe>
+ESPRIC::AnalysisResult ESPRIC::evaluate(const StartupContext& context, Probe& probe) {
     AnalysisResult result = {0, 0}; ///< Initialize result struct.
+    result.policy = policy_;
+    const bool stopAtFirst = policy_ != EvaluationPolicy::EvaluateAll;
 
-    for (const auto& condition : conditions_) {
-        if (condition.condition()) {  // Check if the condition is true
-            condition.callback();     // Execute the associated callback
+    const ESPRIC_Condition* first = view_ ? view_ : conditions_.data();
+    const ESPRIC_Condition* last = first + (view_ ? viewSize_ : conditions_.size());
+
+    for (const ESPRIC_Condition* condition = first; condition != last; ++condition) {
+        const size_t index = static_cast<size_t>(condition - first);
+        auto start = probe.now();
+        const bool met = condition->condition(context);  // Check if the condition is true
+        probe.predicate(index, start);
+        if (condition->gate) {
+            if (!met) {
+                const size_t span = spanOf(*condition, static_cast<size_t>(last - condition - 1));
+                condition += span;    // Skip the whole subtree with one jump
+                result.gated += span;
+            }
+            continue;                 // Gates are neither matched nor unmatched
+        }
+        if (met) {
+            if (condition->mode == CallbackMode::Deferred && defer(condition->callback)) {
+                result.deferred++;    // Runs later on the deferred worker
+            } else {
+                start = probe.now();
+                condition->callback(); // Execute the associated callback
+                probe.callback(index, start);
+            }
             result.matched++;         // Increment matched count
+            if (stopAtFirst) {
+                result.skipped = static_cast<size_t>(last - condition - 1) + masks_.size() +
+                                 boundHandlers(context, true);
+                return result;        // Mask conditions and dispatch handlers are skipped too
+            }
         } else {
             result.unmatched++;       // Increment unmatched count
         }
     }
 
+    // Match mask conditions with one AND each against the packed state word
+    if (!masks_.empty()) {
+        const size_t offset = static_cast<size_t>(last - first);
+        const uint64_t state = espricPackState(context.resetReason, context.wakeupCause);
+        for (size_t i = 0; i < masks_.size(); ++i) {
+            auto start = probe.now();
+            const bool met = espricMaskMatches(state, masks_[i]);
+            probe.predicate(offset + i, start);
+            if (met) {
+                start = probe.now();
+                maskCallbacks_[i]();
+                probe.callback(offset + i, start);
+                result.matched++;
+                if (stopAtFirst) {
+                    result.skipped = masks_.size() - i - 1 + boundHandlers(context, true);
+                    return result;
+                }
+            } else {
+                result.unmatched++;
+            }
+        }
+    }
+
+    // Dispatch bound handlers: one table lookup per cause kind
+    if (hasResetHandlers_) {
+        const unsigned reason = static_cast<unsigned>(context.resetReason);
+        if (reason < ESPRIC_MAX_RESET_REASONS && resetIndex_[reason] != 0) {
+            const auto start = probe.now();
+            handlers_[resetIndex_[reason] - 1]();
+            probe.handler(start);
+            result.matched++;
+            if (stopAtFirst) {
+                result.skipped = boundHandlers(context, false);
+                return result;
+            }
+        }
+    }
+    if (hasWakeupHandlers_) {
+        const unsigned cause = static_cast<unsigned>(context.wakeupCause);
+        if (cause < ESPRIC_MAX_WAKEUP_CAUSES && wakeupIndex_[cause] != 0) {
+            const auto start = probe.now();
+            handlers_[wakeupIndex_[cause] - 1]();
+            probe.handler(start);
+            result.matched++;
+        }
+    }
+
     // Execute the default callback if no conditions matched and it is defined
     if (result.matched == 0 && defaultCallback_) {
+        const auto start = probe.now();
         defaultCallback_();
+        probe.handler(start);
     }
 
     return result; ///< Return the analysis result.
@@ -58,10 +433,236 @@ ESPRIC::AnalysisResult ESPRIC::analyze() {
  * 
  * @param condition A condition function that evaluates to true or false.
  * @param callback A callback function to execute if the condition is true.
+ * @param priority Evaluation priority, higher values are evaluated first.
+ * @param mode Where the callback runs.
  * 
  * This method allows developers to add new conditions and their callbacks dynamically. 
  * The added conditions are evaluated during the next call to `analyze`.
  */
-void ESPRIC::addCondition(const Condition& condition, const Callback& callback) {
-    conditions_.push_back({condition, callback}); ///< Add the new condition and callback to the list.
+void ESPRIC::addCondition(const Condition& condition, const Callback& callback, int priority, CallbackMode mode) {
+    insertCondition({condition, callback, priority, mode}); ///< Add the new condition and callback to the list.
+}
+
+/**
+ * @brief Adds a new condition by moving the condition and callback into the analyzer.
+ * 
+ * @param condition A condition function that evaluates to true or false.
+ * @param callback A callback function to execute if the condition is true.
+ * @param priority Evaluation priority, higher values are evaluated first.
+ * @param mode Where the callback runs.
+ */
+void ESPRIC::addCondition(Condition&& condition, Callback&& callback, int priority, CallbackMode mode) {
+    insertCondition({std::move(condition), std::move(callback), priority, mode});
+}
+
+/**
+ * @brief Adds a condition that matches sets of reset reasons and wakeup causes.
+ * 
+ * @param resetMask Accepted reset reasons, 0 for any.
+ * @param wakeupMask Accepted wakeup causes, 0 for any.
+ * @param callback A callback function to execute if both masks match.
+ */
+void ESPRIC::addMaskCondition(uint32_t resetMask, uint32_t wakeupMask, const Callback& callback) {
+    masks_.push_back(espricPackMask(resetMask, wakeupMask));
+    maskCallbacks_.push_back(callback);
+}
+
+/**
+ * @brief Reserves storage for a total of `count` conditions.
+ * 
+ * @param count The expected number of conditions.
+ */
+void ESPRIC::reserve(size_t count) {
+    conditions_.reserve(count);
+}
+
+/**
+ * @brief Stores a condition, keeping priority order under `EvaluationPolicy::PriorityOrdered`.
+ * 
+ * Equal priorities are inserted after the existing ones, so registration order breaks ties.
+ * 
+ * @param condition The condition to store.
+ * @return A reference to the stored condition.
+ */
+ESPRIC::ESPRIC_Condition& ESPRIC::insertCondition(ESPRIC_Condition&& condition) {
+    detachView();
+    if (policy_ != EvaluationPolicy::PriorityOrdered) {
+        conditions_.push_back(std::move(condition));
+        return conditions_.back();
+    }
+    if (!hasGroups_) {
+        auto position = std::upper_bound(conditions_.begin(), conditions_.end(), condition, higherPriority);
+        return *conditions_.insert(position, std::move(condition));
+    }
+    // Insert before the first top-level entry of lower priority; groups move as a whole
+    size_t position = 0;
+    while (position < conditions_.size() && conditions_[position].priority >= condition.priority) {
+        position += 1 + spanOf(conditions_[position], conditions_.size() - position - 1);
+    }
+    return *conditions_.insert(conditions_.begin() + static_cast<std::ptrdiff_t>(position), std::move(condition));
+}
+
+/**
+ * @brief Adds a group of conditions behind a gate predicate.
+ * 
+ * @param group The gate and its members.
+ * 
+ * The flattened entries of the group are appended in pre-order; under 
+ * `EvaluationPolicy::PriorityOrdered` the conditions are sorted again, group by group.
+ */
+void ESPRIC::addGroup(const ESPRIC_ConditionGroup& group) {
+    detachView();
+    conditions_.insert(conditions_.end(), group.entries().begin(), group.entries().end());
+    hasGroups_ = true;
+    sortByPriority();
+}
+
+/**
+ * @brief Sorts owned conditions by descending priority for `EvaluationPolicy::PriorityOrdered`.
+ * 
+ * The sort is stable, so registration order breaks ties. Other policies keep the given order.
+ */
+void ESPRIC::sortByPriority() {
+    if (policy_ != EvaluationPolicy::PriorityOrdered) {
+        return;
+    }
+    if (hasGroups_) {
+        sortGroupRange(0, conditions_.size());
+    } else {
+        std::stable_sort(conditions_.begin(), conditions_.end(), higherPriority);
+    }
+}
+
+/**
+ * @brief Stable-sorts sibling entries by descending priority, keeping each group in one block.
+ * 
+ * A group moves with its gate and is sorted recursively afterwards, so a member never leaves 
+ * its group.
+ * 
+ * @param begin First entry of the sibling range.
+ * @param end One past the last entry of the sibling range.
+ */
+void ESPRIC::sortGroupRange(size_t begin, size_t end) {
+    struct Block {
+        size_t first;  ///< Index of the gate or plain condition.
+        size_t length; ///< Entries in the block, the gate included.
+    };
+    std::vector<Block> blocks;
+    for (size_t i = begin; i < end; i += blocks.back().length) {
+        blocks.push_back({i, 1 + spanOf(conditions_[i], end - i - 1)});
+    }
+    const auto higher = [this](const Block& a, const Block& b) {
+        return higherPriority(conditions_[a.first], conditions_[b.first]);
+    };
+    if (!std::is_sorted(blocks.begin(), blocks.end(), higher)) {
+        std::stable_sort(blocks.begin(), blocks.end(), higher);
+        std::vector<ESPRIC_Condition> ordered;
+        ordered.reserve(end - begin);
+        for (Block& block : blocks) {
+            const auto from = conditions_.begin() + static_cast<std::ptrdiff_t>(block.first);
+            std::move(from, from + static_cast<std::ptrdiff_t>(block.length), std::back_inserter(ordered));
+        }
+        std::move(ordered.begin(), ordered.end(), conditions_.begin() + static_cast<std::ptrdiff_t>(begin));
+    }
+    for (size_t i = begin; i < end; ) {
+        const size_t span = spanOf(conditions_[i], end - i - 1);
+        if (span > 1) {
+            sortGroupRange(i + 1, i + 1 + span);
+        }
+        i += 1 + span;
+    }
+}
+
+/**
+ * @brief Counts the handlers an early exit leaves out, for `AnalysisResult::skipped`.
+ *
+ * @param context The startup state whose reason and cause are looked up.
+ * @param withReset `true` includes the reset reason handler.
+ * @return The number of bound handlers, 0 to 2.
+ */
+size_t ESPRIC::boundHandlers(const StartupContext& context, bool withReset) const {
+    size_t bound = 0;
+    const unsigned reason = static_cast<unsigned>(context.resetReason);
+    if (withReset && hasResetHandlers_ && reason < ESPRIC_MAX_RESET_REASONS && resetIndex_[reason] != 0) {
+        bound++;
+    }
+    const unsigned cause = static_cast<unsigned>(context.wakeupCause);
+    if (hasWakeupHandlers_ && cause < ESPRIC_MAX_WAKEUP_CAUSES && wakeupIndex_[cause] != 0) {
+        bound++;
+    }
+    return bound;
+}
+
+/**
+ * @brief Queues a deferred callback on the worker.
+ * 
+ * @param callback The callback to queue.
+ * @return `true` if queued, `false` if no worker is set or its queue is full.
+ */
+bool ESPRIC::defer(const Callback& callback) {
+    return deferredWorker_ != nullptr && deferredWorker_->post(callback);
+}
+
+/**
+ * @brief Switches a non-owning analyzer to owned storage.
+ * 
+ * Copies the caller-owned range once; owning analyzers are left untouched.
+ */
+void ESPRIC::detachView() {
+    if (view_ == nullptr) {
+        return;
+    }
+    conditions_.reserve(viewSize_ + 1);
+    conditions_.assign(view_, view_ + viewSize_);
+    view_ = nullptr;
+    viewSize_ = 0;
+}
+
+/**
+ * @brief Binds a handler to a reset reason for table-based dispatch.
+ * 
+ * @param reason The reset reason that selects the handler.
+ * @param callback The handler to execute for this reason.
+ * @return `true` on success, `false` if the reason is outside the dispatch table.
+ */
+bool ESPRIC::onResetReason(esp_reset_reason_t reason, const Callback& callback) {
+    const unsigned index = static_cast<unsigned>(reason);
+    if (index >= ESPRIC_MAX_RESET_REASONS) {
+        return false;
+    }
+    bindHandler(resetIndex_[index], callback);
+    hasResetHandlers_ = true;
+    return true;
+}
+
+/**
+ * @brief Binds a handler to a wakeup cause for table-based dispatch.
+ * 
+ * @param cause The wakeup cause that selects the handler.
+ * @param callback The handler to execute for this cause.
+ * @return `true` on success, `false` if the cause is outside the dispatch table.
+ */
+bool ESPRIC::onWakeupCause(esp_sleep_wakeup_cause_t cause, const Callback& callback) {
+    const unsigned index = static_cast<unsigned>(cause);
+    if (index >= ESPRIC_MAX_WAKEUP_CAUSES) {
+        return false;
+    }
+    bindHandler(wakeupIndex_[index], callback);
+    hasWakeupHandlers_ = true;
+    return true;
+}
+
+/**
+ * @brief Stores a dispatch handler, reusing the slot if the key is already bound.
+ * 
+ * @param slot Index table entry of the reason or cause, 0 if unbound.
+ * @param callback The handler to store.
+ */
+void ESPRIC::bindHandler(uint8_t& slot, const Callback& callback) {
+    if (slot != 0) {
+        handlers_[slot - 1] = callback; // Rebinding replaces the previous handler
+        return;
+    }
+    handlers_.push_back(callback);
+    slot = static_cast<uint8_t>(handlers_.size());
 }
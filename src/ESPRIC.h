@@ -10,10 +10,47 @@
 #ifndef ESPRIC_H
 #define ESPRIC_H
 
-#ifdef ESP32
+#if defined(ESP32) || defined(ESPRIC_HOST)
 
-#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+#include <utility>
 #include <vector>
+#include <esp_system.h>
+#include <esp_sleep.h>
+#include "ESPRIC_CauseMask.h"
+#include "ESPRIC_HeapUsage.h"
+#include "ESPRIC_InplaceFunction.h"
+#include "ESPRIC_StartupContext.h"
+#include "ESPRIC_Timing.h"
+
+class ESPRIC_BootHistory;
+class ESPRIC_BootLoopDetector;
+class ESPRIC_ConditionGroup;
+class ESPRIC_DeferredWorker;
+class ESPRIC_Log;
+class ESPRIC_Report;
+class ESPRIC_ResetStatistics;
+
+/**
+ * @brief Capacity of the reset reason dispatch table.
+ *
+ * Every `esp_reset_reason_t` value below this limit can be bound to a handler with
+ * `ESPRIC::onResetReason()`. The default covers all reasons known to ESP-IDF 5.x.
+ */
+#ifndef ESPRIC_MAX_RESET_REASONS
+#define ESPRIC_MAX_RESET_REASONS 32
+#endif
+
+/**
+ * @brief Capacity of the wakeup cause dispatch table.
+ *
+ * Every `esp_sleep_wakeup_cause_t` value below this limit can be bound to a handler with
+ * `ESPRIC::onWakeupCause()`.
+ */
+#ifndef ESPRIC_MAX_WAKEUP_CAUSES
+#define ESPRIC_MAX_WAKEUP_CAUSES 32
+#endif
 
 /**
  * @class ESPRIC
@@ -25,21 +62,47 @@
  */
 class ESPRIC {
 public:
+    /**
+     * @brief Type alias for the startup snapshot passed to conditions.
+     */
+    using StartupContext = ESPRIC_StartupContext;
+
     /**
      * @brief Type alias for condition logic.
      * 
      * The `Condition` type represents a boolean function that evaluates whether a specific 
-     * startup condition is met.
+     * startup condition is met. It is evaluated against the `StartupContext` captured once by 
+     * `analyze()`. Zero-argument callables that query the hardware themselves are accepted as 
+     * well and are invoked without the context.
+     * 
+     * Conditions are stored inline in an `ESPRIC_InplaceFunction` and never allocate. A 
+     * callable whose captures exceed `ESPRIC_INPLACE_FUNCTION_CAPACITY` fails to compile.
      */
-    using Condition = std::function<bool()>;
+    using Condition = ESPRIC_InplaceFunction<bool(const StartupContext&)>;
+
+    /**
+     * @brief Type alias for context-aware condition logic.
+     * 
+     * Same type as `Condition`; kept as the explicit name for context-aware conditions.
+     */
+    using ContextCondition = Condition;
 
     /**
      * @brief Type alias for callback logic.
      * 
      * The `Callback` type represents a function that executes the desired logic when a 
-     * condition is met.
+     * condition is met. Like `Condition`, it is stored inline and never allocates.
+     */
+    using Callback = ESPRIC_InplaceFunction<void()>;
+
+    /**
+     * @enum CallbackMode
+     * @brief Selects where the callback of a matched condition runs.
      */
-    using Callback = std::function<void()>;
+    enum class CallbackMode : uint8_t {
+        Immediate,  ///< Run inside `analyze()` (default); use for safety-critical reactions.
+        Deferred    ///< Queue on the worker set with `setDeferredWorker()`, e.g. logging and statistics.
+    };
 
     /**
      * @struct ESPRIC_Condition
@@ -51,6 +114,20 @@ public:
     struct ESPRIC_Condition {
         Condition condition;  ///< The condition to evaluate.
         Callback callback;    ///< The callback to execute if the condition is true.
+        int priority = 0;     ///< Evaluation priority for `EvaluationPolicy::PriorityOrdered` (higher first).
+        CallbackMode mode = CallbackMode::Immediate; ///< Where the callback runs.
+        bool gate = false;    ///< True for the gate of a condition group (see `ESPRIC_ConditionGroup`).
+        uint16_t span = 0;    ///< Gate only: number of following entries in the group, nested groups included.
+    };
+
+    /**
+     * @enum EvaluationPolicy
+     * @brief Selects how `analyze()` walks the conditions.
+     */
+    enum class EvaluationPolicy : uint8_t {
+        EvaluateAll,     ///< Evaluate every condition and run every matching callback (default).
+        FirstMatch,      ///< Evaluate in insertion order and stop after the first match.
+        PriorityOrdered  ///< Evaluate in descending priority order and stop after the first match.
     };
 
     /**
@@ -58,11 +135,17 @@ public:
      * @brief Represents the result of analyzing conditions.
      * 
      * This structure contains the number of matched and unmatched conditions, allowing the 
-     * caller to understand the outcome of the analysis.
+     * caller to understand the outcome of the analysis. With an early-exit policy, conditions, 
+     * mask conditions and bound dispatch handlers of the context after the first match are 
+     * counted as skipped.
      */
     struct AnalysisResult {
         size_t matched;    ///< Number of conditions that were met.
         size_t unmatched;  ///< Number of conditions that were not met.
+        size_t skipped = 0;                                       ///< Conditions and handlers not evaluated due to an early exit.
+        EvaluationPolicy policy = EvaluationPolicy::EvaluateAll;  ///< Policy used for the analysis.
+        size_t deferred = 0;                                      ///< Matched conditions whose callback was queued.
+        size_t gated = 0;                                         ///< Entries skipped because a group gate failed, nested gates included.
     };
 
     /**
@@ -70,24 +153,115 @@ public:
      * 
      * @param conditions A vector of predefined `ESPRIC_Condition` structures to evaluate.
      * @param defaultCallback (Optional) A default callback to execute if no conditions are met.
+     * @param policy (Optional) The evaluation policy, `EvaluationPolicy::EvaluateAll` by default.
      * 
      * The constructor initializes the analyzer with a set of predefined conditions 
      * and an optional default callback. If no conditions are met during analysis, the 
-     * default callback is executed.
+     * default callback is executed. With `EvaluationPolicy::PriorityOrdered` the conditions 
+     * are sorted by priority once here (stable, so equal priorities keep their order).
+     */
+    ESPRIC(const std::vector<ESPRIC_Condition>& conditions, Callback defaultCallback = nullptr,
+           EvaluationPolicy policy = EvaluationPolicy::EvaluateAll);
+
+    /**
+     * @brief Constructor that takes ownership of a temporary condition vector.
+     * 
+     * @param conditions A vector of `ESPRIC_Condition` structures, moved into the analyzer.
+     * @param defaultCallback (Optional) A default callback to execute if no conditions are met.
+     * @param policy (Optional) The evaluation policy, `EvaluationPolicy::EvaluateAll` by default.
+     * 
+     * Selected for temporaries such as the result of `getResetConditions()`; the conditions 
+     * are not copied.
+     */
+    ESPRIC(std::vector<ESPRIC_Condition>&& conditions, Callback defaultCallback = nullptr,
+           EvaluationPolicy policy = EvaluationPolicy::EvaluateAll);
+
+    /**
+     * @brief Constructor for a non-owning analyzer over a caller-owned range.
+     * 
+     * @param conditions Pointer to the first of `count` contiguous conditions.
+     * @param count Number of conditions in the range.
+     * @param defaultCallback (Optional) A default callback to execute if no conditions are met.
+     * @param policy (Optional) The evaluation policy, `EvaluationPolicy::EvaluateAll` by default.
+     * 
+     * The range is analyzed in place and must outlive the analyzer, e.g. a `static` array. 
+     * Adding a condition later copies the range into owned storage first. With 
+     * `EvaluationPolicy::PriorityOrdered` a range that is not already sorted by descending 
+     * priority is copied and sorted.
      */
-    ESPRIC(const std::vector<ESPRIC_Condition>& conditions, Callback defaultCallback = nullptr);
+    ESPRIC(const ESPRIC_Condition* conditions, size_t count, Callback defaultCallback = nullptr,
+           EvaluationPolicy policy = EvaluationPolicy::EvaluateAll);
 
     /**
      * @brief Analyzes the conditions and executes the corresponding callbacks.
      * 
      * This method evaluates all defined conditions in order and executes the associated 
-     * callback for each condition that evaluates to true. If no conditions are met 
-     * and a default callback is defined, the default callback is executed.
+     * callback for each condition that evaluates to true. With `EvaluationPolicy::FirstMatch` 
+     * or `EvaluationPolicy::PriorityOrdered` the analysis stops after the first match, 
+     * including mask conditions and dispatch handlers. Mask conditions are matched next. 
+     * Handlers bound with 
+     * `onResetReason()` or `onWakeupCause()` are dispatched afterwards by a single table 
+     * lookup and count as matched conditions. If no conditions are met and a default 
+     * callback is defined, the default callback is executed.
+     * 
+     * The startup state is captured once with `StartupContext::capture()` and shared by all 
+     * conditions and dispatch handlers.
      * 
      * @return An `AnalysisResult` structure containing the counts of matched and unmatched conditions.
      */
     AnalysisResult analyze();
 
+    /**
+     * @brief Analyzes the conditions against a given startup context.
+     * 
+     * @param context The startup state to evaluate, e.g. a recorded context on a host.
+     * @return An `AnalysisResult` structure containing the counts of matched and unmatched conditions.
+     * 
+     * Context-aware conditions and dispatch handlers only see `context`. Zero-argument 
+     * conditions still query the hardware themselves.
+     */
+    AnalysisResult analyze(const StartupContext& context);
+
+    /**
+     * @brief Analyzes the conditions and records the duration of every predicate and callback.
+     * 
+     * @param report Timing report that receives the durations; it accumulates over calls.
+     * @return An `AnalysisResult` structure containing the counts of matched and unmatched conditions.
+     * 
+     * Behaves like `analyze()`. The plain `analyze()` overloads are not instrumented and pay 
+     * nothing for this mode.
+     */
+    AnalysisResult analyze(ESPRIC_TimingReport& report);
+
+    /**
+     * @brief Analyzes the conditions against a given startup context with timing instrumentation.
+     * 
+     * @param context The startup state to evaluate.
+     * @param report Timing report that receives the durations; it accumulates over calls.
+     * @return An `AnalysisResult` structure containing the counts of matched and unmatched conditions.
+     */
+    AnalysisResult analyze(const StartupContext& context, ESPRIC_TimingReport& report);
+
+    /**
+     * @brief Analyzes the conditions and records the heap activity of every phase and callback.
+     * 
+     * @param report Heap report that receives allocations, bytes and peak usage; it accumulates over calls.
+     * @return An `AnalysisResult` structure containing the counts of matched and unmatched conditions.
+     * 
+     * Behaves like `analyze()`. Measure the construction of the analyzer into 
+     * `report.construction` with an `ESPRIC_HeapScope`.
+     */
+    AnalysisResult analyze(ESPRIC_HeapReport& report);
+
+    /**
+     * @brief Analyzes the conditions against a given startup context with heap accounting.
+     * 
+     * @param context The startup state to evaluate.
+     * @param report Heap report that receives allocations, bytes and peak usage; it accumulates over calls.
+     * @return An `AnalysisResult` structure containing the counts of matched and unmatched conditions.
+     */
+    AnalysisResult analyze(const StartupContext& context, ESPRIC_HeapReport& report);
+
     /**
      * @brief Adds a new condition and its callback dynamically during runtime.
      * 
@@ -95,13 +269,257 @@ public:
      * @param callback The callback to execute if the condition is true.
      * 
      * This method allows the dynamic addition of new conditions and their callbacks, 
-     * enabling flexibility in defining startup analysis logic.
+     * enabling flexibility in defining startup analysis logic. With 
+     * `EvaluationPolicy::PriorityOrdered` the condition is inserted at its priority position.
+     * 
+     * @param priority (Optional) Evaluation priority, higher values are evaluated first.
+     * @param mode (Optional) Where the callback runs, `CallbackMode::Immediate` by default.
+     */
+    void addCondition(const Condition& condition, const Callback& callback, int priority = 0,
+                      CallbackMode mode = CallbackMode::Immediate);
+
+    /**
+     * @brief Adds a new condition by moving the condition and callback into the analyzer.
+     * 
+     * @param condition The condition logic to evaluate.
+     * @param callback The callback to execute if the condition is true.
+     * @param priority (Optional) Evaluation priority, higher values are evaluated first.
+     * @param mode (Optional) Where the callback runs, `CallbackMode::Immediate` by default.
+     */
+    void addCondition(Condition&& condition, Callback&& callback, int priority = 0,
+                      CallbackMode mode = CallbackMode::Immediate);
+
+    /**
+     * @brief Constructs a new condition directly from the given callables.
+     * 
+     * @param condition A callable accepted by `Condition`.
+     * @param callback A callable accepted by `Callback`.
+     * @param priority (Optional) Evaluation priority, higher values are evaluated first.
+     * @param mode (Optional) Where the callback runs, `CallbackMode::Immediate` by default.
+     * @return A reference to the stored condition, valid until the next insertion.
+     * 
+     * The callables are stored without an intermediate `Condition` or `Callback` object.
+     */
+    template <typename ConditionFn, typename CallbackFn>
+    ESPRIC_Condition& emplaceCondition(ConditionFn&& condition, CallbackFn&& callback, int priority = 0,
+                                       CallbackMode mode = CallbackMode::Immediate) {
+        return insertCondition({Condition(std::forward<ConditionFn>(condition)),
+                                Callback(std::forward<CallbackFn>(callback)), priority, mode});
+    }
+
+    /**
+     * @brief Adds a group of conditions behind a gate predicate.
+     * 
+     * @param group The gate and its members, nested groups included; copied into the analyzer.
+     * 
+     * `analyze()` evaluates the gate first. If it fails, the whole group is skipped with a 
+     * single jump and counted in `AnalysisResult::gated`; gates count neither as matched nor as 
+     * unmatched. With `EvaluationPolicy::PriorityOrdered` the priority of the gate orders the 
+     * group among its siblings and members are ordered within their group.
      */
-    void addCondition(const Condition& condition, const Callback& callback);
+    void addGroup(const ESPRIC_ConditionGroup& group);
+
+    /**
+     * @brief Returns the evaluation policy selected at construction.
+     */
+    EvaluationPolicy policy() const { return policy_; }
+
+    /**
+     * @brief Sets the worker that runs callbacks of `CallbackMode::Deferred` conditions.
+     * 
+     * @param worker A started worker that outlives the analysis, or `nullptr` to run all 
+     *        callbacks immediately (default).
+     * 
+     * Deferred callbacks are copied into the worker queue. If no worker is set or the queue is 
+     * full, the callback runs immediately, so no reaction is lost.
+     */
+    void setDeferredWorker(ESPRIC_DeferredWorker* worker) { deferredWorker_ = worker; }
+
+    /**
+     * @brief Attaches a statistics store that counts every analyzed boot.
+     * 
+     * @param statistics A store loaded with `begin()` that outlives the analysis, or `nullptr`.
+     * 
+     * `analyze()` records the reset reason and wakeup cause in RAM before the conditions are 
+     * evaluated and applies the commit policy of the store after all callbacks ran.
+     */
+    void setResetStatistics(ESPRIC_ResetStatistics* statistics) { statistics_ = statistics; }
+
+    /**
+     * @brief Attaches a boot history in RTC memory that receives every analyzed boot.
+     * 
+     * @param history A history validated with `begin()` that outlives the analysis, or `nullptr`.
+     * 
+     * `analyze()` appends the boot before the conditions are evaluated, so callbacks can inspect 
+     * it, and calls `flushIfDue()` after all callbacks ran.
+     */
+    void setBootHistory(ESPRIC_BootHistory* history) { bootHistory_ = history; }
+
+    /**
+     * @brief Attaches a boot-loop detector whose state is passed to the conditions.
+     * 
+     * @param detector A detector that outlives the analysis, or `nullptr`.
+     * 
+     * `analyze()` updates the detector before the conditions are evaluated and passes a copy of 
+     * the context with `bootLoopState` and `recentCrashes` set. If the detector was already 
+     * updated early in `setup()`, the result of that update is used.
+     */
+    void setBootLoopDetector(ESPRIC_BootLoopDetector* detector) { bootLoopDetector_ = detector; }
+
+    /**
+     * @brief Attaches a tokenized log that receives the boot context and the analysis result.
+     * 
+     * @param log A log that outlives the analysis, or `nullptr`.
+     * 
+     * `analyze()` logs `ESPRIC_LOG_BOOT` (and `ESPRIC_LOG_BOOT_LOOP` with a detector attached) 
+     * before the conditions are evaluated and `ESPRIC_LOG_ANALYSIS` afterwards. Only ids and 
+     * integers are stored; nothing is formatted or written to the UART.
+     */
+    void setLog(ESPRIC_Log* log) { log_ = log; }
+
+    /**
+     * @brief Attaches a report that collects the boot context and the analysis result.
+     * 
+     * @param report A report with a sink that outlives the analysis, or `nullptr`.
+     * 
+     * `analyze()` adds the boot context before the conditions are evaluated, so callbacks add 
+     * their events after it, then the analysis result, and flushes the report to its sink 
+     * once after all callbacks ran.
+     */
+    void setReport(ESPRIC_Report* report) { report_ = report; }
+
+    /**
+     * @brief Adds a condition that matches a set of reset reasons and wakeup causes.
+     * 
+     * @param resetMask Accepted reset reasons as a cause mask, 0 for any reason.
+     * @param wakeupMask Accepted wakeup causes as a cause mask, 0 for any cause.
+     * @param callback The callback to execute if both the reset reason and the wakeup cause 
+     *                 are in their masks.
+     * 
+     * Masks are built with `espricResetMask()` / `espricWakeupMask()` or taken from the 
+     * predefined groups such as `ESPRIC_RESET_MASK_ANY_WATCHDOG`. `analyze()` matches every 
+     * mask condition with one AND against a packed state word, without calling a predicate.
+     */
+    void addMaskCondition(uint32_t resetMask, uint32_t wakeupMask, const Callback& callback);
+
+    /**
+     * @brief Reserves storage for a total of `count` conditions.
+     * 
+     * @param count The expected number of conditions.
+     * 
+     * Avoids reallocations when conditions are added one by one.
+     */
+    void reserve(size_t count);
+
+    /**
+     * @brief Binds a handler directly to a reset reason.
+     *
+     * @param reason The reset reason that triggers the handler.
+     * @param callback The callback to execute if `esp_reset_reason()` reports `reason`.
+     * @return `true` if the handler was registered, `false` if `reason` exceeds
+     *         `ESPRIC_MAX_RESET_REASONS`.
+     *
+     * Dispatch handlers are not evaluated as predicates. `analyze()` reads the reset reason
+     * once and calls the bound handler through a table lookup, so the cost does not grow with
+     * the number of registered reasons. Registering a reason twice replaces the handler.
+     */
+    bool onResetReason(esp_reset_reason_t reason, const Callback& callback);
+
+    /**
+     * @brief Binds a handler directly to a wakeup cause.
+     *
+     * @param cause The wakeup cause that triggers the handler.
+     * @param callback The callback to execute if `esp_sleep_get_wakeup_cause()` reports `cause`.
+     * @return `true` if the handler was registered, `false` if `cause` exceeds
+     *         `ESPRIC_MAX_WAKEUP_CAUSES`.
+     *
+     * Works like `onResetReason()` for the wakeup cause.
+     */
+    bool onWakeupCause(esp_sleep_wakeup_cause_t cause, const Callback& callback);
 
 private:
+    /**
+     * @brief Shared implementation of all `analyze()` overloads.
+     * 
+     * @tparam Probe Timing or heap hook around every predicate and callback; a no-op for the plain overloads.
+     */
+    template <typename Probe>
+    AnalysisResult analyzeWith(const StartupContext& context, Probe& probe);
+
+    /**
+     * @brief Updates statistics, boot history, log and report around `evaluate()` for `analyzeWith()`.
+     */
+    template <typename Probe>
+    AnalysisResult record(const StartupContext& context, Probe& probe);
+
+    /**
+     * @brief Evaluates predicates, mask conditions and dispatch handlers for `analyzeWith()`.
+     */
+    template <typename Probe>
+    AnalysisResult evaluate(const StartupContext& context, Probe& probe);
+
+    /**
+     * @brief Counts the dispatch handlers bound to the reset reason and wakeup cause of `context`.
+     *
+     * @param withReset `false` counts the wakeup cause handler only, after the reset handler ran.
+     */
+    size_t boundHandlers(const StartupContext& context, bool withReset) const;
+
+    /**
+     * @brief Queues a deferred callback; returns `false` if it has to run immediately.
+     */
+    bool defer(const Callback& callback);
+
+    /**
+     * @brief Copies a caller-owned range into owned storage before it is modified.
+     */
+    void detachView();
+
+    /**
+     * @brief Stores a condition, keeping priority order under `EvaluationPolicy::PriorityOrdered`.
+     * 
+     * @return A reference to the stored condition.
+     */
+    ESPRIC_Condition& insertCondition(ESPRIC_Condition&& condition);
+
+    /**
+     * @brief Sorts owned conditions by descending priority for `EvaluationPolicy::PriorityOrdered`.
+     */
+    void sortByPriority();
+
+    /**
+     * @brief Stable-sorts the sibling entries in `[begin, end)` and, recursively, every group in it.
+     */
+    void sortGroupRange(size_t begin, size_t end);
+
+    /**
+     * @brief Stores a dispatch handler and records its position in an index table.
+     *
+     * @param slot The index table entry of the reason or cause (0 = unbound).
+     * @param callback The handler to store.
+     */
+    void bindHandler(uint8_t& slot, const Callback& callback);
+
     std::vector<ESPRIC_Condition> conditions_; ///< List of all defined startup conditions.
+    const ESPRIC_Condition* view_ = nullptr;  ///< Caller-owned conditions in non-owning mode.
+    size_t viewSize_ = 0;                     ///< Number of conditions in `view_`.
+    std::vector<uint64_t> masks_;             ///< Packed masks of the mask conditions (see `espricPackMask()`).
+    std::vector<Callback> maskCallbacks_;     ///< Callbacks of the mask conditions, parallel to `masks_`.
     Callback defaultCallback_;                ///< Optional default callback if no conditions are met.
+    EvaluationPolicy policy_;                 ///< How `analyze()` walks the conditions.
+    ESPRIC_DeferredWorker* deferredWorker_ = nullptr; ///< Worker for deferred callbacks, if any.
+    ESPRIC_ResetStatistics* statistics_ = nullptr;    ///< Boot counter store, if any.
+    ESPRIC_BootHistory* bootHistory_ = nullptr;       ///< RTC boot history, if any.
+    ESPRIC_BootLoopDetector* bootLoopDetector_ = nullptr; ///< Boot-loop detector, if any.
+    ESPRIC_Log* log_ = nullptr;                       ///< Tokenized log, if any.
+    ESPRIC_Report* report_ = nullptr;                 ///< Batched report, if any.
+
+    std::vector<Callback> handlers_;                       ///< Handlers bound by reason or cause.
+    uint8_t resetIndex_[ESPRIC_MAX_RESET_REASONS] = {};    ///< 1-based index into `handlers_` per reset reason.
+    uint8_t wakeupIndex_[ESPRIC_MAX_WAKEUP_CAUSES] = {};   ///< 1-based index into `handlers_` per wakeup cause.
+    bool hasResetHandlers_ = false;                        ///< True once a reset reason handler is bound.
+    bool hasWakeupHandlers_ = false;                       ///< True once a wakeup cause handler is bound.
+    bool hasGroups_ = false;                               ///< True once a group gate is stored.
 };
 
 #else
@@ -112,6 +530,6 @@ Please use this library with ESP32-compatible devices only."
 
 #error "For generic ANY Reboot Investigation and Context Integrity Check see for the ANYRIC project on github"
 
-#endif // ESP32
+#endif // ESP32 || ESPRIC_HOST
 
 #endif // ESPRIC_H
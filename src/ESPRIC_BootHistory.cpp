@@ -0,0 +1,114 @@
+/**
+ * @file ESPRIC_BootHistory.cpp
+ * @brief Implementation of the RTC memory boot history.
+ */
+
+#include "ESPRIC_BootHistory.h"
+#include <string.h>
+#include <time.h>
+#include <esp_system.h>
+
+#if !defined(ESPRIC_HOST)
+#include <esp_attr.h>
+#endif
+
+static constexpr uint32_t kMagic = 0x45524248;  ///< "ERBH"
+static constexpr uint16_t kStoreVersion = 1;   ///< Layout version of the store.
+
+#if defined(ESPRIC_HOST)
+static ESPRIC_BootHistoryStore rtcStore; ///< Simulated RTC memory.
+#else
+/**
+ * @brief Not initialized by the startup code, so it keeps its content across deep sleep and
+ * software resets. After a power loss it is random and fails the checksum.
+ */
+RTC_NOINIT_ATTR static ESPRIC_BootHistoryStore rtcStore;
+#endif
+
+ESPRIC_BootHistoryStore& espricBootHistoryStore() {
+    return rtcStore;
+}
+
+ESPRIC_BootHistory::ESPRIC_BootHistory(ESPRIC_BootHistoryStore& store) : store_(store) {}
+
+/**
+ * @brief FNV-1a over the store up to (excluding) the checksum field.
+ */
+uint32_t ESPRIC_BootHistory::checksumOf(const ESPRIC_BootHistoryStore& store) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&store);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < offsetof(ESPRIC_BootHistoryStore, checksum); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+ESPRIC_BootHistory::State ESPRIC_BootHistory::begin() {
+    if (store_.magic != kMagic) {
+        state_ = State::Initialized; // Power-on garbage or never written
+    } else if (store_.version != kStoreVersion || store_.capacity != ESPRIC_BOOT_HISTORY_LENGTH ||
+               store_.count > ESPRIC_BOOT_HISTORY_LENGTH || store_.head >= ESPRIC_BOOT_HISTORY_LENGTH ||
+               store_.checksum != checksumOf(store_)) {
+        state_ = State::Corrupted;
+    } else {
+        state_ = State::Valid;
+        return state_;
+    }
+    initialize();
+    return state_;
+}
+
+void ESPRIC_BootHistory::initialize() {
+    memset(&store_, 0, sizeof(store_));
+    store_.magic = kMagic;
+    store_.version = kStoreVersion;
+    store_.capacity = ESPRIC_BOOT_HISTORY_LENGTH;
+    store_.checksum = checksumOf(store_);
+}
+
+void ESPRIC_BootHistory::append(const ESPRIC_StartupContext& context) {
+    size_t slot;
+    if (store_.count < ESPRIC_BOOT_HISTORY_LENGTH) {
+        slot = (store_.head + store_.count) % ESPRIC_BOOT_HISTORY_LENGTH;
+        store_.count++;
+    } else {
+        slot = store_.head; // Full: overwrite the oldest record
+        store_.head = (store_.head + 1) % ESPRIC_BOOT_HISTORY_LENGTH;
+    }
+    ESPRIC_BootRecord& record = store_.records[slot];
+    record.resetReason = static_cast<uint8_t>(context.resetReason);
+    record.wakeupCause = static_cast<uint8_t>(context.wakeupCause);
+    record.reserved = 0;
+    record.bootSequence = ++store_.sequence;
+    record.timestamp = static_cast<uint32_t>(time(nullptr));
+    store_.checksum = checksumOf(store_);
+    powerOn_ = context.resetReason == ESP_RST_POWERON;
+}
+
+void ESPRIC_BootHistory::setFlushHandler(const FlushHandler& handler, uint32_t everyBoots) {
+    flushHandler_ = handler;
+    flushEvery_ = everyBoots;
+}
+
+bool ESPRIC_BootHistory::flushIfDue() {
+    if (!flushHandler_ || unflushed() == 0) {
+        return false;
+    }
+    if (!powerOn_ && (flushEvery_ == 0 || unflushed() < flushEvery_)) {
+        return false;
+    }
+    if (!flushHandler_(*this)) {
+        return false; // Retried on the next boot
+    }
+    markFlushed();
+    return true;
+}
+
+void ESPRIC_BootHistory::markFlushed() {
+    store_.flushedSequence = store_.sequence;
+    store_.checksum = checksumOf(store_);
+}
+
+const ESPRIC_BootRecord& ESPRIC_BootHistory::at(size_t index) const {
+    return store_.records[(store_.head + index) % ESPRIC_BOOT_HISTORY_LENGTH];
+}
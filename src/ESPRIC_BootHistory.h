@@ -0,0 +1,169 @@
+/**
+ * @file ESPRIC_BootHistory.h
+ * @brief Ring buffer of recent boots in RTC memory.
+ *
+ * `ESPRIC_BootHistory` appends one entry per boot (reset reason, wakeup cause, boot sequence
+ * number, RTC timestamp) to a fixed-size ring buffer in `RTC_NOINIT_ATTR` memory. RTC memory
+ * survives deep sleep and software resets without any flash write, so deep-sleep nodes keep
+ * their recent history for free. A checksum detects the random content after a power loss and
+ * any corruption; the history then restarts empty.
+ *
+ * An optional flush handler persists the history lazily: on a power-on reset, or once a
+ * configurable number of boots has not been flushed.
+ *
+ * On a host (`ESPRIC_HOST`) the store is ordinary memory ("simulated RTC memory"); pass your own
+ * `ESPRIC_BootHistoryStore` to the constructor to inspect or corrupt it.
+ */
+
+#ifndef ESPRIC_BOOTHISTORY_H
+#define ESPRIC_BOOTHISTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ESPRIC_InplaceFunction.h"
+#include "ESPRIC_StartupContext.h"
+
+/**
+ * @brief Number of boots kept in the ring buffer.
+ */
+#ifndef ESPRIC_BOOT_HISTORY_LENGTH
+#define ESPRIC_BOOT_HISTORY_LENGTH 16
+#endif
+
+/**
+ * @struct ESPRIC_BootRecord
+ * @brief One boot in the history (12 bytes).
+ */
+struct ESPRIC_BootRecord {
+    uint8_t resetReason;   ///< `esp_reset_reason_t` of the boot.
+    uint8_t wakeupCause;   ///< `esp_sleep_wakeup_cause_t` of the boot.
+    uint16_t reserved;     ///< Always 0.
+    uint32_t bootSequence; ///< Boot number since the history was (re)initialized, starting at 1.
+    uint32_t timestamp;    ///< `time()` in seconds at the boot; the RTC keeps running in deep sleep.
+};
+
+/**
+ * @struct ESPRIC_BootHistoryStore
+ * @brief Raw ring buffer layout as kept in RTC memory.
+ */
+struct ESPRIC_BootHistoryStore {
+    uint32_t magic;           ///< Marks an initialized store.
+    uint16_t version;         ///< Layout version.
+    uint16_t capacity;        ///< `ESPRIC_BOOT_HISTORY_LENGTH` of the writing firmware.
+    uint32_t head;            ///< Index of the oldest record.
+    uint32_t count;           ///< Number of valid records.
+    uint32_t sequence;        ///< Sequence number of the newest record.
+    uint32_t flushedSequence; ///< Sequence number of the newest flushed record.
+    ESPRIC_BootRecord records[ESPRIC_BOOT_HISTORY_LENGTH]; ///< Ring buffer.
+    uint32_t checksum;        ///< FNV-1a over all preceding bytes.
+};
+
+/**
+ * @brief Returns the store in RTC memory (ordinary memory on a host).
+ */
+ESPRIC_BootHistoryStore& espricBootHistoryStore();
+
+/**
+ * @class ESPRIC_BootHistory
+ * @brief Appends boots to and reads boots from an `ESPRIC_BootHistoryStore`.
+ */
+class ESPRIC_BootHistory {
+public:
+    /**
+     * @brief Called with the history when a lazy flush is due; returns `true` once persisted.
+     */
+    using FlushHandler = ESPRIC_InplaceFunction<bool(const ESPRIC_BootHistory&)>;
+
+    /**
+     * @enum State
+     * @brief Outcome of validating the store in `begin()`.
+     */
+    enum class State : uint8_t {
+        Valid,       ///< The history survived the reset.
+        Initialized, ///< The store held no history (first boot or power loss) and was initialized.
+        Corrupted    ///< The store failed the checksum or layout check and was reinitialized.
+    };
+
+    /**
+     * @brief Creates a history on the given store.
+     *
+     * @param store The ring buffer memory, by default the one in RTC memory.
+     */
+    explicit ESPRIC_BootHistory(ESPRIC_BootHistoryStore& store = espricBootHistoryStore());
+
+    /**
+     * @brief Validates the store and initializes it if necessary.
+     *
+     * @return The outcome of the validation.
+     */
+    State begin();
+
+    /**
+     * @brief Appends the boot described by `context`. Called by `ESPRIC::analyze()` when attached.
+     */
+    void append(const ESPRIC_StartupContext& context);
+
+    /**
+     * @brief Sets the lazy flush handler.
+     *
+     * @param handler Persists the history, e.g. to NVS or a file.
+     * @param everyBoots Flush once this many boots are unflushed (0: only on power-on resets).
+     */
+    void setFlushHandler(const FlushHandler& handler, uint32_t everyBoots);
+
+    /**
+     * @brief Calls the flush handler if a flush is due. Called by `ESPRIC::analyze()` when attached.
+     *
+     * @return `true` if the handler persisted the history; all records are then marked flushed.
+     */
+    bool flushIfDue();
+
+    /**
+     * @brief Marks all records as flushed, e.g. after persisting them without a flush handler.
+     */
+    void markFlushed();
+
+    /**
+     * @brief Returns the number of records in the history.
+     */
+    size_t size() const { return store_.count; }
+
+    /**
+     * @brief Returns a record; index 0 is the oldest.
+     */
+    const ESPRIC_BootRecord& at(size_t index) const;
+
+    /**
+     * @brief Returns the newest record; only valid if `size()` is not 0.
+     */
+    const ESPRIC_BootRecord& newest() const { return at(store_.count - 1); }
+
+    /**
+     * @brief Returns the number of records appended since the last flush.
+     */
+    uint32_t unflushed() const { return store_.sequence - store_.flushedSequence; }
+
+    /**
+     * @brief Returns the state found by the last `begin()`.
+     */
+    State state() const { return state_; }
+
+    /**
+     * @brief Computes the checksum of a store.
+     */
+    static uint32_t checksumOf(const ESPRIC_BootHistoryStore& store);
+
+private:
+    /**
+     * @brief Clears the store and writes its header and checksum.
+     */
+    void initialize();
+
+    ESPRIC_BootHistoryStore& store_; ///< Ring buffer memory.
+    FlushHandler flushHandler_;      ///< Lazy flush handler, may be empty.
+    uint32_t flushEvery_ = 0;        ///< Boots between flushes, 0 for power-on only.
+    State state_ = State::Initialized; ///< Result of the last `begin()`.
+    bool powerOn_ = false;           ///< True if the last appended boot was a power-on reset.
+};
+
+#endif // ESPRIC_BOOTHISTORY_H
@@ -0,0 +1,408 @@
+/**
+ * @file ESPRIC_BootLog.cpp
+ * @brief Implementation of the append-only boot-event log and its storage backends.
+ */
+
+#include "ESPRIC_BootLog.h"
+#include <stddef.h>
+#include <string.h>
+#include <esp_timer.h>
+
+#if !defined(ESPRIC_HOST)
+#include <esp_attr.h>
+#endif
+
+static_assert(ESPRIC_BOOT_LOG_SCAN_SIZE >= 128 && (ESPRIC_BOOT_LOG_SCAN_SIZE & (ESPRIC_BOOT_LOG_SCAN_SIZE - 1)) == 0,
+              "ESPRIC_BOOT_LOG_SCAN_SIZE must be a power of two of at least 128");
+
+/**
+ * @brief Storage bytes read while scanning; static so a 4 KiB sector read costs no stack. The
+ *        log is used from one task at a time.
+ */
+static uint8_t scanBuffer[ESPRIC_BOOT_LOG_SCAN_SIZE];
+static constexpr uint32_t kPendingMagic = 0x45524C50; ///< "ERLP"
+
+#if defined(ESPRIC_HOST)
+static uint32_t rtcUptime[2];                ///< Simulated RTC memory: uptime and its complement.
+static ESPRIC_BootLogPending rtcPending;      ///< Simulated RTC memory.
+#else
+RTC_NOINIT_ATTR static uint32_t rtcUptime[2]; ///< Uptime and its complement, kept across resets.
+/**
+ * @brief Not initialized by the startup code, so the batch survives deep sleep and software
+ * resets. After a power loss it is random and fails the checksum.
+ */
+RTC_NOINIT_ATTR static ESPRIC_BootLogPending rtcPending;
+#endif
+
+ESPRIC_BootLogPending& espricBootLogPending() {
+    return rtcPending;
+}
+
+// ESPRIC_BootLogMemory
+
+bool ESPRIC_BootLogMemory::read(size_t offset, void* data, size_t length) {
+    if (offset > size_ || length > size_ - offset) {
+        return false;
+    }
+    memcpy(data, buffer_ + offset, length);
+    reads_++;
+    return true;
+}
+
+/**
+ * @brief Clears bits only, like NOR flash.
+ */
+bool ESPRIC_BootLogMemory::write(size_t offset, const void* data, size_t length) {
+    if (offset > size_ || length > size_ - offset) {
+        return false;
+    }
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < length; i++) {
+        buffer_[offset + i] &= bytes[i];
+    }
+    writes_++;
+    return true;
+}
+
+bool ESPRIC_BootLogMemory::eraseSector(size_t offset) {
+    if (offset % sectorSize_ != 0 || offset >= size_) {
+        return false;
+    }
+    memset(buffer_ + offset, 0xFF, sectorSize_);
+    erases_++;
+    return true;
+}
+
+#if !defined(ESPRIC_HOST)
+
+// ESPRIC_BootLogPartition
+
+bool ESPRIC_BootLogPartition::begin() {
+    partition_ = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label_);
+    return partition_ != nullptr;
+}
+
+size_t ESPRIC_BootLogPartition::size() const {
+    return partition_ == nullptr ? 0 : partition_->size - partition_->size % partition_->erase_size;
+}
+
+size_t ESPRIC_BootLogPartition::sectorSize() const {
+    return partition_ == nullptr ? 0 : partition_->erase_size;
+}
+
+bool ESPRIC_BootLogPartition::read(size_t offset, void* data, size_t length) {
+    return partition_ != nullptr && esp_partition_read(partition_, offset, data, length) == ESP_OK;
+}
+
+bool ESPRIC_BootLogPartition::write(size_t offset, const void* data, size_t length) {
+    return partition_ != nullptr && esp_partition_write(partition_, offset, data, length) == ESP_OK;
+}
+
+bool ESPRIC_BootLogPartition::eraseSector(size_t offset) {
+    return partition_ != nullptr &&
+           esp_partition_erase_range(partition_, offset, partition_->erase_size) == ESP_OK;
+}
+
+// ESPRIC_BootLogFile
+
+/**
+ * @brief Keeps the handle open in read/write mode; every storage call only seeks on it.
+ */
+bool ESPRIC_BootLogFile::begin() {
+    file_.close();
+    if (fs_.exists(path_)) {
+        file_ = fs_.open(path_, "r+");
+        if (file_ && file_.size() == size_) {
+            return true;
+        }
+        file_.close();
+    }
+    file_ = fs_.open(path_, "w+");
+    if (!file_) {
+        return false;
+    }
+    uint8_t erased[64];
+    memset(erased, 0xFF, sizeof(erased));
+    for (size_t written = 0; written < size_; written += sizeof(erased)) {
+        if (file_.write(erased, sizeof(erased)) != sizeof(erased)) {
+            file_.close();
+            return false;
+        }
+    }
+    file_.flush();
+    return true;
+}
+
+bool ESPRIC_BootLogFile::read(size_t offset, void* data, size_t length) {
+    return file_ && file_.seek(offset) && file_.read(static_cast<uint8_t*>(data), length) == length;
+}
+
+/**
+ * @brief Flushes after the write, so the record is in the file system before the next reset.
+ */
+bool ESPRIC_BootLogFile::write(size_t offset, const void* data, size_t length) {
+    if (!file_ || !file_.seek(offset) || file_.write(static_cast<const uint8_t*>(data), length) != length) {
+        return false;
+    }
+    file_.flush();
+    return true;
+}
+
+bool ESPRIC_BootLogFile::eraseSector(size_t offset) {
+    if (!file_ || !file_.seek(offset)) {
+        return false;
+    }
+    uint8_t erased[64];
+    memset(erased, 0xFF, sizeof(erased));
+    for (size_t written = 0; written < sectorSize_; written += sizeof(erased)) {
+        if (file_.write(erased, sizeof(erased)) != sizeof(erased)) {
+            return false;
+        }
+    }
+    file_.flush();
+    return true;
+}
+
+#endif
+
+// ESPRIC_BootLog
+
+/**
+ * @brief Finds the valid record with the highest boot id; the log continues after it.
+ */
+bool ESPRIC_BootLog::begin() {
+    ready_ = false;
+    const size_t sectorSize = storage_.sectorSize();
+    size_t scanSize = sectorSize;
+    while (scanSize > sizeof(scanBuffer) && scanSize % 2 == 0) {
+        scanSize /= 2; // Sectors larger than the buffer are read in equal parts
+    }
+    if (sectorSize == 0 || scanSize > sizeof(scanBuffer) || scanSize % ESPRIC_BOOT_EVENT_SIZE != 0 ||
+        storage_.size() < 2 * sectorSize || storage_.size() % sectorSize != 0) {
+        return false; // Wrapping needs at least one sector besides the one being written
+    }
+    slots_ = storage_.size() / ESPRIC_BOOT_EVENT_SIZE;
+    slotsPerSector_ = sectorSize / ESPRIC_BOOT_EVENT_SIZE;
+    scanSlots_ = scanSize / ESPRIC_BOOT_EVENT_SIZE;
+    found_ = 0;
+    torn_ = 0;
+
+    bool any = false;
+    uint32_t newestId = 0;
+    size_t newestSlot = 0;
+    for (size_t slot = 0; slot < slots_; slot += scanSlots_) {
+        if (!storage_.read(slot * ESPRIC_BOOT_EVENT_SIZE, scanBuffer, scanSize)) {
+            return false;
+        }
+        for (size_t i = 0; i < scanSlots_; i++) {
+            ESPRIC_BootEvent event;
+            switch (espricDecodeBootEvent(scanBuffer + i * ESPRIC_BOOT_EVENT_SIZE, event)) {
+                case ESPRIC_BootEventStatus::Valid:
+                    found_++;
+                    if (!any || event.bootId > newestId) {
+                        any = true;
+                        newestId = event.bootId;
+                        newestSlot = slot + i;
+                    }
+                    break;
+                case ESPRIC_BootEventStatus::Torn:
+                    torn_++;
+                    break;
+                case ESPRIC_BootEventStatus::Erased:
+                    break;
+            }
+        }
+    }
+    position_ = any ? (newestSlot + 1) % slots_ : 0;
+    nextBootId_ = any ? newestId + 1 : 1;
+    restorePending(any, newestId);
+    ready_ = prepareSlot();
+    return ready_;
+}
+
+/**
+ * @brief FNV-1a over the batch up to (excluding) the checksum field.
+ */
+uint32_t ESPRIC_BootLog::checksumOf(const ESPRIC_BootLogPending& pending) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&pending);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < offsetof(ESPRIC_BootLogPending, checksum); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+void ESPRIC_BootLog::sealPending() {
+    pending_.magic = kPendingMagic;
+    pending_.checksum = checksumOf(pending_);
+}
+
+/**
+ * @brief A batch is dropped after a power loss (checksum) and if its records are not
+ *        consecutive; records already in the storage, e.g. of a write interrupted before the
+ *        batch was cleared, are removed from its front.
+ */
+void ESPRIC_BootLog::restorePending(bool any, uint32_t newestId) {
+    size_t keep = 0;
+    size_t skip = 0;
+    if (pending_.magic == kPendingMagic && pending_.count <= ESPRIC_BOOT_LOG_BATCH &&
+        pending_.checksum == checksumOf(pending_)) {
+        uint32_t previousId = 0;
+        for (size_t i = 0; i < pending_.count; i++) {
+            ESPRIC_BootEvent event;
+            if (espricDecodeBootEvent(pending_.records + i * ESPRIC_BOOT_EVENT_SIZE, event) !=
+                    ESPRIC_BootEventStatus::Valid || (i != 0 && event.bootId != previousId + 1)) {
+                skip = keep = 0;
+                break;
+            }
+            previousId = event.bootId;
+            if (any && event.bootId <= newestId) {
+                skip++;
+            } else {
+                keep++;
+            }
+        }
+        if (keep != 0) {
+            nextBootId_ = previousId + 1;
+        }
+    }
+    memmove(pending_.records, pending_.records + skip * ESPRIC_BOOT_EVENT_SIZE, keep * ESPRIC_BOOT_EVENT_SIZE);
+    memset(pending_.records + keep * ESPRIC_BOOT_EVENT_SIZE, 0xFF, sizeof(pending_.records) - keep * ESPRIC_BOOT_EVENT_SIZE);
+    pending_.count = static_cast<uint32_t>(keep);
+    sealPending();
+}
+
+bool ESPRIC_BootLog::readSlot(size_t slot, uint8_t* record) {
+    return storage_.read(slot * ESPRIC_BOOT_EVENT_SIZE, record, ESPRIC_BOOT_EVENT_SIZE);
+}
+
+/**
+ * @brief Skips torn slots inside the current sector; a sector the log enters is erased unless
+ *        it is already empty.
+ */
+bool ESPRIC_BootLog::prepareSlot() {
+    uint8_t record[ESPRIC_BOOT_EVENT_SIZE];
+    ESPRIC_BootEvent event;
+    for (size_t tries = 0; tries < slots_; tries++) {
+        if (position_ % slotsPerSector_ == 0) {
+            const size_t scanSize = scanSlots_ * ESPRIC_BOOT_EVENT_SIZE;
+            for (size_t slot = position_; slot < position_ + slotsPerSector_; slot += scanSlots_) {
+                if (!storage_.read(slot * ESPRIC_BOOT_EVENT_SIZE, scanBuffer, scanSize)) {
+                    return false;
+                }
+                for (size_t i = 0; i < scanSize; i++) {
+                    if (scanBuffer[i] != 0xFF) {
+                        return storage_.eraseSector(position_ * ESPRIC_BOOT_EVENT_SIZE);
+                    }
+                }
+            }
+            return true;
+        }
+        if (!readSlot(position_, record)) {
+            return false;
+        }
+        if (espricDecodeBootEvent(record, event) == ESPRIC_BootEventStatus::Erased) {
+            return true;
+        }
+        position_ = (position_ + 1) % slots_; // Torn write: leave it and use the next slot
+    }
+    return false;
+}
+
+bool ESPRIC_BootLog::append(const ESPRIC_StartupContext& context) {
+    ESPRIC_BootEvent event;
+    event.resetReason = static_cast<uint8_t>(context.resetReason);
+    event.wakeupCause = static_cast<uint8_t>(context.wakeupCause);
+    event.uptimeMs = previousUptimeMs();
+    event.firmwareTag = firmwareTag_;
+    return append(event);
+}
+
+bool ESPRIC_BootLog::append(ESPRIC_BootEvent event) {
+    if (!ready_) {
+        return false;
+    }
+    event.bootId = nextBootId_++;
+    espricEncodeBootEvent(event, pending_.records + pending_.count * ESPRIC_BOOT_EVENT_SIZE);
+    pending_.count++;
+    sealPending();
+    return pending_.count < ESPRIC_BOOT_LOG_BATCH || flush();
+}
+
+/**
+ * @brief Writes the batch with one write per touched sector.
+ */
+bool ESPRIC_BootLog::flush() {
+    size_t written = 0;
+    bool ok = true;
+    const size_t pending = pending_.count;
+    if (!ready_) {
+        return pending == 0;
+    }
+    while (ok && written < pending) {
+        ok = prepareSlot();
+        if (!ok) {
+            break;
+        }
+        const size_t room = slotsPerSector_ - position_ % slotsPerSector_;
+        const size_t count = pending - written < room ? pending - written : room;
+        ok = storage_.write(position_ * ESPRIC_BOOT_EVENT_SIZE, pending_.records + written * ESPRIC_BOOT_EVENT_SIZE,
+                            count * ESPRIC_BOOT_EVENT_SIZE);
+        written += count;
+        position_ = (position_ + count) % slots_;
+    }
+    pending_.count = 0;
+    sealPending();
+    return ok;
+}
+
+/**
+ * @brief Starts with the sector after the write position, which holds the oldest records.
+ */
+size_t ESPRIC_BootLog::replay(const Visitor& visitor) {
+    if (!ready_) {
+        return 0;
+    }
+    const size_t first = (position_ / slotsPerSector_ + 1) * slotsPerSector_ % slots_;
+    size_t valid = 0;
+    for (size_t done = 0; done < slots_; done += scanSlots_) {
+        const size_t slot = (first + done) % slots_;
+        if (!storage_.read(slot * ESPRIC_BOOT_EVENT_SIZE, scanBuffer, scanSlots_ * ESPRIC_BOOT_EVENT_SIZE)) {
+            break;
+        }
+        for (size_t i = 0; i < scanSlots_; i++) {
+            ESPRIC_BootEvent event;
+            if (espricDecodeBootEvent(scanBuffer + i * ESPRIC_BOOT_EVENT_SIZE, event) == ESPRIC_BootEventStatus::Valid) {
+                valid++;
+                if (visitor) {
+                    visitor(event);
+                }
+            }
+        }
+    }
+    return valid;
+}
+
+/**
+ * @brief Captures the value of the previous run before the first heartbeat of this run.
+ */
+static uint32_t capturedUptimeMs() {
+    static bool captured = false;
+    static uint32_t previous = 0;
+    if (!captured) {
+        captured = true;
+        previous = rtcUptime[1] == ~rtcUptime[0] ? rtcUptime[0] : 0; // Random after a power loss
+    }
+    return previous;
+}
+
+void ESPRIC_BootLog::heartbeat() {
+    capturedUptimeMs();
+    const uint32_t uptimeMs = static_cast<uint32_t>(esp_timer_get_time() / 1000);
+    rtcUptime[0] = uptimeMs;
+    rtcUptime[1] = ~uptimeMs;
+}
+
+uint32_t ESPRIC_BootLog::previousUptimeMs() {
+    return capturedUptimeMs();
+}
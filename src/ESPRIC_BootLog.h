@@ -0,0 +1,346 @@
+/**
+ * @file ESPRIC_BootLog.h
+ * @brief Append-only flash log of boot events in the format of `ESPRIC_BootLogFormat.h`.
+ *
+ * `ESPRIC_BootLog` writes one 16-byte record per boot to an `ESPRIC_BootLogStorage`: a raw data
+ * partition (`ESPRIC_BootLogPartition`), a preallocated file, e.g. on LittleFS
+ * (`ESPRIC_BootLogFile`), or a memory buffer (`ESPRIC_BootLogMemory`, also used on a host).
+ *
+ * The storage is used as a circular log of flash sectors:
+ * - Records are collected in a batch in `RTC_NOINIT_ATTR` memory (`ESPRIC_BootLogPending`) and
+ *   written with one write per batch. The batch survives deep sleep and software resets, so it
+ *   spans boots; a checksum discards it after a power loss, which loses at most
+ *   `ESPRIC_BOOT_LOG_BATCH - 1` unwritten boots. A batch never crosses a sector boundary.
+ * - A sector is erased when the log enters it, so the oldest sector is dropped once the storage
+ *   is full.
+ * - `begin()` scans the storage, continues after the record with the highest boot id and skips
+ *   slots left by an interrupted (torn) write. No header or index has to be kept consistent.
+ *   The scan reads a whole sector per storage read (up to `ESPRIC_BOOT_LOG_SCAN_SIZE` bytes).
+ */
+
+#ifndef ESPRIC_BOOTLOG_H
+#define ESPRIC_BOOTLOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ESPRIC_BootLogFormat.h"
+#include "ESPRIC_InplaceFunction.h"
+#include "ESPRIC_StartupContext.h"
+
+#if !defined(ESPRIC_HOST)
+#include <FS.h>
+#include <esp_partition.h>
+#endif
+
+/**
+ * @brief Records kept in RTC memory before they are written with one flash write; 1 writes
+ *        every boot immediately.
+ */
+#ifndef ESPRIC_BOOT_LOG_BATCH
+#define ESPRIC_BOOT_LOG_BATCH 8
+#endif
+
+/**
+ * @brief Bytes read per storage read while scanning, a power of two of at least 128. Sectors up
+ *        to this size are read at once; the buffer is static, so it costs no stack at boot.
+ */
+#ifndef ESPRIC_BOOT_LOG_SCAN_SIZE
+#define ESPRIC_BOOT_LOG_SCAN_SIZE 4096
+#endif
+
+/**
+ * @struct ESPRIC_BootLogPending
+ * @brief Pending batch as kept in RTC memory.
+ */
+struct ESPRIC_BootLogPending {
+    uint32_t magic;    ///< Marks an initialized batch.
+    uint32_t count;    ///< Encoded records in `records`.
+    uint8_t records[ESPRIC_BOOT_LOG_BATCH * ESPRIC_BOOT_EVENT_SIZE]; ///< Records of `ESPRIC_BootLogFormat.h`.
+    uint32_t checksum; ///< FNV-1a over all preceding bytes.
+};
+
+/**
+ * @brief Returns the pending batch in RTC memory (ordinary memory on a host).
+ */
+ESPRIC_BootLogPending& espricBootLogPending();
+
+/**
+ * @class ESPRIC_BootLogStorage
+ * @brief Flash-like storage of the boot log: erased bytes read `0xFF`, erasing works per sector.
+ */
+class ESPRIC_BootLogStorage {
+public:
+    virtual ~ESPRIC_BootLogStorage() = default;
+
+    /**
+     * @brief Returns the usable size in bytes, a multiple of `sectorSize()`.
+     */
+    virtual size_t size() const = 0;
+
+    /**
+     * @brief Returns the erase unit in bytes, a multiple of 128 (8 records).
+     */
+    virtual size_t sectorSize() const = 0;
+
+    virtual bool read(size_t offset, void* data, size_t length) = 0;        ///< Reads bytes.
+    virtual bool write(size_t offset, const void* data, size_t length) = 0; ///< Writes erased bytes.
+    virtual bool eraseSector(size_t offset) = 0;                             ///< Sets a sector to `0xFF`.
+};
+
+/**
+ * @class ESPRIC_BootLogMemory
+ * @brief Boot log storage in a caller-provided buffer with NOR flash semantics.
+ *
+ * Writes can only clear bits, like flash. Useful for tests on a host and for logs in RAM.
+ */
+class ESPRIC_BootLogMemory : public ESPRIC_BootLogStorage {
+public:
+    /**
+     * @param buffer Storage bytes, left unchanged so existing content can be scanned.
+     * @param size Size of `buffer`, a multiple of `sectorSize`.
+     * @param sectorSize Simulated erase unit.
+     */
+    ESPRIC_BootLogMemory(uint8_t* buffer, size_t size, size_t sectorSize = 4096)
+        : buffer_(buffer), size_(size), sectorSize_(sectorSize) {}
+
+    size_t size() const override { return size_; }
+    size_t sectorSize() const override { return sectorSize_; }
+    bool read(size_t offset, void* data, size_t length) override;
+    bool write(size_t offset, const void* data, size_t length) override;
+    bool eraseSector(size_t offset) override;
+
+    /**
+     * @brief Returns the number of `read()` calls.
+     */
+    uint32_t reads() const { return reads_; }
+
+    /**
+     * @brief Returns the number of `write()` calls, e.g. to count flash writes on a host.
+     */
+    uint32_t writes() const { return writes_; }
+
+    /**
+     * @brief Returns the number of `eraseSector()` calls.
+     */
+    uint32_t erases() const { return erases_; }
+
+private:
+    uint8_t* buffer_;     ///< Storage bytes.
+    size_t size_;         ///< Size of `buffer_`.
+    size_t sectorSize_;   ///< Erase unit.
+    uint32_t reads_ = 0;  ///< Reads performed.
+    uint32_t writes_ = 0; ///< Writes performed.
+    uint32_t erases_ = 0; ///< Sector erases performed.
+};
+
+#if !defined(ESPRIC_HOST)
+
+/**
+ * @class ESPRIC_BootLogPartition
+ * @brief Boot log storage in a raw data partition of the partition table.
+ *
+ * Example partition table line: `espric_log, data, 0x99, , 0x10000`.
+ */
+class ESPRIC_BootLogPartition : public ESPRIC_BootLogStorage {
+public:
+    /**
+     * @param label Label of the data partition.
+     */
+    explicit ESPRIC_BootLogPartition(const char* label = "espric_log") : label_(label) {}
+
+    /**
+     * @brief Looks up the partition.
+     *
+     * @return `false` if no data partition with the label exists.
+     */
+    bool begin();
+
+    size_t size() const override;
+    size_t sectorSize() const override;
+    bool read(size_t offset, void* data, size_t length) override;
+    bool write(size_t offset, const void* data, size_t length) override;
+    bool eraseSector(size_t offset) override;
+
+private:
+    const char* label_;                         ///< Partition label.
+    const esp_partition_t* partition_ = nullptr; ///< Partition found by `begin()`.
+};
+
+/**
+ * @class ESPRIC_BootLogFile
+ * @brief Boot log storage in a preallocated file, e.g. on LittleFS.
+ *
+ * The file keeps a fixed size; "erasing" a sector writes `0xFF`, so the log wraps in place.
+ * `begin()` opens the file once; reads, writes and erases seek on that handle, and every write
+ * is flushed to the file system.
+ */
+class ESPRIC_BootLogFile : public ESPRIC_BootLogStorage {
+public:
+    /**
+     * @param fs Mounted file system, e.g. `LittleFS`.
+     * @param path File path.
+     * @param size File size in bytes, a multiple of `sectorSize`.
+     * @param sectorSize Erase unit; the file system block size avoids partial block rewrites.
+     */
+    ESPRIC_BootLogFile(fs::FS& fs, const char* path, size_t size, size_t sectorSize = 4096)
+        : fs_(fs), path_(path), size_(size), sectorSize_(sectorSize) {}
+
+    /**
+     * @brief Opens the file, creating it filled with `0xFF` if it does not exist or has another size.
+     */
+    bool begin();
+
+    /**
+     * @brief Closes the file.
+     */
+    void end() { file_.close(); }
+
+    size_t size() const override { return size_; }
+    size_t sectorSize() const override { return sectorSize_; }
+    bool read(size_t offset, void* data, size_t length) override;
+    bool write(size_t offset, const void* data, size_t length) override;
+    bool eraseSector(size_t offset) override;
+
+private:
+    fs::FS& fs_;        ///< File system of the file.
+    const char* path_;  ///< File path.
+    size_t size_;       ///< File size.
+    size_t sectorSize_; ///< Erase unit.
+    File file_;         ///< Handle opened by `begin()`.
+};
+
+#endif
+
+/**
+ * @class ESPRIC_BootLog
+ * @brief Appends boot events to an `ESPRIC_BootLogStorage` and replays them.
+ */
+class ESPRIC_BootLog {
+public:
+    /**
+     * @brief Receives each valid record of `replay()`, oldest first.
+     */
+    using Visitor = ESPRIC_InplaceFunction<void(const ESPRIC_BootEvent&)>;
+
+    /**
+     * @param storage Storage of the log; must outlive the log.
+     * @param firmwareTag Written into every record, e.g. a build number.
+     * @param pending Batch of unwritten records; one per storage, the RTC memory one by default.
+     */
+    explicit ESPRIC_BootLog(ESPRIC_BootLogStorage& storage, uint16_t firmwareTag = 0,
+                            ESPRIC_BootLogPending& pending = espricBootLogPending())
+        : storage_(storage), firmwareTag_(firmwareTag), pending_(pending) {}
+
+    /**
+     * @brief Scans the storage, finds the write position and restores the pending batch.
+     *
+     * Pending records are kept if the batch passes its checksum, and only those with a boot id
+     * newer than the storage, so records of a write interrupted after reaching the flash are
+     * not logged twice.
+     *
+     * @return `false` if the storage geometry is unusable or cannot be read.
+     */
+    bool begin();
+
+    /**
+     * @brief Appends the boot of `context`, with the uptime saved by `heartbeat()` before the reset.
+     *
+     * @return `false` if the log is not ready or the batch could not be written.
+     */
+    bool append(const ESPRIC_StartupContext& context);
+
+    /**
+     * @brief Appends an event; its boot id is assigned by the log.
+     */
+    bool append(ESPRIC_BootEvent event);
+
+    /**
+     * @brief Writes the pending batch, e.g. before a planned power-off.
+     *
+     * @return `false` if a write or erase failed; the batch is then dropped.
+     */
+    bool flush();
+
+    /**
+     * @brief Returns the number of records waiting in the batch.
+     */
+    size_t pending() const { return pending_.count; }
+
+    /**
+     * @brief Calls `visitor` for every valid record in the storage, oldest first.
+     *
+     * Pending records are not included; call `flush()` first. `visitor` must not use a boot log,
+     * which shares the scan buffer.
+     *
+     * @return The number of valid records.
+     */
+    size_t replay(const Visitor& visitor);
+
+    /**
+     * @brief Returns the boot id the next record receives.
+     */
+    uint32_t nextBootId() const { return nextBootId_; }
+
+    /**
+     * @brief Returns the number of valid records found by `begin()`.
+     */
+    size_t recordsFound() const { return found_; }
+
+    /**
+     * @brief Returns the number of torn slots found by `begin()`; they are skipped.
+     */
+    size_t tornFound() const { return torn_; }
+
+    /**
+     * @brief Saves the current uptime in RTC memory; call it periodically.
+     *
+     * The next boot logs the last saved value as the uptime of the previous run. An RTC memory
+     * write costs no flash.
+     */
+    static void heartbeat();
+
+    /**
+     * @brief Returns the uptime saved by the last `heartbeat()` before this boot, or 0.
+     */
+    static uint32_t previousUptimeMs();
+
+private:
+    /**
+     * @brief Moves `position_` to a free slot, erasing the sector the log enters.
+     */
+    bool prepareSlot();
+
+    /**
+     * @brief Reads the slot at `slot` into `record`.
+     */
+    bool readSlot(size_t slot, uint8_t* record);
+
+    /**
+     * @brief Keeps the valid pending records newer than `newestId`, or clears the batch.
+     */
+    void restorePending(bool any, uint32_t newestId);
+
+    /**
+     * @brief Updates the checksum of the batch after a change.
+     */
+    void sealPending();
+
+    /**
+     * @brief Computes the checksum of a batch.
+     */
+    static uint32_t checksumOf(const ESPRIC_BootLogPending& pending);
+
+    ESPRIC_BootLogStorage& storage_;  ///< Backing storage.
+    uint16_t firmwareTag_;            ///< Tag written into every record.
+    bool ready_ = false;              ///< Set by a successful `begin()`.
+    size_t slots_ = 0;                ///< Record slots in the storage.
+    size_t slotsPerSector_ = 0;       ///< Record slots per sector.
+    size_t scanSlots_ = 0;            ///< Record slots per storage read while scanning.
+    size_t position_ = 0;             ///< Slot of the next write.
+    uint32_t nextBootId_ = 1;         ///< Boot id of the next record.
+    size_t found_ = 0;                ///< Valid records found by `begin()`.
+    size_t torn_ = 0;                 ///< Torn slots found by `begin()`.
+    ESPRIC_BootLogPending& pending_;  ///< Unwritten records, kept across boots.
+};
+
+#endif // ESPRIC_BOOTLOG_H
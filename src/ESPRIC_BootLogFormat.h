@@ -0,0 +1,152 @@
+/**
+ * @file ESPRIC_BootLogFormat.h
+ * @brief Fixed-width binary record of the ESPRIC boot-event log.
+ *
+ * Every boot is one 16-byte record, stored little-endian regardless of the CPU:
+ *
+ * | Offset | Size | Field |
+ * |---|---|---|
+ * | 0 | 1 | magic `0xEB` |
+ * | 1 | 1 | format version (1) |
+ * | 2 | 1 | `esp_reset_reason_t` |
+ * | 3 | 1 | `esp_sleep_wakeup_cause_t` |
+ * | 4 | 4 | boot id, incremented per record |
+ * | 8 | 4 | uptime of the previous run in milliseconds (0 if unknown) |
+ * | 12 | 2 | firmware tag chosen by the application |
+ * | 14 | 2 | CRC-16/CCITT-FALSE over bytes 0 to 13 |
+ *
+ * Erased flash reads as `0xFF`, so an all-`0xFF` slot is free and a slot that is neither free
+ * nor passes the magic and CRC check is a torn or corrupted write.
+ *
+ * This header depends on the C++ standard library only and is shared by the device writer
+ * (`ESPRIC_BootLog.h`) and host tools that read the same bytes.
+ */
+
+#ifndef ESPRIC_BOOTLOGFORMAT_H
+#define ESPRIC_BOOTLOGFORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+static constexpr size_t ESPRIC_BOOT_EVENT_SIZE = 16;      ///< Bytes per record.
+static constexpr uint8_t ESPRIC_BOOT_EVENT_MAGIC = 0xEB;  ///< First byte of every record.
+static constexpr uint8_t ESPRIC_BOOT_EVENT_VERSION = 1;   ///< Format version written by this library.
+
+/**
+ * @struct ESPRIC_BootEvent
+ * @brief Decoded boot-event record.
+ */
+struct ESPRIC_BootEvent {
+    uint8_t resetReason = 0;  ///< `esp_reset_reason_t` of the boot.
+    uint8_t wakeupCause = 0;  ///< `esp_sleep_wakeup_cause_t` of the boot.
+    uint32_t bootId = 0;      ///< Monotonic record number.
+    uint32_t uptimeMs = 0;    ///< Uptime of the previous run in milliseconds, 0 if unknown.
+    uint16_t firmwareTag = 0; ///< Application-defined firmware identifier.
+};
+
+/**
+ * @enum ESPRIC_BootEventStatus
+ * @brief Result of decoding one record slot.
+ */
+enum class ESPRIC_BootEventStatus : uint8_t {
+    Valid,  ///< Magic, version and CRC match.
+    Erased, ///< All bytes are `0xFF`: the slot was never written.
+    Torn    ///< Neither valid nor erased: interrupted write or corruption.
+};
+
+/**
+ * @struct ESPRIC_Crc16Table
+ * @brief Lookup table of the CRC-16/CCITT-FALSE polynomial 0x1021.
+ */
+struct ESPRIC_Crc16Table {
+    uint16_t entries[256]; ///< CRC of each byte value.
+};
+
+/**
+ * @brief Builds the CRC lookup table at compile time.
+ */
+constexpr ESPRIC_Crc16Table espricMakeCrc16Table() {
+    ESPRIC_Crc16Table table{};
+    for (unsigned value = 0; value < 256; value++) {
+        uint16_t crc = static_cast<uint16_t>(value << 8);
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+        }
+        table.entries[value] = crc;
+    }
+    return table;
+}
+
+static constexpr ESPRIC_Crc16Table ESPRIC_CRC16_TABLE = espricMakeCrc16Table(); ///< 512 bytes in flash.
+
+/**
+ * @brief CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF), one table lookup per byte.
+ */
+inline uint16_t espricBootEventCrc(const uint8_t* bytes, size_t length) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc = static_cast<uint16_t>((crc << 8) ^ ESPRIC_CRC16_TABLE.entries[((crc >> 8) ^ bytes[i]) & 0xFF]);
+    }
+    return crc;
+}
+
+/**
+ * @brief Writes `value` little-endian into `bytes`.
+ */
+inline void espricPutLe(uint8_t* bytes, uint32_t value, size_t width) {
+    for (size_t i = 0; i < width; i++) {
+        bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+/**
+ * @brief Reads a little-endian value of `width` bytes.
+ */
+inline uint32_t espricGetLe(const uint8_t* bytes, size_t width) {
+    uint32_t value = 0;
+    for (size_t i = 0; i < width; i++) {
+        value |= static_cast<uint32_t>(bytes[i]) << (8 * i);
+    }
+    return value;
+}
+
+/**
+ * @brief Encodes `event` into a 16-byte record including magic, version and CRC.
+ */
+inline void espricEncodeBootEvent(const ESPRIC_BootEvent& event, uint8_t* record) {
+    record[0] = ESPRIC_BOOT_EVENT_MAGIC;
+    record[1] = ESPRIC_BOOT_EVENT_VERSION;
+    record[2] = event.resetReason;
+    record[3] = event.wakeupCause;
+    espricPutLe(record + 4, event.bootId, 4);
+    espricPutLe(record + 8, event.uptimeMs, 4);
+    espricPutLe(record + 12, event.firmwareTag, 2);
+    espricPutLe(record + 14, espricBootEventCrc(record, 14), 2);
+}
+
+/**
+ * @brief Classifies a 16-byte slot and decodes it if it is valid.
+ *
+ * @param record Slot bytes, read in place.
+ * @param event Receives the fields of a valid record; untouched otherwise.
+ * @return The status of the slot.
+ */
+inline ESPRIC_BootEventStatus espricDecodeBootEvent(const uint8_t* record, ESPRIC_BootEvent& event) {
+    if (record[0] != ESPRIC_BOOT_EVENT_MAGIC || record[1] != ESPRIC_BOOT_EVENT_VERSION ||
+        espricGetLe(record + 14, 2) != espricBootEventCrc(record, 14)) {
+        for (size_t i = 0; i < ESPRIC_BOOT_EVENT_SIZE; i++) {
+            if (record[i] != 0xFF) {
+                return ESPRIC_BootEventStatus::Torn;
+            }
+        }
+        return ESPRIC_BootEventStatus::Erased;
+    }
+    event.resetReason = record[2];
+    event.wakeupCause = record[3];
+    event.bootId = espricGetLe(record + 4, 4);
+    event.uptimeMs = espricGetLe(record + 8, 4);
+    event.firmwareTag = static_cast<uint16_t>(espricGetLe(record + 12, 2));
+    return ESPRIC_BootEventStatus::Valid;
+}
+
+#endif // ESPRIC_BOOTLOGFORMAT_H
@@ -0,0 +1,139 @@
+/**
+ * @file ESPRIC_BootLoop.cpp
+ * @brief Implementation of the RTC memory boot-loop detector.
+ */
+
+#include "ESPRIC_BootLoop.h"
+#include <string.h>
+#include <time.h>
+
+#if !defined(ESPRIC_HOST)
+#include <esp_attr.h>
+#endif
+
+static constexpr uint32_t kMagic = 0x4552424C;  ///< "ERBL"
+static constexpr uint16_t kStoreVersion = 1;   ///< Layout version of the store.
+
+#if defined(ESPRIC_HOST)
+static ESPRIC_BootLoopStore rtcStore; ///< Simulated RTC memory.
+#else
+/**
+ * @brief Not initialized by the startup code, so it keeps its content across deep sleep and
+ * software resets. After a power loss it is random and fails the checksum.
+ */
+RTC_NOINIT_ATTR static ESPRIC_BootLoopStore rtcStore;
+#endif
+
+ESPRIC_BootLoopStore& espricBootLoopStore() {
+    return rtcStore;
+}
+
+ESPRIC_BootLoopDetector::ESPRIC_BootLoopDetector(const Config& config, ESPRIC_BootLoopStore& store)
+    : config_(config), store_(store) {}
+
+/**
+ * @brief FNV-1a over the store up to (excluding) the checksum field.
+ */
+uint32_t ESPRIC_BootLoopDetector::checksumOf(const ESPRIC_BootLoopStore& store) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&store);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < offsetof(ESPRIC_BootLoopStore, checksum); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+void ESPRIC_BootLoopDetector::validate() {
+    if (store_.magic != kMagic) {
+        storeState_ = StoreState::Initialized; // Power-on garbage or never written
+    } else if (store_.version != kStoreVersion || store_.capacity != ESPRIC_BOOT_LOOP_WINDOW ||
+               store_.count > ESPRIC_BOOT_LOOP_WINDOW || store_.head >= ESPRIC_BOOT_LOOP_WINDOW ||
+               store_.state > static_cast<uint8_t>(ESPRIC_BootLoopState::Halt) ||
+               store_.checksum != checksumOf(store_)) {
+        storeState_ = StoreState::Corrupted;
+    } else {
+        storeState_ = StoreState::Valid;
+        return;
+    }
+    initialize();
+}
+
+void ESPRIC_BootLoopDetector::initialize() {
+    memset(&store_, 0, sizeof(store_));
+    store_.magic = kMagic;
+    store_.version = kStoreVersion;
+    store_.capacity = ESPRIC_BOOT_LOOP_WINDOW;
+    store_.checksum = checksumOf(store_);
+}
+
+ESPRIC_BootLoopState ESPRIC_BootLoopDetector::update() {
+    return update(esp_reset_reason(), static_cast<uint32_t>(time(nullptr)));
+}
+
+ESPRIC_BootLoopState ESPRIC_BootLoopDetector::update(ESPRIC_StartupContext& context) {
+    const ESPRIC_BootLoopState state = update(context.resetReason, static_cast<uint32_t>(time(nullptr)));
+    context.bootLoopState = state;
+    context.recentCrashes = store_.count;
+    return state;
+}
+
+ESPRIC_BootLoopState ESPRIC_BootLoopDetector::update(esp_reset_reason_t reason, uint32_t now) {
+    if (updated_) {
+        return state(); // Recorded earlier in this boot, e.g. before the heavy initialization
+    }
+    updated_ = true;
+    validate();
+
+    if (reason == ESP_RST_POWERON) {
+        store_.head = 0; // Power cycled by hand: start over
+        store_.count = 0;
+    } else if ((config_.crashMask & espricCauseBit(static_cast<unsigned>(reason))) != 0) {
+        if (store_.count == ESPRIC_BOOT_LOOP_WINDOW) {
+            store_.head = static_cast<uint8_t>((store_.head + 1) % ESPRIC_BOOT_LOOP_WINDOW); // Drop the oldest
+            store_.count--;
+        }
+        const size_t slot = (store_.head + store_.count) % ESPRIC_BOOT_LOOP_WINDOW;
+        store_.timestamps[slot] = now;
+        store_.reasons[slot] = static_cast<uint8_t>(reason);
+        store_.count++;
+    }
+
+    // Expire from the oldest end. A timestamp ahead of `now` (clock set back) wraps to a large
+    // age and expires as well.
+    while (store_.count > 0 && now - store_.timestamps[store_.head] > config_.windowSeconds) {
+        store_.head = static_cast<uint8_t>((store_.head + 1) % ESPRIC_BOOT_LOOP_WINDOW);
+        store_.count--;
+    }
+
+    store_.state = static_cast<uint8_t>(classify(store_.count));
+    store_.checksum = checksumOf(store_);
+    return state();
+}
+
+void ESPRIC_BootLoopDetector::markStable() {
+    store_.head = 0;
+    store_.count = 0;
+    store_.state = static_cast<uint8_t>(ESPRIC_BootLoopState::Normal);
+    store_.checksum = checksumOf(store_);
+}
+
+ESPRIC_BootLoopState ESPRIC_BootLoopDetector::classify(size_t crashes) const {
+    if (config_.haltAfter != 0 && crashes >= config_.haltAfter) {
+        return ESPRIC_BootLoopState::Halt;
+    }
+    if (config_.safeModeAfter != 0 && crashes >= config_.safeModeAfter) {
+        return ESPRIC_BootLoopState::SafeMode;
+    }
+    if (config_.degradedAfter != 0 && crashes >= config_.degradedAfter) {
+        return ESPRIC_BootLoopState::Degraded;
+    }
+    return ESPRIC_BootLoopState::Normal;
+}
+
+esp_reset_reason_t ESPRIC_BootLoopDetector::crashReason(size_t index) const {
+    return static_cast<esp_reset_reason_t>(store_.reasons[(store_.head + index) % ESPRIC_BOOT_LOOP_WINDOW]);
+}
+
+uint32_t ESPRIC_BootLoopDetector::crashTime(size_t index) const {
+    return store_.timestamps[(store_.head + index) % ESPRIC_BOOT_LOOP_WINDOW];
+}
@@ -0,0 +1,196 @@
+/**
+ * @file ESPRIC_BootLoop.h
+ * @brief Boot-loop detection with escalation to degraded operation, safe mode and halt.
+ *
+ * `ESPRIC_BootLoopDetector` keeps the timestamps and reset reasons of the most recent crash
+ * resets in `RTC_NOINIT_ATTR` memory. The entries form a sliding window: every update appends a
+ * crash reset and drops the crashes older than the configured window from the tail, so the
+ * crash count is the number of entries and each boot does O(1) amortized work. The count selects
+ * the `ESPRIC_BootLoopState`, which is stored in the startup context for the conditions.
+ *
+ * The update only needs `esp_reset_reason()`, `time()` and a checksum over 56 bytes, so it can run
+ * first thing in `setup()`, before any driver or network initialization. A power-on reset (e.g.
+ * the user cycling power) or `markStable()` clears the window.
+ *
+ * On a host (`ESPRIC_HOST`) the store is ordinary memory; pass your own `ESPRIC_BootLoopStore`
+ * to the constructor to inspect or corrupt it.
+ */
+
+#ifndef ESPRIC_BOOTLOOP_H
+#define ESPRIC_BOOTLOOP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <esp_system.h>
+#include "ESPRIC_CauseMask.h"
+#include "ESPRIC_StartupContext.h"
+
+/**
+ * @brief Number of crashes kept in the window; caps the escalation thresholds.
+ */
+#ifndef ESPRIC_BOOT_LOOP_WINDOW
+#define ESPRIC_BOOT_LOOP_WINDOW 8
+#endif
+
+static_assert(ESPRIC_BOOT_LOOP_WINDOW > 0 && ESPRIC_BOOT_LOOP_WINDOW <= 255,
+              "ESPRIC_BOOT_LOOP_WINDOW must be between 1 and 255");
+
+/**
+ * @struct ESPRIC_BootLoopStore
+ * @brief Raw crash window as kept in RTC memory.
+ */
+struct ESPRIC_BootLoopStore {
+    uint32_t magic;                                  ///< Marks an initialized store.
+    uint16_t version;                                ///< Layout version.
+    uint8_t capacity;                                ///< `ESPRIC_BOOT_LOOP_WINDOW` of the writing firmware.
+    uint8_t state;                                   ///< `ESPRIC_BootLoopState` of the last update.
+    uint8_t head;                                    ///< Index of the oldest crash.
+    uint8_t count;                                   ///< Number of crashes in the window.
+    uint16_t reserved;                               ///< Always 0.
+    uint32_t timestamps[ESPRIC_BOOT_LOOP_WINDOW];    ///< `time()` in seconds of each crash reset.
+    uint8_t reasons[ESPRIC_BOOT_LOOP_WINDOW];        ///< `esp_reset_reason_t` of each crash reset.
+    uint32_t checksum;                               ///< FNV-1a over all preceding bytes.
+};
+
+/**
+ * @brief Returns the store in RTC memory (ordinary memory on a host).
+ */
+ESPRIC_BootLoopStore& espricBootLoopStore();
+
+/**
+ * @struct ESPRIC_BootLoopConfig
+ * @brief Crash definition, window length and escalation thresholds of a boot-loop detector.
+ *
+ * A threshold of 0 disables its state. Thresholds above `ESPRIC_BOOT_LOOP_WINDOW` are never
+ * reached.
+ */
+struct ESPRIC_BootLoopConfig {
+    uint32_t crashMask = ESPRIC_RESET_MASK_ANY_CRASH; ///< Reset reasons counted as crashes.
+    uint32_t windowSeconds = 600;                     ///< Crashes older than this are forgotten.
+    uint8_t degradedAfter = 2;                        ///< Crashes in the window for `Degraded`.
+    uint8_t safeModeAfter = 3;                        ///< Crashes in the window for `SafeMode`.
+    uint8_t haltAfter = 5;                            ///< Crashes in the window for `Halt`.
+};
+
+/**
+ * @class ESPRIC_BootLoopDetector
+ * @brief Counts crash resets within a time window and derives the boot-loop state.
+ */
+class ESPRIC_BootLoopDetector {
+public:
+    /**
+     * @brief Type alias for the detector configuration.
+     */
+    using Config = ESPRIC_BootLoopConfig;
+
+    /**
+     * @enum StoreState
+     * @brief Outcome of validating the store on the first update.
+     */
+    enum class StoreState : uint8_t {
+        Valid,       ///< The window survived the reset.
+        Initialized, ///< The store held no window (first boot or power loss) and was initialized.
+        Corrupted    ///< The store failed the checksum or layout check and was reinitialized.
+    };
+
+    /**
+     * @brief Creates a detector on the given store.
+     *
+     * @param config Crash definition, window and thresholds.
+     * @param store The window memory, by default the one in RTC memory.
+     */
+    explicit ESPRIC_BootLoopDetector(const Config& config = Config(),
+                                     ESPRIC_BootLoopStore& store = espricBootLoopStore());
+
+    /**
+     * @brief Records the current boot from `esp_reset_reason()` and `time()`.
+     *
+     * Only the first update per detector object changes the window; later calls return the state
+     * of the first one.
+     *
+     * @return The boot-loop state of this boot.
+     */
+    ESPRIC_BootLoopState update();
+
+    /**
+     * @brief Records the boot described by `context` and stores the result in it.
+     *
+     * Sets `context.bootLoopState` and `context.recentCrashes`. Called by `ESPRIC::analyze()`
+     * when attached.
+     *
+     * @return The boot-loop state of this boot.
+     */
+    ESPRIC_BootLoopState update(ESPRIC_StartupContext& context);
+
+    /**
+     * @brief Records a boot with an explicit reset reason and time, e.g. a recorded boot on a host.
+     *
+     * @param reason Reset reason of the boot.
+     * @param now Current time in seconds, on the clock of the stored timestamps.
+     * @return The boot-loop state of this boot.
+     */
+    ESPRIC_BootLoopState update(esp_reset_reason_t reason, uint32_t now);
+
+    /**
+     * @brief Clears the crash window, e.g. once the firmware has run long enough to count as stable.
+     */
+    void markStable();
+
+    /**
+     * @brief Returns the state of the last update.
+     */
+    ESPRIC_BootLoopState state() const { return static_cast<ESPRIC_BootLoopState>(store_.state); }
+
+    /**
+     * @brief Returns the number of crashes in the window.
+     */
+    size_t crashes() const { return store_.count; }
+
+    /**
+     * @brief Returns the reset reason of a crash in the window; index 0 is the oldest.
+     */
+    esp_reset_reason_t crashReason(size_t index) const;
+
+    /**
+     * @brief Returns the time in seconds of a crash in the window; index 0 is the oldest.
+     */
+    uint32_t crashTime(size_t index) const;
+
+    /**
+     * @brief Returns the result of validating the store, available after the first update.
+     */
+    StoreState storeState() const { return storeState_; }
+
+    /**
+     * @brief Returns the configuration.
+     */
+    const Config& config() const { return config_; }
+
+    /**
+     * @brief Returns the state for `crashes` crashes in the window.
+     */
+    ESPRIC_BootLoopState classify(size_t crashes) const;
+
+    /**
+     * @brief Computes the checksum of a store.
+     */
+    static uint32_t checksumOf(const ESPRIC_BootLoopStore& store);
+
+private:
+    /**
+     * @brief Validates the store and initializes it if necessary.
+     */
+    void validate();
+
+    /**
+     * @brief Clears the store and writes its header and checksum.
+     */
+    void initialize();
+
+    Config config_;                ///< Crash definition, window and thresholds.
+    ESPRIC_BootLoopStore& store_;  ///< Crash window memory.
+    StoreState storeState_ = StoreState::Initialized; ///< Result of the validation.
+    bool updated_ = false;         ///< True once this boot was recorded.
+};
+
+#endif // ESPRIC_BOOTLOOP_H
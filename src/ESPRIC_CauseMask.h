@@ -0,0 +1,117 @@
+/**
+ * @file ESPRIC_CauseMask.h
+ * @brief Bitmask helpers for matching sets of reset reasons and wakeup causes.
+ * 
+ * A cause mask has bit `n` set for the reset reason or wakeup cause with value `n`. Masks of 
+ * related causes (e.g. all watchdog resets) let one condition cover the whole group and are 
+ * matched with a single AND operation.
+ */
+
+#ifndef ESPRIC_CAUSEMASK_H
+#define ESPRIC_CAUSEMASK_H
+
+#include <stdint.h>
+#include <esp_system.h>
+#include <esp_sleep.h>
+#include <esp_idf_version.h>
+
+/**
+ * @brief Bit used for reset reasons and wakeup causes with a value above 30.
+ * 
+ * No ESP-IDF cause uses this value, so specific masks never contain it, while the 
+ * "any" mask still matches such a cause.
+ */
+#define ESPRIC_CAUSE_OVERFLOW_BIT 31u
+
+/**
+ * @brief Mask that matches every reset reason or wakeup cause.
+ */
+#define ESPRIC_CAUSE_MASK_ANY 0xFFFFFFFFu
+
+/**
+ * @brief Returns the single-bit mask of a cause value.
+ * 
+ * @param value A reset reason or wakeup cause value.
+ */
+constexpr uint32_t espricCauseBit(unsigned value) {
+    return 1u << (value < ESPRIC_CAUSE_OVERFLOW_BIT ? value : ESPRIC_CAUSE_OVERFLOW_BIT);
+}
+
+/**
+ * @brief Builds a mask from a list of reset reasons.
+ * 
+ * @code{.cpp}
+ * constexpr uint32_t kCrash = espricResetMask(ESP_RST_PANIC, ESP_RST_TASK_WDT);
+ * @endcode
+ */
+template <typename... Reasons>
+constexpr uint32_t espricResetMask(Reasons... reasons) {
+    return (0u | ... | espricCauseBit(static_cast<unsigned>(static_cast<esp_reset_reason_t>(reasons))));
+}
+
+/**
+ * @brief Builds a mask from a list of wakeup causes.
+ */
+template <typename... Causes>
+constexpr uint32_t espricWakeupMask(Causes... causes) {
+    return (0u | ... | espricCauseBit(static_cast<unsigned>(static_cast<esp_sleep_wakeup_cause_t>(causes))));
+}
+
+/**
+ * @brief All watchdog resets.
+ */
+constexpr uint32_t ESPRIC_RESET_MASK_ANY_WATCHDOG = espricResetMask(ESP_RST_INT_WDT, ESP_RST_TASK_WDT, ESP_RST_WDT);
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+/**
+ * @brief All resets caused by the power supply.
+ */
+constexpr uint32_t ESPRIC_RESET_MASK_ANY_POWER = espricResetMask(ESP_RST_BROWNOUT, ESP_RST_PWR_GLITCH);
+
+/**
+ * @brief All resets caused by a firmware crash (panic, watchdogs, CPU lockup).
+ */
+constexpr uint32_t ESPRIC_RESET_MASK_ANY_CRASH = espricResetMask(ESP_RST_PANIC, ESP_RST_INT_WDT, ESP_RST_TASK_WDT,
+                                                                 ESP_RST_WDT, ESP_RST_CPU_LOCKUP);
+#else
+constexpr uint32_t ESPRIC_RESET_MASK_ANY_POWER = espricResetMask(ESP_RST_BROWNOUT);
+constexpr uint32_t ESPRIC_RESET_MASK_ANY_CRASH = espricResetMask(ESP_RST_PANIC, ESP_RST_INT_WDT, ESP_RST_TASK_WDT,
+                                                                 ESP_RST_WDT);
+#endif
+
+/**
+ * @brief All wakeups caused by an external signal (EXT0, EXT1, GPIO).
+ */
+constexpr uint32_t ESPRIC_WAKEUP_MASK_ANY_EXTERNAL = espricWakeupMask(ESP_SLEEP_WAKEUP_EXT0, ESP_SLEEP_WAKEUP_EXT1,
+                                                                      ESP_SLEEP_WAKEUP_GPIO);
+
+/**
+ * @brief Packs a reset and a wakeup mask into one 64-bit match word.
+ * 
+ * @param resetMask Accepted reset reasons, 0 for any.
+ * @param wakeupMask Accepted wakeup causes, 0 for any.
+ * 
+ * The reset mask occupies the low and the wakeup mask the high 32 bits. A state word built 
+ * with `espricPackState()` matches if both halves of `state & mask` are non-zero.
+ */
+constexpr uint64_t espricPackMask(uint32_t resetMask, uint32_t wakeupMask) {
+    return static_cast<uint64_t>(resetMask ? resetMask : ESPRIC_CAUSE_MASK_ANY) |
+           (static_cast<uint64_t>(wakeupMask ? wakeupMask : ESPRIC_CAUSE_MASK_ANY) << 32);
+}
+
+/**
+ * @brief Packs a reset reason and a wakeup cause into a 64-bit state word.
+ */
+constexpr uint64_t espricPackState(esp_reset_reason_t reason, esp_sleep_wakeup_cause_t cause) {
+    return static_cast<uint64_t>(espricCauseBit(static_cast<unsigned>(reason))) |
+           (static_cast<uint64_t>(espricCauseBit(static_cast<unsigned>(cause))) << 32);
+}
+
+/**
+ * @brief Tests a packed mask against a packed state word.
+ */
+constexpr bool espricMaskMatches(uint64_t state, uint64_t mask) {
+    return static_cast<uint32_t>(state & mask) != 0 && ((state & mask) >> 32) != 0;
+}
+
+#endif // ESPRIC_CAUSEMASK_H
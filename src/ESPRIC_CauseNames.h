@@ -0,0 +1,99 @@
+/**
+ * @file ESPRIC_CauseNames.h
+ * @brief Names and messages of reset reasons and wakeup causes, indexed by their numeric value.
+ *
+ * The tables are shared by the condition sets in `variants/ESPRIC_Conditions.h` and by host
+ * tools that decode logged values, so device output and decoded logs use the same wording. The
+ * header depends on the C++ standard library only; the indices follow `esp_reset_reason_t` and
+ * `esp_sleep_wakeup_cause_t` of ESP-IDF 5 (checked in `ESPRIC_Conditions.h`).
+ */
+
+#ifndef ESPRIC_CAUSENAMES_H
+#define ESPRIC_CAUSENAMES_H
+
+#include <stddef.h>
+
+/**
+ * @struct ESPRIC_CauseName
+ * @brief Enumerator name and human-readable message of one cause.
+ */
+struct ESPRIC_CauseName {
+    const char* name;    ///< Enumerator name, e.g. `ESP_RST_PANIC`.
+    const char* message; ///< Message printed when the cause is detected.
+};
+
+/**
+ * @brief Reset reasons, indexed by `esp_reset_reason_t`.
+ */
+static constexpr ESPRIC_CauseName ESPRIC_RESET_REASON_NAMES[] = {
+    {"ESP_RST_UNKNOWN", "Unknown reset detected."},
+    {"ESP_RST_POWERON", "Power-on reset detected."},
+    {"ESP_RST_EXT", "External signal reset detected."},
+    {"ESP_RST_SW", "Software reset detected."},
+    {"ESP_RST_PANIC", "Panic reset detected."},
+    {"ESP_RST_INT_WDT", "Interrupt watchdog reset detected."},
+    {"ESP_RST_TASK_WDT", "Task watchdog reset detected."},
+    {"ESP_RST_WDT", "General watchdog reset detected."},
+    {"ESP_RST_DEEPSLEEP", "Deep sleep wake-up reset detected."},
+    {"ESP_RST_BROWNOUT", "Brownout reset detected."},
+    {"ESP_RST_SDIO", "SDIO reset detected."},
+    {"ESP_RST_USB", "USB reset detected."},
+    {"ESP_RST_JTAG", "JTAG reset detected."},
+    {"ESP_RST_EFUSE", "eFuse reset detected."},
+    {"ESP_RST_PWR_GLITCH", "Power glitch reset detected."},
+    {"ESP_RST_CPU_LOCKUP", "CPU lockup reset detected."}
+};
+
+/**
+ * @brief Wakeup causes, indexed by `esp_sleep_wakeup_cause_t`.
+ */
+static constexpr ESPRIC_CauseName ESPRIC_WAKEUP_CAUSE_NAMES[] = {
+    {"ESP_SLEEP_WAKEUP_UNDEFINED", "No defined wakeup cause."},
+    {"ESP_SLEEP_WAKEUP_ALL", "Not a wakeup cause."},
+    {"ESP_SLEEP_WAKEUP_EXT0", "Wakeup caused by external signal via RTC_IO."},
+    {"ESP_SLEEP_WAKEUP_EXT1", "Wakeup caused by external signal via RTC_CNTL."},
+    {"ESP_SLEEP_WAKEUP_TIMER", "Wakeup caused by timer."},
+    {"ESP_SLEEP_WAKEUP_TOUCHPAD", "Wakeup caused by touchpad interrupt."},
+    {"ESP_SLEEP_WAKEUP_ULP", "Wakeup caused by ULP program."},
+    {"ESP_SLEEP_WAKEUP_GPIO", "Wakeup caused by GPIO (light sleep only)."},
+    {"ESP_SLEEP_WAKEUP_UART", "Wakeup caused by UART (light sleep only)."},
+    {"ESP_SLEEP_WAKEUP_WIFI", "Wakeup caused by WiFi (light sleep only)."},
+    {"ESP_SLEEP_WAKEUP_COCPU", "Wakeup caused by co-processor interrupt."},
+    {"ESP_SLEEP_WAKEUP_COCPU_TRAP_TRIG", "Wakeup caused by co-processor crash."},
+    {"ESP_SLEEP_WAKEUP_BT", "Wakeup caused by Bluetooth (light sleep only)."}
+};
+
+static constexpr size_t ESPRIC_RESET_REASON_NAME_COUNT =
+    sizeof(ESPRIC_RESET_REASON_NAMES) / sizeof(ESPRIC_RESET_REASON_NAMES[0]); ///< Entries of the reset table.
+static constexpr size_t ESPRIC_WAKEUP_CAUSE_NAME_COUNT =
+    sizeof(ESPRIC_WAKEUP_CAUSE_NAMES) / sizeof(ESPRIC_WAKEUP_CAUSE_NAMES[0]); ///< Entries of the wakeup table.
+
+/**
+ * @brief Returns the enumerator name of a reset reason, or `nullptr` for unknown values.
+ */
+constexpr const char* espricResetReasonName(unsigned reason) {
+    return reason < ESPRIC_RESET_REASON_NAME_COUNT ? ESPRIC_RESET_REASON_NAMES[reason].name : nullptr;
+}
+
+/**
+ * @brief Returns the message of a reset reason, or `nullptr` for unknown values.
+ */
+constexpr const char* espricResetReasonMessage(unsigned reason) {
+    return reason < ESPRIC_RESET_REASON_NAME_COUNT ? ESPRIC_RESET_REASON_NAMES[reason].message : nullptr;
+}
+
+/**
+ * @brief Returns the enumerator name of a wakeup cause, or `nullptr` for unknown values.
+ */
+constexpr const char* espricWakeupCauseName(unsigned cause) {
+    return cause < ESPRIC_WAKEUP_CAUSE_NAME_COUNT ? ESPRIC_WAKEUP_CAUSE_NAMES[cause].name : nullptr;
+}
+
+/**
+ * @brief Returns the message of a wakeup cause, or `nullptr` for unknown values.
+ */
+constexpr const char* espricWakeupCauseMessage(unsigned cause) {
+    return cause < ESPRIC_WAKEUP_CAUSE_NAME_COUNT ? ESPRIC_WAKEUP_CAUSE_NAMES[cause].message : nullptr;
+}
+
+#endif // ESPRIC_CAUSENAMES_H
@@ -0,0 +1,79 @@
+/**
+ * @file ESPRIC_Cbor.cpp
+ * @brief Implementation of the CBOR boot report encoder.
+ */
+
+#include "ESPRIC_Cbor.h"
+
+size_t espricEncodeBootReport(uint8_t* buffer, size_t capacity, const ESPRIC_StartupContext& context,
+                              const ESPRIC::AnalysisResult& result, const ESPRIC_TimingReport* timing,
+                              const ESPRIC_ResetStatistics* statistics) {
+    const bool bootLoop = context.bootLoopState != ESPRIC_BootLoopState::Normal || context.recentCrashes != 0;
+    size_t pairs = 5;
+    if (timing != nullptr) {
+        pairs += 2;
+    }
+    if (statistics != nullptr) {
+        pairs++;
+    }
+    if (bootLoop) {
+        pairs++;
+    }
+
+    ESPRIC_CborWriter writer(buffer, capacity);
+    writer.map(pairs);
+    writer.unsignedInt(ESPRIC_CBOR_KEY_VERSION);
+    writer.unsignedInt(ESPRIC_CBOR_VERSION);
+    writer.unsignedInt(ESPRIC_CBOR_KEY_RESET_REASON);
+    writer.unsignedInt(static_cast<uint32_t>(context.resetReason));
+    writer.unsignedInt(ESPRIC_CBOR_KEY_WAKEUP_CAUSE);
+    writer.unsignedInt(static_cast<uint32_t>(context.wakeupCause));
+    writer.unsignedInt(ESPRIC_CBOR_KEY_UPTIME);
+    writer.signedInt(context.uptimeUs);
+
+    writer.unsignedInt(ESPRIC_CBOR_KEY_RESULT);
+    writer.array(6);
+    writer.unsignedInt(result.matched);
+    writer.unsignedInt(result.unmatched);
+    writer.unsignedInt(result.skipped);
+    writer.unsignedInt(result.deferred);
+    writer.unsignedInt(result.gated);
+    writer.unsignedInt(static_cast<uint8_t>(result.policy));
+
+    if (timing != nullptr) {
+        size_t matched = 0;
+        for (size_t i = 0; i < timing->entryCount; i++) {
+            matched += timing->entries[i].callback.count != 0;
+        }
+        writer.unsignedInt(ESPRIC_CBOR_KEY_MATCHED);
+        writer.array(matched);
+        for (size_t i = 0; i < timing->entryCount; i++) {
+            if (timing->entries[i].callback.count != 0) {
+                writer.unsignedInt(i);
+            }
+        }
+
+        const uint32_t analyses = timing->analyses.count != 0 ? timing->analyses.count : 1;
+        writer.unsignedInt(ESPRIC_CBOR_KEY_TIMING);
+        writer.array(3);
+        writer.unsignedInt(timing->analyses.totalNs / analyses);
+        writer.unsignedInt(timing->predicates.totalNs / analyses);
+        writer.unsignedInt(timing->callbacks.totalNs / analyses);
+    }
+
+    if (statistics != nullptr) {
+        writer.unsignedInt(ESPRIC_CBOR_KEY_COUNTERS);
+        writer.array(3);
+        writer.unsignedInt(statistics->boots());
+        writer.unsignedInt(statistics->resetCount(context.resetReason));
+        writer.unsignedInt(statistics->wakeupCount(context.wakeupCause));
+    }
+
+    if (bootLoop) {
+        writer.unsignedInt(ESPRIC_CBOR_KEY_BOOT_LOOP);
+        writer.array(2);
+        writer.unsignedInt(static_cast<uint8_t>(context.bootLoopState));
+        writer.unsignedInt(context.recentCrashes);
+    }
+    return writer.overflow() ? 0 : writer.size();
+}
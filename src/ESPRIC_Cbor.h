@@ -0,0 +1,51 @@
+/**
+ * @file ESPRIC_Cbor.h
+ * @brief Encodes the boot context and analysis result as a compact CBOR report.
+ *
+ * `espricEncodeBootReport()` writes the report of `ESPRIC_CborFormat.h` straight from the
+ * analyzer's structures into a caller-provided buffer: no strings, no heap, no intermediate
+ * copy. A typical report takes 20 to 60 bytes, small enough for one MQTT message, a LoRa or
+ * BLE payload or an RTC memory slot. `tools/CborReportDecoder` prints reports on a host.
+ *
+ * @code{.cpp}
+ * static ESPRIC_TimingReport timing;
+ * uint8_t payload[ESPRIC_CBOR_REPORT_SIZE];
+ * const ESPRIC::StartupContext context = ESPRIC::StartupContext::capture();
+ * const ESPRIC::AnalysisResult result = analyzer.analyze(context, timing);
+ * const size_t size = espricEncodeBootReport(payload, sizeof(payload), context, result, &timing);
+ * mqtt.publish("device/boot", payload, size);
+ * @endcode
+ */
+
+#ifndef ESPRIC_CBOR_H
+#define ESPRIC_CBOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ESPRIC.h"
+#include "ESPRIC_CborFormat.h"
+#include "ESPRIC_ResetStatistics.h"
+
+/**
+ * @brief Buffer size that holds any report, all optional keys and matched ids included.
+ */
+#define ESPRIC_CBOR_REPORT_SIZE (96 + 2 * ESPRIC_TIMING_MAX_ENTRIES)
+
+/**
+ * @brief Encodes a boot report into `buffer`.
+ *
+ * @param context Startup context of the analysis. The boot-loop key is added if its state is not
+ *        `Normal` or it counts recent crashes.
+ * @param result Result of the analysis.
+ * @param timing (Optional) Timing report of the analysis: adds the indices of the conditions
+ *        whose callback ran and the mean durations per analysis. Indices are taken from the
+ *        callback counts, so call `reset()` before each analysis to report only its matches.
+ * @param statistics (Optional) Persistent counters: adds the number of boots and the counts of
+ *        this reset reason and wakeup cause.
+ * @return Size of the report in bytes, or 0 if `capacity` is too small.
+ */
+size_t espricEncodeBootReport(uint8_t* buffer, size_t capacity, const ESPRIC_StartupContext& context,
+                              const ESPRIC::AnalysisResult& result, const ESPRIC_TimingReport* timing = nullptr,
+                              const ESPRIC_ResetStatistics* statistics = nullptr);
+
+#endif // ESPRIC_CBOR_H
@@ -0,0 +1,455 @@
+/**
+ * @file ESPRIC_CborFormat.h
+ * @brief CBOR writer, reader and schema of the compact ESPRIC boot report.
+ *
+ * A boot report is one CBOR map (RFC 8949) with small integer keys, so a typical report takes
+ * a few dozen bytes. Absent optional keys cost nothing; readers skip keys they do not know, so
+ * new keys can be appended without breaking older decoders.
+ *
+ * | Key | Value |
+ * |---|---|
+ * | 0 | schema version (`ESPRIC_CBOR_VERSION`) |
+ * | 1 | reset reason (`esp_reset_reason_t`) |
+ * | 2 | wakeup cause (`esp_sleep_wakeup_cause_t`) |
+ * | 3 | uptime in microseconds |
+ * | 4 | `[matched, unmatched, skipped, deferred, gated, policy]` |
+ * | 5 | `[id, ...]`: indices of the conditions whose callback ran (optional) |
+ * | 6 | `[analysis, predicates, callbacks]`: mean nanoseconds per analysis (optional) |
+ * | 7 | `[boots, this reset reason, this wakeup cause]`: persistent counters (optional) |
+ * | 8 | `[boot-loop state, recent crashes]`: only if a boot loop is suspected (optional) |
+ *
+ * The writer encodes straight into a caller-provided buffer and never writes past its end;
+ * the reader decodes from a buffer without copying. Several reports may be concatenated
+ * (a CBOR sequence, RFC 8742), e.g. in a file or an upload.
+ *
+ * This header depends on the C++ standard library only, so the device and the host decoder
+ * (`tools/CborReportDecoder`) compile the same code.
+ */
+
+#ifndef ESPRIC_CBORFORMAT_H
+#define ESPRIC_CBORFORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Condition ids kept by `ESPRIC_CborBootReport`; further ids are counted as truncated.
+ */
+#ifndef ESPRIC_CBOR_MAX_IDS
+#define ESPRIC_CBOR_MAX_IDS 32
+#endif
+
+static constexpr uint32_t ESPRIC_CBOR_VERSION = 1; ///< Schema version written to key 0.
+
+/**
+ * @enum ESPRIC_CborKey
+ * @brief Map keys of the boot report. Append only.
+ */
+enum ESPRIC_CborKey : uint8_t {
+    ESPRIC_CBOR_KEY_VERSION,
+    ESPRIC_CBOR_KEY_RESET_REASON,
+    ESPRIC_CBOR_KEY_WAKEUP_CAUSE,
+    ESPRIC_CBOR_KEY_UPTIME,
+    ESPRIC_CBOR_KEY_RESULT,
+    ESPRIC_CBOR_KEY_MATCHED,
+    ESPRIC_CBOR_KEY_TIMING,
+    ESPRIC_CBOR_KEY_COUNTERS,
+    ESPRIC_CBOR_KEY_BOOT_LOOP
+};
+
+/**
+ * @enum ESPRIC_CborMajor
+ * @brief CBOR major types used by the report.
+ */
+enum ESPRIC_CborMajor : uint8_t {
+    ESPRIC_CBOR_UNSIGNED = 0, ///< Unsigned integer.
+    ESPRIC_CBOR_NEGATIVE = 1, ///< Negative integer, `-1 - value`.
+    ESPRIC_CBOR_BYTES = 2,    ///< Byte string.
+    ESPRIC_CBOR_TEXT = 3,     ///< UTF-8 text string.
+    ESPRIC_CBOR_ARRAY = 4,    ///< Array of items.
+    ESPRIC_CBOR_MAP = 5,      ///< Map of key and value items.
+    ESPRIC_CBOR_TAG = 6,      ///< Tagged item.
+    ESPRIC_CBOR_SIMPLE = 7    ///< Simple values and floats.
+};
+
+/**
+ * @class ESPRIC_CborWriter
+ * @brief Encodes CBOR items into a fixed buffer, shortest form, definite lengths.
+ *
+ * An item that does not fit sets `overflow()` and is dropped together with all later items;
+ * the buffer is never written past `capacity`.
+ */
+class ESPRIC_CborWriter {
+public:
+    /**
+     * @param buffer Destination of the encoded items.
+     * @param capacity Size of `buffer` in bytes.
+     */
+    ESPRIC_CborWriter(uint8_t* buffer, size_t capacity) : buffer_(buffer), capacity_(capacity) {}
+
+    /**
+     * @brief Writes an unsigned integer.
+     */
+    void unsignedInt(uint64_t value) { head(ESPRIC_CBOR_UNSIGNED, value); }
+
+    /**
+     * @brief Writes a signed integer as an unsigned or negative integer.
+     */
+    void signedInt(int64_t value) {
+        if (value >= 0) {
+            head(ESPRIC_CBOR_UNSIGNED, static_cast<uint64_t>(value));
+        } else {
+            head(ESPRIC_CBOR_NEGATIVE, static_cast<uint64_t>(-1 - value));
+        }
+    }
+
+    /**
+     * @brief Starts an array of `count` items.
+     */
+    void array(size_t count) { head(ESPRIC_CBOR_ARRAY, count); }
+
+    /**
+     * @brief Starts a map of `count` key and value pairs.
+     */
+    void map(size_t count) { head(ESPRIC_CBOR_MAP, count); }
+
+    /**
+     * @brief Returns the number of bytes written.
+     */
+    size_t size() const { return size_; }
+
+    /**
+     * @brief Returns `true` if an item did not fit into the buffer.
+     */
+    bool overflow() const { return overflow_; }
+
+private:
+    /**
+     * @brief Writes the initial byte and the argument of an item.
+     */
+    void head(uint8_t major, uint64_t value) {
+        uint8_t bytes = 0; // Argument bytes after the initial byte
+        uint8_t info = 0;
+        if (value < 24) {
+            info = static_cast<uint8_t>(value);
+        } else if (value <= 0xFF) {
+            info = 24;
+            bytes = 1;
+        } else if (value <= 0xFFFF) {
+            info = 25;
+            bytes = 2;
+        } else if (value <= 0xFFFFFFFFu) {
+            info = 26;
+            bytes = 4;
+        } else {
+            info = 27;
+            bytes = 8;
+        }
+        if (overflow_ || capacity_ - size_ < 1u + bytes) {
+            overflow_ = true;
+            return;
+        }
+        buffer_[size_++] = static_cast<uint8_t>(major << 5 | info);
+        for (int shift = 8 * (bytes - 1); shift >= 0; shift -= 8) {
+            buffer_[size_++] = static_cast<uint8_t>(value >> shift); // Big-endian
+        }
+    }
+
+    uint8_t* buffer_;       ///< Destination.
+    size_t capacity_;       ///< Size of `buffer_`.
+    size_t size_ = 0;       ///< Bytes written.
+    bool overflow_ = false; ///< An item did not fit.
+};
+
+/**
+ * @class ESPRIC_CborReader
+ * @brief Decodes CBOR items from a buffer without copying.
+ *
+ * Any malformed, truncated or unsupported item (indefinite lengths, nesting deeper than
+ * 8 levels) sets `error()`; all later reads fail.
+ */
+class ESPRIC_CborReader {
+public:
+    /**
+     * @param data Encoded items.
+     * @param size Size of `data` in bytes.
+     */
+    ESPRIC_CborReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+    /**
+     * @brief Reads the initial byte and the argument of the next item.
+     *
+     * For strings the argument is the length, for arrays and maps the number of items or
+     * pairs; their content follows.
+     */
+    bool head(uint8_t& major, uint64_t& value) {
+        if (error_ || offset_ >= size_) {
+            error_ = true;
+            return false;
+        }
+        const uint8_t initial = data_[offset_++];
+        major = initial >> 5;
+        const uint8_t info = initial & 0x1F;
+        if (info < 24) {
+            value = info;
+            return true;
+        }
+        if (info > 27) {
+            error_ = true; // Reserved values and indefinite lengths
+            return false;
+        }
+        const size_t bytes = size_t(1) << (info - 24);
+        if (size_ - offset_ < bytes) {
+            error_ = true;
+            return false;
+        }
+        value = 0;
+        for (size_t i = 0; i < bytes; i++) {
+            value = value << 8 | data_[offset_++];
+        }
+        return true;
+    }
+
+    /**
+     * @brief Reads an unsigned integer.
+     */
+    bool unsignedInt(uint64_t& value) {
+        uint8_t major = 0;
+        if (!head(major, value) || major != ESPRIC_CBOR_UNSIGNED) {
+            error_ = true;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Reads an unsigned or negative integer.
+     */
+    bool signedInt(int64_t& value) {
+        uint8_t major = 0;
+        uint64_t raw = 0;
+        if (!head(major, raw) || (major != ESPRIC_CBOR_UNSIGNED && major != ESPRIC_CBOR_NEGATIVE) || raw > INT64_MAX) {
+            error_ = true;
+            return false;
+        }
+        value = major == ESPRIC_CBOR_UNSIGNED ? static_cast<int64_t>(raw) : -1 - static_cast<int64_t>(raw);
+        return true;
+    }
+
+    /**
+     * @brief Reads the header of an array.
+     *
+     * @param count Number of items that follow.
+     */
+    bool array(uint64_t& count) {
+        uint8_t major = 0;
+        if (!head(major, count) || major != ESPRIC_CBOR_ARRAY) {
+            error_ = true;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Skips the next item including its content.
+     */
+    bool skip() { return skip(0); }
+
+    /**
+     * @brief Returns the offset of the next item.
+     */
+    size_t offset() const { return offset_; }
+
+    /**
+     * @brief Returns `true` after a malformed item.
+     */
+    bool error() const { return error_; }
+
+private:
+    /**
+     * @brief Skips an item at the given nesting depth.
+     */
+    bool skip(int depth) {
+        uint8_t major = 0;
+        uint64_t value = 0;
+        if (depth > 8 || !head(major, value)) {
+            error_ = true;
+            return false;
+        }
+        switch (major) {
+        case ESPRIC_CBOR_BYTES:
+        case ESPRIC_CBOR_TEXT:
+            if (size_ - offset_ < value) {
+                error_ = true;
+                return false;
+            }
+            offset_ += static_cast<size_t>(value);
+            return true;
+        case ESPRIC_CBOR_ARRAY:
+        case ESPRIC_CBOR_MAP: {
+            const uint64_t items = major == ESPRIC_CBOR_MAP ? 2 * value : value;
+            for (uint64_t i = 0; i < items; i++) {
+                if (!skip(depth + 1)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case ESPRIC_CBOR_TAG:
+            return skip(depth + 1);
+        default:
+            return true; // Integers and simple values carry no content
+        }
+    }
+
+    const uint8_t* data_;  ///< Encoded items.
+    size_t size_;          ///< Size of `data_`.
+    size_t offset_ = 0;    ///< Offset of the next item.
+    bool error_ = false;   ///< A read failed.
+};
+
+/**
+ * @struct ESPRIC_CborBootReport
+ * @brief Decoded boot report; fields of absent optional keys keep their defaults.
+ */
+struct ESPRIC_CborBootReport {
+    uint32_t version = 0;      ///< Schema version.
+    uint32_t resetReason = 0;  ///< `esp_reset_reason_t`.
+    uint32_t wakeupCause = 0;  ///< `esp_sleep_wakeup_cause_t`.
+    int64_t uptimeUs = 0;      ///< Uptime at the analysis in microseconds.
+    uint32_t matched = 0;      ///< Conditions that were met.
+    uint32_t unmatched = 0;    ///< Conditions that were not met.
+    uint32_t skipped = 0;      ///< Conditions and handlers skipped by an early exit.
+    uint32_t deferred = 0;     ///< Matched conditions whose callback was queued.
+    uint32_t gated = 0;        ///< Entries skipped by a failed group gate.
+    uint32_t policy = 0;       ///< `ESPRIC::EvaluationPolicy`.
+
+    bool hasMatchedIds = false;            ///< Key 5 was present.
+    uint32_t matchedIds[ESPRIC_CBOR_MAX_IDS] = {}; ///< Indices of the conditions whose callback ran.
+    uint32_t matchedIdCount = 0;           ///< Valid entries of `matchedIds`.
+    uint32_t matchedIdsTruncated = 0;      ///< Ids that did not fit into `matchedIds`.
+
+    bool hasTiming = false;    ///< Key 6 was present.
+    uint32_t analysisNs = 0;   ///< Mean duration of an analysis.
+    uint32_t predicatesNs = 0; ///< Mean predicate time per analysis.
+    uint32_t callbacksNs = 0;  ///< Mean callback time per analysis.
+
+    bool hasCounters = false;  ///< Key 7 was present.
+    uint32_t boots = 0;        ///< Boots recorded by `ESPRIC_ResetStatistics`.
+    uint32_t resetCount = 0;   ///< Boots with this reset reason.
+    uint32_t wakeupCount = 0;  ///< Boots with this wakeup cause.
+
+    bool hasBootLoop = false;  ///< Key 8 was present.
+    uint32_t bootLoopState = 0; ///< `ESPRIC_BootLoopState`.
+    uint32_t recentCrashes = 0; ///< Crashes within the detector window.
+};
+
+/**
+ * @brief Reads an array of up to `capacity` unsigned integers; missing entries stay 0.
+ */
+inline bool espricCborReadArray(ESPRIC_CborReader& reader, uint32_t* const* values, size_t capacity) {
+    uint64_t count = 0;
+    if (!reader.array(count)) {
+        return false;
+    }
+    for (uint64_t i = 0; i < count; i++) {
+        uint64_t value = 0;
+        if (i < capacity ? !reader.unsignedInt(value) : !reader.skip()) {
+            return false;
+        }
+        if (i < capacity) {
+            *values[i] = static_cast<uint32_t>(value);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Decodes one boot report from the start of `data`.
+ *
+ * @param consumed Size of the report in bytes, to continue with the next one of a sequence.
+ * @return `false` if the data does not start with a complete, well-formed report.
+ */
+inline bool espricCborDecodeBootReport(const uint8_t* data, size_t size, ESPRIC_CborBootReport& report,
+                                       size_t& consumed) {
+    report = ESPRIC_CborBootReport();
+    ESPRIC_CborReader reader(data, size);
+    uint8_t major = 0;
+    uint64_t pairs = 0;
+    if (!reader.head(major, pairs) || major != ESPRIC_CBOR_MAP) {
+        return false;
+    }
+    for (uint64_t pair = 0; pair < pairs; pair++) {
+        uint64_t key = 0;
+        uint64_t value = 0;
+        bool ok = reader.unsignedInt(key);
+        if (!ok) {
+            return false;
+        }
+        switch (key) {
+        case ESPRIC_CBOR_KEY_VERSION:
+            ok = reader.unsignedInt(value);
+            report.version = static_cast<uint32_t>(value);
+            break;
+        case ESPRIC_CBOR_KEY_RESET_REASON:
+            ok = reader.unsignedInt(value);
+            report.resetReason = static_cast<uint32_t>(value);
+            break;
+        case ESPRIC_CBOR_KEY_WAKEUP_CAUSE:
+            ok = reader.unsignedInt(value);
+            report.wakeupCause = static_cast<uint32_t>(value);
+            break;
+        case ESPRIC_CBOR_KEY_UPTIME:
+            ok = reader.signedInt(report.uptimeUs);
+            break;
+        case ESPRIC_CBOR_KEY_RESULT: {
+            uint32_t* const fields[] = {&report.matched, &report.unmatched, &report.skipped,
+                                        &report.deferred, &report.gated, &report.policy};
+            ok = espricCborReadArray(reader, fields, 6);
+            break;
+        }
+        case ESPRIC_CBOR_KEY_MATCHED: {
+            uint64_t count = 0;
+            ok = reader.array(count);
+            for (uint64_t i = 0; ok && i < count; i++) {
+                ok = reader.unsignedInt(value);
+                if (report.matchedIdCount < ESPRIC_CBOR_MAX_IDS) {
+                    report.matchedIds[report.matchedIdCount++] = static_cast<uint32_t>(value);
+                } else {
+                    report.matchedIdsTruncated++;
+                }
+            }
+            report.hasMatchedIds = true;
+            break;
+        }
+        case ESPRIC_CBOR_KEY_TIMING: {
+            uint32_t* const fields[] = {&report.analysisNs, &report.predicatesNs, &report.callbacksNs};
+            ok = espricCborReadArray(reader, fields, 3);
+            report.hasTiming = true;
+            break;
+        }
+        case ESPRIC_CBOR_KEY_COUNTERS: {
+            uint32_t* const fields[] = {&report.boots, &report.resetCount, &report.wakeupCount};
+            ok = espricCborReadArray(reader, fields, 3);
+            report.hasCounters = true;
+            break;
+        }
+        case ESPRIC_CBOR_KEY_BOOT_LOOP: {
+            uint32_t* const fields[] = {&report.bootLoopState, &report.recentCrashes};
+            ok = espricCborReadArray(reader, fields, 2);
+            report.hasBootLoop = true;
+            break;
+        }
+        default:
+            ok = reader.skip(); // Key of a newer schema
+            break;
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    consumed = reader.offset();
+    return true;
+}
+
+#endif // ESPRIC_CBORFORMAT_H
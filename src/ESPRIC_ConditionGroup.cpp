@@ -0,0 +1,38 @@
+/**
+ * @file ESPRIC_ConditionGroup.cpp
+ * @brief Implementation of the gated condition group builder.
+ */
+
+#include "ESPRIC_ConditionGroup.h"
+
+ESPRIC_ConditionGroup::ESPRIC_ConditionGroup(const Condition& gate, int priority) {
+    Entry entry;
+    entry.condition = gate;
+    entry.priority = priority;
+    entry.gate = true;
+    entries_.push_back(std::move(entry));
+}
+
+ESPRIC_ConditionGroup& ESPRIC_ConditionGroup::add(const Condition& condition, const Callback& callback, int priority,
+                                                  CallbackMode mode) {
+    entries_.push_back({condition, callback, priority, mode});
+    updateSpan();
+    return *this;
+}
+
+ESPRIC_ConditionGroup& ESPRIC_ConditionGroup::add(const std::vector<Entry>& conditions) {
+    entries_.insert(entries_.end(), conditions.begin(), conditions.end());
+    updateSpan();
+    return *this;
+}
+
+ESPRIC_ConditionGroup& ESPRIC_ConditionGroup::add(const ESPRIC_ConditionGroup& group) {
+    entries_.insert(entries_.end(), group.entries_.begin(), group.entries_.end());
+    updateSpan();
+    return *this;
+}
+
+void ESPRIC_ConditionGroup::updateSpan() {
+    // 65535 entries exceed the RAM of every ESP32, so the 16-bit span cannot overflow in practice
+    entries_.front().span = static_cast<uint16_t>(entries_.size() - 1);
+}
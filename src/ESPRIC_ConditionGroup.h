@@ -0,0 +1,97 @@
+/**
+ * @file ESPRIC_ConditionGroup.h
+ * @brief Hierarchical condition groups behind a gate predicate.
+ *
+ * A group is a gate condition followed by its members, which may be conditions or further
+ * groups. The group is stored flat, in pre-order: the gate records how many entries follow it
+ * (`ESPRIC_Condition::span`), so `ESPRIC::analyze()` skips a whole subtree with a single jump
+ * when the gate fails. On a typical boot only the gates on the path to the matching conditions
+ * are evaluated instead of every condition.
+ *
+ * @code{.cpp}
+ * ESPRIC_ConditionGroup deepSleep([](const ESPRIC::StartupContext& ctx) {
+ *     return ctx.resetReason == ESP_RST_DEEPSLEEP;
+ * });
+ * deepSleep.add([](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_TIMER; },
+ *               []() { Serial.println("Timer wakeup."); });
+ *
+ * ESPRIC analyzer({});
+ * analyzer.addGroup(deepSleep);
+ * @endcode
+ */
+
+#ifndef ESPRIC_CONDITIONGROUP_H
+#define ESPRIC_CONDITIONGROUP_H
+
+#include <stddef.h>
+#include <vector>
+#include "ESPRIC.h"
+
+/**
+ * @class ESPRIC_ConditionGroup
+ * @brief Builds the flattened entries of a gated condition group.
+ */
+class ESPRIC_ConditionGroup {
+public:
+    using Condition = ESPRIC::Condition;
+    using Callback = ESPRIC::Callback;
+    using CallbackMode = ESPRIC::CallbackMode;
+    using Entry = ESPRIC::ESPRIC_Condition;
+
+    /**
+     * @brief Creates an empty group.
+     *
+     * @param gate Predicate that must hold for any member to be evaluated.
+     * @param priority (Optional) Position of the group among its siblings under
+     *        `EvaluationPolicy::PriorityOrdered`.
+     */
+    explicit ESPRIC_ConditionGroup(const Condition& gate, int priority = 0);
+
+    /**
+     * @brief Adds a condition to the group.
+     *
+     * @param condition The condition logic to evaluate.
+     * @param callback The callback to execute if the condition is true.
+     * @param priority (Optional) Evaluation priority within the group, higher values first.
+     * @param mode (Optional) Where the callback runs, `CallbackMode::Immediate` by default.
+     * @return The group, for chaining.
+     */
+    ESPRIC_ConditionGroup& add(const Condition& condition, const Callback& callback, int priority = 0,
+                               CallbackMode mode = CallbackMode::Immediate);
+
+    /**
+     * @brief Adds a list of conditions, e.g. `getWakeupConditions()`, to the group.
+     *
+     * @return The group, for chaining.
+     */
+    ESPRIC_ConditionGroup& add(const std::vector<Entry>& conditions);
+
+    /**
+     * @brief Nests a group inside this group.
+     *
+     * @return The group, for chaining.
+     */
+    ESPRIC_ConditionGroup& add(const ESPRIC_ConditionGroup& group);
+
+    /**
+     * @brief Returns the gate followed by all members in pre-order.
+     *
+     * The entries can be passed to `ESPRIC::addGroup()` or to the `ESPRIC` constructors.
+     */
+    const std::vector<Entry>& entries() const { return entries_; }
+
+    /**
+     * @brief Returns the number of entries, the gate and nested gates included.
+     */
+    size_t size() const { return entries_.size(); }
+
+private:
+    /**
+     * @brief Extends the span of the gate to all entries added so far.
+     */
+    void updateSpan();
+
+    std::vector<Entry> entries_; ///< Gate at index 0, then the members.
+};
+
+#endif // ESPRIC_CONDITIONGROUP_H
@@ -0,0 +1,116 @@
+/**
+ * @file ESPRIC_Coverage.h
+ * @brief Compile-time coverage of the reset reasons and wakeup causes of a target.
+ *
+ * `ESPRIC_Coverage` compares the causes a target can report (a table of
+ * `variants/ESPRIC_TargetTables.h`) with the causes an application handles, given as cause masks.
+ * The missing causes are `constexpr` arrays of enumerator names: they live in flash, need no
+ * static constructor and cost nothing at boot unless they are printed.
+ *
+ * @code{.cpp}
+ * constexpr uint32_t kResets = ESPRIC_RESET_MASK_ANY_CRASH | espricResetMask(ESP_RST_POWERON, ESP_RST_DEEPSLEEP);
+ * constexpr uint32_t kWakeups = espricWakeupMask(ESP_SLEEP_WAKEUP_UNDEFINED, ESP_SLEEP_WAKEUP_TIMER);
+ * ESPRIC_CHECK_COVERAGE(ESPRIC_CurrentTarget, kResets, kWakeups); // Warns: ESP_RST_SW, ... unhandled
+ *
+ * for (const char* name : ESPRIC_Coverage<ESPRIC_CurrentTarget, kResets, kWakeups>::kMissingResets) {
+ *     Serial.println(name);
+ * }
+ * @endcode
+ */
+
+#ifndef ESPRIC_COVERAGE_H
+#define ESPRIC_COVERAGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <array>
+#include "ESPRIC_CauseMask.h"
+#include "ESPRIC_TargetTable.h"
+
+/**
+ * @brief Counts the entries of a cause table that are not in `handled`.
+ */
+template <size_t N>
+constexpr size_t espricCountMissing(const ESPRIC_TargetCause (&causes)[N], uint32_t handled) {
+    size_t count = 0;
+    for (size_t i = 0; i < N; i++) {
+        count += (espricCauseBit(causes[i].value) & handled) == 0;
+    }
+    return count;
+}
+
+/**
+ * @brief Returns the names of the entries of a cause table that are not in `handled`.
+ *
+ * @tparam Count Result of `espricCountMissing()` for the same table and mask.
+ */
+template <size_t Count, size_t N>
+constexpr std::array<const char*, Count> espricMissingNames(const ESPRIC_TargetCause (&causes)[N], uint32_t handled) {
+    std::array<const char*, Count> names{};
+    size_t count = 0;
+    for (size_t i = 0; i < N; i++) {
+        if ((espricCauseBit(causes[i].value) & handled) == 0) {
+            names[count++] = causes[i].name;
+        }
+    }
+    return names;
+}
+
+/**
+ * @struct ESPRIC_Coverage
+ * @brief Causes of `Target` outside the handled reset and wakeup masks.
+ *
+ * @tparam Target A table of `variants/ESPRIC_TargetTables.h`, e.g. `ESPRIC_CurrentTarget`.
+ * @tparam ResetHandled Cause mask of the handled reset reasons.
+ * @tparam WakeupHandled Cause mask of the handled wakeup causes.
+ */
+template <typename Target, uint32_t ResetHandled, uint32_t WakeupHandled>
+struct ESPRIC_Coverage {
+    static constexpr uint32_t kMissingResetMask = Target::kResetMask & ~ResetHandled;    ///< Unhandled reset reasons.
+    static constexpr uint32_t kMissingWakeupMask = Target::kWakeupMask & ~WakeupHandled; ///< Unhandled wakeup causes.
+    static constexpr bool kComplete = kMissingResetMask == 0 && kMissingWakeupMask == 0; ///< Nothing unhandled.
+
+    /// Names of the unhandled reset reasons, in enum order.
+    static constexpr auto kMissingResets =
+        espricMissingNames<espricCountMissing(Target::kResetReasons, ResetHandled)>(Target::kResetReasons, ResetHandled);
+    /// Names of the unhandled wakeup causes, in enum order.
+    static constexpr auto kMissingWakeups =
+        espricMissingNames<espricCountMissing(Target::kWakeupCauses, WakeupHandled)>(Target::kWakeupCauses, WakeupHandled);
+};
+
+/**
+ * @brief Marks incomplete coverage; the compiler prints the missing masks with the warning.
+ */
+template <uint32_t MissingResetMask, uint32_t MissingWakeupMask>
+[[deprecated("reset reasons or wakeup causes without handler (bit n = value n, see ESPRIC_Coverage)")]]
+constexpr bool espricCoverageIncomplete() {
+    return true;
+}
+
+/**
+ * @brief Backend of `ESPRIC_CHECK_COVERAGE`.
+ *
+ * @return `true` if coverage is complete or `ESPRIC_COVERAGE_STRICT` is not defined.
+ */
+template <typename Coverage>
+constexpr bool espricCheckCoverage() {
+#if defined(ESPRIC_COVERAGE_STRICT)
+    return Coverage::kComplete;
+#else
+    if constexpr (!Coverage::kComplete) {
+        return espricCoverageIncomplete<Coverage::kMissingResetMask, Coverage::kMissingWakeupMask>();
+    }
+    return true;
+#endif
+}
+
+/**
+ * @brief Warns at compile time if `Target` can report causes outside the handled masks.
+ *
+ * With `ESPRIC_COVERAGE_STRICT` defined the check fails the build instead.
+ */
+#define ESPRIC_CHECK_COVERAGE(Target, resetHandled, wakeupHandled)                                          \
+    static_assert(espricCheckCoverage<ESPRIC_Coverage<Target, (resetHandled), (wakeupHandled)>>(),           \
+                  "Reset reasons or wakeup causes without handler, see ESPRIC_Coverage<>::kMissingResets")
+
+#endif // ESPRIC_COVERAGE_H
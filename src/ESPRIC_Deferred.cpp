@@ -0,0 +1,198 @@
+/**
+ * @file ESPRIC_Deferred.cpp
+ * @brief Implementation of the deferred callback worker.
+ */
+
+#include "ESPRIC_Deferred.h"
+
+#include <utility>
+
+ESPRIC_DeferredWorker::~ESPRIC_DeferredWorker() {
+    end();
+}
+
+/**
+ * @brief Removes the oldest callback from the ring buffer.
+ */
+ESPRIC_DeferredWorker::Callback ESPRIC_DeferredWorker::take() {
+    Callback callback = std::move(queue_[head_]);
+    queue_[head_] = nullptr;
+    head_ = (head_ + 1) % ESPRIC_DEFERRED_QUEUE_LENGTH;
+    count_--;
+    return callback;
+}
+
+#if defined(ESPRIC_HOST)
+
+bool ESPRIC_DeferredWorker::begin(uint32_t, unsigned, int) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (running_) {
+        return true;
+    }
+    stopping_ = false;
+    running_ = true;
+    thread_ = std::thread(&ESPRIC_DeferredWorker::run, this);
+    return true;
+}
+
+bool ESPRIC_DeferredWorker::post(const Callback& callback) {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (!running_ || stopping_ || count_ == ESPRIC_DEFERRED_QUEUE_LENGTH) {
+            return false;
+        }
+        queue_[(head_ + count_) % ESPRIC_DEFERRED_QUEUE_LENGTH] = callback;
+        count_++;
+    }
+    changed_.notify_all();
+    return true;
+}
+
+size_t ESPRIC_DeferredWorker::pending() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return count_ + active_;
+}
+
+void ESPRIC_DeferredWorker::waitIdle() const {
+    std::unique_lock<std::mutex> guard(lock_);
+    changed_.wait(guard, [this] { return !running_ || count_ + active_ == 0; });
+}
+
+void ESPRIC_DeferredWorker::end() {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (!running_) {
+            return;
+        }
+        stopping_ = true;
+    }
+    changed_.notify_all();
+    thread_.join();
+    std::lock_guard<std::mutex> guard(lock_);
+    running_ = false;
+}
+
+/**
+ * @brief Runs callbacks until `end()` is called and the queue is drained.
+ */
+void ESPRIC_DeferredWorker::run() {
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        changed_.wait(guard, [this] { return count_ > 0 || stopping_; });
+        if (count_ == 0) {
+            break; // Stop requested and nothing left to run
+        }
+        Callback callback = take();
+        active_ = 1;
+        guard.unlock();
+        callback();
+        guard.lock();
+        active_ = 0;
+        changed_.notify_all();
+    }
+}
+
+#else
+
+bool ESPRIC_DeferredWorker::begin(uint32_t stackSize, unsigned priority, int core) {
+    if (running_) {
+        return true;
+    }
+    if (lock_ == nullptr) {
+        lock_ = xSemaphoreCreateMutex();
+        ready_ = xSemaphoreCreateCounting(ESPRIC_DEFERRED_QUEUE_LENGTH + 1, 0);
+        if (lock_ == nullptr || ready_ == nullptr) {
+            return false;
+        }
+    }
+    stopping_ = false;
+    running_ = true;
+    const BaseType_t affinity = core < 0 ? tskNO_AFFINITY : static_cast<BaseType_t>(core);
+    if (xTaskCreatePinnedToCore(&ESPRIC_DeferredWorker::taskEntry, "espric_deferred", stackSize, this,
+                                priority, &task_, affinity) != pdPASS) {
+        running_ = false;
+        return false;
+    }
+    return true;
+}
+
+bool ESPRIC_DeferredWorker::post(const Callback& callback) {
+    if (!running_ || stopping_) {
+        return false;
+    }
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    const bool queued = count_ < ESPRIC_DEFERRED_QUEUE_LENGTH;
+    if (queued) {
+        queue_[(head_ + count_) % ESPRIC_DEFERRED_QUEUE_LENGTH] = callback;
+        count_++;
+    }
+    xSemaphoreGive(lock_);
+    if (queued) {
+        xSemaphoreGive(ready_);
+    }
+    return queued;
+}
+
+size_t ESPRIC_DeferredWorker::pending() const {
+    if (lock_ == nullptr) {
+        return 0;
+    }
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    const size_t pending = count_ + active_;
+    xSemaphoreGive(lock_);
+    return pending;
+}
+
+void ESPRIC_DeferredWorker::waitIdle() const {
+    while (running_ && pending() > 0) {
+        vTaskDelay(1);
+    }
+}
+
+void ESPRIC_DeferredWorker::end() {
+    if (!running_) {
+        return;
+    }
+    stopping_ = true;
+    xSemaphoreGive(ready_); // Wakes the worker even if the queue is empty
+    while (task_ != nullptr) {
+        vTaskDelay(1);
+    }
+    running_ = false;
+}
+
+/**
+ * @brief Task entry point: runs the worker loop and deletes the task afterwards.
+ */
+void ESPRIC_DeferredWorker::taskEntry(void* parameter) {
+    ESPRIC_DeferredWorker* worker = static_cast<ESPRIC_DeferredWorker*>(parameter);
+    worker->run();
+    worker->task_ = nullptr;
+    vTaskDelete(nullptr);
+}
+
+/**
+ * @brief Runs callbacks until `end()` is called and the queue is drained.
+ */
+void ESPRIC_DeferredWorker::run() {
+    while (true) {
+        xSemaphoreTake(ready_, portMAX_DELAY);
+        xSemaphoreTake(lock_, portMAX_DELAY);
+        if (count_ == 0) {
+            xSemaphoreGive(lock_);
+            if (stopping_) {
+                break; // Stop requested and nothing left to run
+            }
+            continue;
+        }
+        Callback callback = take();
+        active_ = 1;
+        xSemaphoreGive(lock_);
+        callback();
+        xSemaphoreTake(lock_, portMAX_DELAY);
+        active_ = 0;
+        xSemaphoreGive(lock_);
+    }
+}
+
+#endif
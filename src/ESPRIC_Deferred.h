@@ -0,0 +1,133 @@
+/**
+ * @file ESPRIC_Deferred.h
+ * @brief Background worker for deferred ESPRIC callbacks.
+ *
+ * Callbacks of conditions marked `ESPRIC::CallbackMode::Deferred` are copied into the fixed-size
+ * queue of an `ESPRIC_DeferredWorker` and run on its worker instead of inside `analyze()`. The
+ * boot path only pays for the predicates and the immediate (safety-critical) callbacks; logging,
+ * statistics and NVS writes finish while the application is already running.
+ *
+ * The worker is a FreeRTOS task on the ESP32 and a `std::thread` on a host (`ESPRIC_HOST`).
+ * Callbacks run one after another in queue order.
+ */
+
+#ifndef ESPRIC_DEFERRED_H
+#define ESPRIC_DEFERRED_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ESPRIC_InplaceFunction.h"
+
+#if defined(ESPRIC_HOST)
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#else
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#endif
+
+/**
+ * @brief Capacity of the deferred callback queue.
+ *
+ * `post()` fails when the queue is full; `ESPRIC::analyze()` then runs the callback immediately.
+ */
+#ifndef ESPRIC_DEFERRED_QUEUE_LENGTH
+#define ESPRIC_DEFERRED_QUEUE_LENGTH 16
+#endif
+
+/**
+ * @class ESPRIC_DeferredWorker
+ * @brief Runs queued callbacks on a background task.
+ *
+ * The queue stores the callbacks inline (no heap allocation per callback). Keep the worker in
+ * static storage so it outlives the analyzers that post to it.
+ */
+class ESPRIC_DeferredWorker {
+public:
+    using Callback = ESPRIC_InplaceFunction<void()>; ///< Same type as `ESPRIC::Callback`.
+
+    ESPRIC_DeferredWorker() = default;
+
+    /**
+     * @brief Runs the remaining callbacks and stops the worker.
+     */
+    ~ESPRIC_DeferredWorker();
+
+    ESPRIC_DeferredWorker(const ESPRIC_DeferredWorker&) = delete;
+    ESPRIC_DeferredWorker& operator=(const ESPRIC_DeferredWorker&) = delete;
+
+    /**
+     * @brief Starts the worker.
+     *
+     * @param stackSize Stack size of the worker task in bytes (ignored on host).
+     * @param priority FreeRTOS priority of the worker task (ignored on host).
+     * @param core Core the task is pinned to, or -1 for no affinity (ignored on host).
+     * @return `true` if the worker runs, `false` if it could not be created.
+     */
+    bool begin(uint32_t stackSize = 4096, unsigned priority = 1, int core = -1);
+
+    /**
+     * @brief Queues a callback for the worker.
+     *
+     * @param callback The callback to run.
+     * @return `false` if the worker is not running or the queue is full.
+     */
+    bool post(const Callback& callback);
+
+    /**
+     * @brief Returns the number of queued and running callbacks.
+     */
+    size_t pending() const;
+
+    /**
+     * @brief Blocks until all queued callbacks have run.
+     */
+    void waitIdle() const;
+
+    /**
+     * @brief Runs the remaining callbacks and stops the worker. `begin()` may be called again.
+     */
+    void end();
+
+    /**
+     * @brief Returns `true` while the worker runs.
+     */
+    bool running() const { return running_; }
+
+private:
+    /**
+     * @brief Worker loop: takes callbacks from the queue until `end()` is called.
+     */
+    void run();
+
+    /**
+     * @brief Removes the oldest callback; the caller holds the lock and the queue is not empty.
+     */
+    Callback take();
+
+    Callback queue_[ESPRIC_DEFERRED_QUEUE_LENGTH]; ///< Ring buffer of queued callbacks.
+    size_t head_ = 0;      ///< Index of the oldest queued callback.
+    size_t count_ = 0;     ///< Number of queued callbacks.
+    size_t active_ = 0;    ///< 1 while the worker runs a callback.
+    bool running_ = false; ///< True between `begin()` and `end()`.
+    bool stopping_ = false; ///< Set by `end()` to end the worker loop.
+
+#if defined(ESPRIC_HOST)
+    mutable std::mutex lock_;                 ///< Protects the queue.
+    mutable std::condition_variable changed_; ///< Signals new callbacks, idle and stop.
+    std::thread thread_;                      ///< Worker thread.
+#else
+    /**
+     * @brief FreeRTOS entry point; `parameter` is the worker.
+     */
+    static void taskEntry(void* parameter);
+
+    SemaphoreHandle_t lock_ = nullptr;  ///< Mutex protecting the queue.
+    SemaphoreHandle_t ready_ = nullptr; ///< Counting semaphore: one token per queued callback or stop request.
+    TaskHandle_t task_ = nullptr;       ///< Worker task, cleared by the task when it exits.
+#endif
+};
+
+#endif // ESPRIC_DEFERRED_H
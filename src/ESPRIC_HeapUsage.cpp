@@ -0,0 +1,226 @@
+/**
+ * @file ESPRIC_HeapUsage.cpp
+ * @brief Heap counter backends: counting allocator on host, `heap_caps` on ESP32.
+ */
+
+#include "ESPRIC_HeapUsage.h"
+#include <atomic>
+
+#if defined(ESPRIC_HOST)
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<uint32_t> allocations{0};   ///< Allocations since start.
+std::atomic<uint32_t> frees{0};         ///< Frees since start.
+std::atomic<size_t> allocatedBytes{0};  ///< Bytes requested since start.
+std::atomic<size_t> inUseBytes{0};      ///< Bytes currently allocated.
+std::atomic<size_t> peakBytes{0};       ///< Peak of `inUseBytes` in the innermost window.
+
+/**
+ * @brief Raises the peak to `value` if it is higher.
+ */
+void raisePeak(size_t value) {
+    size_t peak = peakBytes.load(std::memory_order_relaxed);
+    while (value > peak && !peakBytes.compare_exchange_weak(peak, value, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+void espricHeapRecordAllocation(size_t bytes) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    raisePeak(inUseBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+}
+
+void espricHeapRecordFree(size_t bytes) {
+    frees.fetch_add(1, std::memory_order_relaxed);
+    inUseBytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+ESPRIC_HeapCounters espricHeapCounters() {
+    ESPRIC_HeapCounters counters;
+    counters.allocations = allocations.load(std::memory_order_relaxed);
+    counters.frees = frees.load(std::memory_order_relaxed);
+    counters.allocatedBytes = allocatedBytes.load(std::memory_order_relaxed);
+    counters.inUseBytes = inUseBytes.load(std::memory_order_relaxed);
+    counters.peakBytes = peakBytes.load(std::memory_order_relaxed);
+    return counters;
+}
+
+/**
+ * @brief Starts a window; the peak restarts at the current usage and the outer peak is saved.
+ */
+ESPRIC_HeapMark espricHeapBegin() {
+    ESPRIC_HeapMark mark;
+    mark.start = espricHeapCounters();
+    mark.outerPeak = peakBytes.exchange(mark.start.inUseBytes, std::memory_order_relaxed);
+    mark.start.peakBytes = mark.start.inUseBytes;
+    return mark;
+}
+
+/**
+ * @brief Ends a window; the enclosing window keeps the higher of both peaks.
+ */
+ESPRIC_HeapCounters espricHeapEnd(const ESPRIC_HeapMark& mark) {
+    const ESPRIC_HeapCounters counters = espricHeapCounters();
+    raisePeak(mark.outerPeak);
+    return counters;
+}
+
+#if !defined(ESPRIC_HEAP_NO_COUNTING_ALLOCATOR)
+
+namespace {
+
+constexpr size_t kHeaderSize = alignof(std::max_align_t); ///< Size prefix, keeps the payload aligned.
+
+/**
+ * @brief Allocates `size` bytes behind a size header and records the allocation.
+ */
+void* countedAllocate(size_t size) noexcept {
+    void* block = std::malloc(size + kHeaderSize);
+    if (block == nullptr) {
+        return nullptr;
+    }
+    *static_cast<size_t*>(block) = size;
+    espricHeapRecordAllocation(size);
+    return static_cast<char*>(block) + kHeaderSize;
+}
+
+/**
+ * @brief Records and releases a block returned by `countedAllocate()`.
+ */
+void countedRelease(void* ptr) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+    void* block = static_cast<char*>(ptr) - kHeaderSize;
+    espricHeapRecordFree(*static_cast<size_t*>(block));
+    std::free(block);
+}
+
+} // namespace
+
+void* operator new(size_t size) {
+    if (void* ptr = countedAllocate(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    countedRelease(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    countedRelease(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    countedRelease(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    countedRelease(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    countedRelease(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    countedRelease(ptr);
+}
+
+#endif // !ESPRIC_HEAP_NO_COUNTING_ALLOCATOR
+
+#else
+
+#include <esp_attr.h>
+#include <esp_heap_caps.h>
+
+namespace {
+
+std::atomic<uint32_t> allocations{0};  ///< Allocations reported by the heap hooks.
+std::atomic<uint32_t> frees{0};        ///< Frees reported by the heap hooks.
+std::atomic<size_t> allocatedBytes{0}; ///< Bytes reported by the heap hooks.
+
+} // namespace
+
+void IRAM_ATTR espricHeapRecordAllocation(size_t bytes) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void IRAM_ATTR espricHeapRecordFree(size_t) {
+    frees.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Reads the counters; usage and peak are derived from the default-capability heap.
+ */
+ESPRIC_HeapCounters espricHeapCounters() {
+    const size_t total = heap_caps_get_total_size(MALLOC_CAP_DEFAULT);
+    ESPRIC_HeapCounters counters;
+    counters.allocations = allocations.load(std::memory_order_relaxed);
+    counters.frees = frees.load(std::memory_order_relaxed);
+    counters.allocatedBytes = allocatedBytes.load(std::memory_order_relaxed);
+    counters.inUseBytes = total - heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    counters.peakBytes = total - heap_caps_get_minimum_free_size(MALLOC_CAP_DEFAULT);
+    return counters;
+}
+
+ESPRIC_HeapMark espricHeapBegin() {
+    ESPRIC_HeapMark mark;
+    mark.start = espricHeapCounters();
+    mark.outerPeak = mark.start.peakBytes; // Low-water mark since boot
+    return mark;
+}
+
+/**
+ * @brief Ends a window; the peak is exact if the window lowered the heap low-water mark.
+ */
+ESPRIC_HeapCounters espricHeapEnd(const ESPRIC_HeapMark& mark) {
+    ESPRIC_HeapCounters counters = espricHeapCounters();
+    if (counters.peakBytes <= mark.outerPeak) {
+        // The peak of the window stayed below the all-time peak, sample the window edges
+        counters.peakBytes = counters.inUseBytes > mark.start.inUseBytes ? counters.inUseBytes
+                                                                          : mark.start.inUseBytes;
+    }
+    return counters;
+}
+
+#if defined(ESPRIC_HEAP_HOOKS)
+
+// Requires CONFIG_HEAP_USE_HOOKS=y; the heap calls these functions on every allocation and free.
+extern "C" void IRAM_ATTR esp_heap_trace_alloc_hook(void* ptr, size_t size, uint32_t caps) {
+    (void)ptr;
+    (void)caps;
+    espricHeapRecordAllocation(size);
+}
+
+extern "C" void IRAM_ATTR esp_heap_trace_free_hook(void* ptr) {
+    if (ptr != nullptr) {
+        espricHeapRecordFree(0);
+    }
+}
+
+#endif // ESPRIC_HEAP_HOOKS
+
+#endif
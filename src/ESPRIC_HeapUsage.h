@@ -0,0 +1,174 @@
+/**
+ * @file ESPRIC_HeapUsage.h
+ * @brief Opt-in heap allocation accounting for analyzer construction, analysis and callbacks.
+ *
+ * Heap usage is measured in windows: `espricHeapBegin()` marks the start, `espricHeapEnd()`
+ * returns the counters at the end together with the peak usage inside the window. Windows
+ * may nest (an analysis contains its callbacks). `ESPRIC_HeapStats` accumulates windows,
+ * `ESPRIC_HeapScope` measures a block such as the analyzer construction, and
+ * `ESPRIC::analyze(ESPRIC_HeapReport&)` fills a report per phase and per callback.
+ *
+ * Backends:
+ * - Host (`ESPRIC_HOST`): a counting replacement of the global `operator new`/`operator delete`
+ *   tracks allocations, frees, bytes in use and the exact peak.
+ * - ESP32: bytes in use come from `heap_caps_get_free_size()`. The peak is exact when a window
+ *   lowers the heap low-water mark (`heap_caps_get_minimum_free_size()`) and sampled at the
+ *   window edges otherwise. Allocation and free counts need `CONFIG_HEAP_USE_HOOKS=y` and
+ *   `-DESPRIC_HEAP_HOOKS`, which let the library implement the `esp_heap_trace_*_hook`
+ *   functions; without hooks they stay 0.
+ */
+
+#ifndef ESPRIC_HEAPUSAGE_H
+#define ESPRIC_HEAPUSAGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of conditions that get their own entry in an `ESPRIC_HeapReport`.
+ */
+#ifndef ESPRIC_HEAP_MAX_ENTRIES
+#define ESPRIC_HEAP_MAX_ENTRIES 32
+#endif
+
+/**
+ * @struct ESPRIC_HeapCounters
+ * @brief Heap counters at one point in time.
+ */
+struct ESPRIC_HeapCounters {
+    uint32_t allocations = 0;   ///< Allocations since start (0 on ESP32 without hooks).
+    uint32_t frees = 0;         ///< Frees since start (0 on ESP32 without hooks).
+    size_t allocatedBytes = 0;  ///< Bytes requested since start (0 on ESP32 without hooks).
+    size_t inUseBytes = 0;      ///< Bytes currently allocated.
+    size_t peakBytes = 0;       ///< Peak of `inUseBytes` (see `espricHeapEnd()`).
+};
+
+/**
+ * @struct ESPRIC_HeapMark
+ * @brief Start of a measurement window, returned by `espricHeapBegin()`.
+ */
+struct ESPRIC_HeapMark {
+    ESPRIC_HeapCounters start; ///< Counters at the start of the window.
+    size_t outerPeak = 0;      ///< Peak of the enclosing window, restored by `espricHeapEnd()`.
+};
+
+/**
+ * @brief Returns the current heap counters.
+ */
+ESPRIC_HeapCounters espricHeapCounters();
+
+/**
+ * @brief Starts a measurement window.
+ */
+ESPRIC_HeapMark espricHeapBegin();
+
+/**
+ * @brief Ends a measurement window.
+ *
+ * @param mark The value returned by the matching `espricHeapBegin()`.
+ * @return The counters at the end of the window; `peakBytes` is the peak inside the window.
+ */
+ESPRIC_HeapCounters espricHeapEnd(const ESPRIC_HeapMark& mark);
+
+/**
+ * @brief Records one allocation; called by the host allocator and the ESP32 heap hooks.
+ */
+void espricHeapRecordAllocation(size_t bytes);
+
+/**
+ * @brief Records one free of `bytes` (0 if unknown); called by the host allocator and the ESP32 heap hooks.
+ */
+void espricHeapRecordFree(size_t bytes);
+
+/**
+ * @struct ESPRIC_HeapStats
+ * @brief Accumulated heap activity of a series of measurement windows.
+ */
+struct ESPRIC_HeapStats {
+    uint32_t count = 0;       ///< Number of measured windows.
+    uint32_t allocations = 0; ///< Allocations inside the windows.
+    uint32_t frees = 0;       ///< Frees inside the windows.
+    size_t bytes = 0;         ///< Bytes requested inside the windows.
+    ptrdiff_t netBytes = 0;   ///< Change of the bytes in use; positive values are retained memory.
+    size_t peakBytes = 0;     ///< Largest growth of the bytes in use above the start of a window.
+
+    /**
+     * @brief Adds one window.
+     *
+     * @param mark Start of the window.
+     * @param end Counters returned by `espricHeapEnd(mark)`.
+     */
+    void add(const ESPRIC_HeapMark& mark, const ESPRIC_HeapCounters& end) {
+        ++count;
+        allocations += end.allocations - mark.start.allocations;
+        frees += end.frees - mark.start.frees;
+        bytes += end.allocatedBytes - mark.start.allocatedBytes;
+        netBytes += static_cast<ptrdiff_t>(end.inUseBytes) - static_cast<ptrdiff_t>(mark.start.inUseBytes);
+        const size_t growth = end.peakBytes > mark.start.inUseBytes ? end.peakBytes - mark.start.inUseBytes : 0;
+        if (growth > peakBytes) peakBytes = growth;
+    }
+};
+
+/**
+ * @class ESPRIC_HeapScope
+ * @brief Measures the heap activity of a block and adds it to an `ESPRIC_HeapStats`.
+ *
+ * The window ends with `stop()` or when the scope is destroyed, whichever comes first.
+ */
+class ESPRIC_HeapScope {
+public:
+    explicit ESPRIC_HeapScope(ESPRIC_HeapStats& stats) : stats_(&stats), mark_(espricHeapBegin()) {}
+    ~ESPRIC_HeapScope() { stop(); }
+
+    ESPRIC_HeapScope(const ESPRIC_HeapScope&) = delete;
+    ESPRIC_HeapScope& operator=(const ESPRIC_HeapScope&) = delete;
+
+    /**
+     * @brief Ends the window and records it; later calls do nothing.
+     */
+    void stop() {
+        if (stats_ != nullptr) {
+            stats_->add(mark_, espricHeapEnd(mark_));
+            stats_ = nullptr;
+        }
+    }
+
+private:
+    ESPRIC_HeapStats* stats_;
+    ESPRIC_HeapMark mark_;
+};
+
+/**
+ * @struct ESPRIC_HeapReport
+ * @brief Heap activity per phase and per callback, filled by `ESPRIC::analyze(ESPRIC_HeapReport&)`.
+ *
+ * `construction` is filled by the caller, e.g. with an `ESPRIC_HeapScope` around the analyzer
+ * construction. Entries are indexed like `ESPRIC_TimingReport`: predicate conditions first,
+ * followed by the mask conditions. Windows accumulate until `reset()` is called.
+ */
+struct ESPRIC_HeapReport {
+    ESPRIC_HeapStats construction;                     ///< Analyzer construction (caller-measured).
+    ESPRIC_HeapStats analysis;                         ///< Complete `analyze()` calls.
+    ESPRIC_HeapStats predicates;                       ///< All predicate evaluations.
+    ESPRIC_HeapStats callbacks;                        ///< All callbacks, including dispatch and default handlers.
+    ESPRIC_HeapStats entries[ESPRIC_HEAP_MAX_ENTRIES]; ///< Callback of each condition.
+    size_t entryCount = 0;                             ///< Number of valid entries.
+    size_t overflow = 0;                               ///< Conditions of the last analysis that had no entry left.
+
+    /**
+     * @brief Clears all statistics.
+     */
+    void reset() {
+        construction = ESPRIC_HeapStats();
+        analysis = ESPRIC_HeapStats();
+        predicates = ESPRIC_HeapStats();
+        callbacks = ESPRIC_HeapStats();
+        for (ESPRIC_HeapStats& entry : entries) {
+            entry = ESPRIC_HeapStats();
+        }
+        entryCount = 0;
+        overflow = 0;
+    }
+};
+
+#endif // ESPRIC_HEAPUSAGE_H
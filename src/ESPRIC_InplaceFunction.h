@@ -0,0 +1,213 @@
+/**
+ * @file ESPRIC_InplaceFunction.h
+ * @brief Fixed-capacity, allocation-free callable wrapper used for ESPRIC conditions and callbacks.
+ * 
+ * `ESPRIC_InplaceFunction` stores the callable in an internal buffer of `Capacity` bytes. 
+ * Unlike `std::function` it never falls back to the heap: a callable whose captures do not 
+ * fit fails to compile. This keeps the analyzer path provably heap-free during early boot.
+ */
+
+#ifndef ESPRIC_INPLACEFUNCTION_H
+#define ESPRIC_INPLACEFUNCTION_H
+
+#include <stddef.h>
+#include <string.h>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Default capture capacity of `ESPRIC_InplaceFunction` in bytes.
+ * 
+ * Four pointers are enough for captureless lambdas, function pointers and lambdas capturing 
+ * a few values or references. Increase it with a build flag if larger captures are required.
+ */
+#ifndef ESPRIC_INPLACE_FUNCTION_CAPACITY
+#define ESPRIC_INPLACE_FUNCTION_CAPACITY (4 * sizeof(void*))
+#endif
+
+template <typename Signature, size_t Capacity = ESPRIC_INPLACE_FUNCTION_CAPACITY>
+class ESPRIC_InplaceFunction;
+
+/**
+ * @class ESPRIC_InplaceFunction
+ * @brief Type-erased callable with inline storage.
+ * 
+ * @tparam R Return type.
+ * @tparam Args Argument types.
+ * @tparam Capacity Size of the inline buffer in bytes.
+ * 
+ * Callables that take no arguments are accepted as well and are invoked without the 
+ * arguments. This keeps zero-argument conditions compatible with context-aware signatures. 
+ * Trivially copyable callables (function pointers, captureless lambdas, lambdas capturing 
+ * plain values) are copied with `memcpy` and need no manager.
+ */
+template <typename R, typename... Args, size_t Capacity>
+class ESPRIC_InplaceFunction<R(Args...), Capacity> {
+public:
+    ESPRIC_InplaceFunction() noexcept = default;
+
+    /**
+     * @brief Creates an empty function.
+     */
+    ESPRIC_InplaceFunction(std::nullptr_t) noexcept {}
+
+    /**
+     * @brief Stores a callable in the inline buffer.
+     * 
+     * @param callable A callable invocable with `Args...` or with no arguments.
+     * 
+     * A null function pointer results in an empty function.
+     */
+    template <typename F,
+              typename T = typename std::decay<F>::type,
+              typename std::enable_if<!std::is_same<T, ESPRIC_InplaceFunction>::value &&
+                                      (std::is_invocable_r<R, T&, Args...>::value ||
+                                       std::is_invocable_r<R, T&>::value),
+                                      int>::type = 0>
+    ESPRIC_InplaceFunction(F&& callable) {
+        static_assert(sizeof(T) <= Capacity,
+                      "Callable capture exceeds ESPRIC_INPLACE_FUNCTION_CAPACITY; capture less or raise the capacity");
+        static_assert(alignof(T) <= alignof(Storage), "Callable alignment exceeds the inline storage alignment");
+        if constexpr (std::is_pointer<T>::value && !std::is_function<typename std::remove_reference<F>::type>::value) {
+            if (callable == nullptr) { // Function references are never null
+                return;
+            }
+        }
+        ::new (static_cast<void*>(&storage_)) T(std::forward<F>(callable));
+        invoke_ = &invokeStored<T>;
+        if constexpr (!std::is_trivially_copyable<T>::value) {
+            manage_ = &manageStored<T>;
+        }
+    }
+
+    ESPRIC_InplaceFunction(const ESPRIC_InplaceFunction& other) {
+        copyFrom(other);
+    }
+
+    ESPRIC_InplaceFunction(ESPRIC_InplaceFunction&& other) noexcept {
+        moveFrom(other);
+    }
+
+    ~ESPRIC_InplaceFunction() {
+        reset();
+    }
+
+    ESPRIC_InplaceFunction& operator=(const ESPRIC_InplaceFunction& other) {
+        if (this != &other) {
+            reset();
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    ESPRIC_InplaceFunction& operator=(ESPRIC_InplaceFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    ESPRIC_InplaceFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    /**
+     * @brief Invokes the stored callable. The function must not be empty.
+     */
+    R operator()(Args... args) const {
+        return invoke_(const_cast<void*>(static_cast<const void*>(&storage_)), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Returns `true` if a callable is stored.
+     */
+    explicit operator bool() const noexcept {
+        return invoke_ != nullptr;
+    }
+
+    friend bool operator==(const ESPRIC_InplaceFunction& function, std::nullptr_t) noexcept {
+        return !function;
+    }
+
+    friend bool operator!=(const ESPRIC_InplaceFunction& function, std::nullptr_t) noexcept {
+        return static_cast<bool>(function);
+    }
+
+private:
+    struct Storage {
+        alignas(std::max_align_t) unsigned char bytes[Capacity];
+    };
+    using Invoker = R (*)(void*, Args&&...);
+
+    /**
+     * @brief Operations performed by the manager of non-trivial callables.
+     */
+    enum class Operation { Copy, Move, Destroy };
+    using Manager = void (*)(Operation, void* destination, void* source);
+
+    template <typename T>
+    static R invokeStored(void* storage, Args&&... args) {
+        T& callable = *static_cast<T*>(storage);
+        if constexpr (std::is_invocable_r<R, T&, Args...>::value) {
+            return callable(std::forward<Args>(args)...);
+        } else {
+            return callable();
+        }
+    }
+
+    template <typename T>
+    static void manageStored(Operation operation, void* destination, void* source) {
+        switch (operation) {
+            case Operation::Copy:
+                ::new (destination) T(*static_cast<const T*>(source));
+                break;
+            case Operation::Move:
+                ::new (destination) T(std::move(*static_cast<T*>(source)));
+                static_cast<T*>(source)->~T();
+                break;
+            case Operation::Destroy:
+                static_cast<T*>(destination)->~T();
+                break;
+        }
+    }
+
+    void copyFrom(const ESPRIC_InplaceFunction& other) {
+        if (other.manage_) {
+            other.manage_(Operation::Copy, &storage_, const_cast<Storage*>(&other.storage_));
+        } else if (other.invoke_) {
+            memcpy(&storage_, &other.storage_, sizeof(Storage));
+        }
+        invoke_ = other.invoke_;
+        manage_ = other.manage_;
+    }
+
+    void moveFrom(ESPRIC_InplaceFunction& other) noexcept {
+        if (other.manage_) {
+            other.manage_(Operation::Move, &storage_, &other.storage_);
+        } else if (other.invoke_) {
+            memcpy(&storage_, &other.storage_, sizeof(Storage));
+        }
+        invoke_ = other.invoke_;
+        manage_ = other.manage_;
+        other.invoke_ = nullptr;
+        other.manage_ = nullptr;
+    }
+
+    void reset() noexcept {
+        if (manage_) {
+            manage_(Operation::Destroy, &storage_, nullptr);
+        }
+        invoke_ = nullptr;
+        manage_ = nullptr;
+    }
+
+    Storage storage_;            ///< Inline buffer holding the callable.
+    Invoker invoke_ = nullptr;   ///< Calls the stored callable, `nullptr` if empty.
+    Manager manage_ = nullptr;   ///< Copies, moves and destroys non-trivial callables.
+};
+
+#endif // ESPRIC_INPLACEFUNCTION_H
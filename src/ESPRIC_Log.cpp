@@ -0,0 +1,85 @@
+/**
+ * @file ESPRIC_Log.cpp
+ * @brief Implementation of the tokenized log ring buffer.
+ */
+
+#include "ESPRIC_Log.h"
+#include <string.h>
+
+ESPRIC_Log::ESPRIC_Log() {
+    log(ESPRIC_LOG_CATALOG, espricLogCatalogHash());
+}
+
+#if defined(ESPRIC_HOST)
+void ESPRIC_Log::lock() const { lock_.lock(); }
+void ESPRIC_Log::unlock() const { lock_.unlock(); }
+#else
+void ESPRIC_Log::lock() const { portENTER_CRITICAL_SAFE(&lock_); }
+void ESPRIC_Log::unlock() const { portEXIT_CRITICAL_SAFE(&lock_); }
+#endif
+
+void ESPRIC_Log::push(const uint8_t* data, size_t size) {
+    size_t head = (tail_ + used_) % ESPRIC_LOG_BUFFER_SIZE;
+    const size_t first = size < ESPRIC_LOG_BUFFER_SIZE - head ? size : ESPRIC_LOG_BUFFER_SIZE - head;
+    memcpy(ring_ + head, data, first);
+    memcpy(ring_, data + first, size - first);
+    used_ += size;
+}
+
+bool ESPRIC_Log::write(uint16_t id, const uint32_t* args, size_t count) {
+    uint8_t frame[ESPRIC_LOG_MAX_FRAME];
+    const size_t size = espricLogEncodeFrame(frame, id, args, count); // Outside the lock
+    if (size == 0) {
+        return false;
+    }
+    uint8_t notice[ESPRIC_LOG_MAX_FRAME];
+    lock();
+    // The first record that fits after a drop is preceded by the drop count, in stream order.
+    const size_t noticeSize = dropped_ ? espricLogEncodeFrame(notice, ESPRIC_LOG_DROPPED, &dropped_, 1) : 0;
+    const bool fits = used_ + noticeSize + size <= ESPRIC_LOG_BUFFER_SIZE;
+    if (fits) {
+        push(notice, noticeSize);
+        push(frame, size);
+        dropped_ = 0;
+    } else {
+        dropped_++;
+    }
+    unlock();
+    return fits;
+}
+
+size_t ESPRIC_Log::read(uint8_t* buffer, size_t capacity) {
+    size_t size = 0;
+    lock();
+    while (used_ != 0) {
+        const size_t frame = ring_[(tail_ + 1) % ESPRIC_LOG_BUFFER_SIZE] + 3u;
+        if (size + frame > capacity) {
+            break;
+        }
+        for (size_t i = 0; i < frame; i++) {
+            buffer[size++] = ring_[tail_];
+            tail_ = (tail_ + 1) % ESPRIC_LOG_BUFFER_SIZE;
+        }
+        used_ -= frame;
+    }
+    if (used_ == 0 && dropped_ != 0 && size + ESPRIC_LOG_MAX_FRAME <= capacity) {
+        size += espricLogEncodeFrame(buffer + size, ESPRIC_LOG_DROPPED, &dropped_, 1);
+        dropped_ = 0;
+    }
+    unlock();
+    return size;
+}
+
+size_t ESPRIC_Log::size() const {
+    lock();
+    const size_t used = used_;
+    unlock();
+    return used;
+}
+
+uint32_t ESPRIC_Log::dropped() const {
+    lock();
+    const uint32_t dropped = dropped_;
+    unlock();
+    return dropped;
+}
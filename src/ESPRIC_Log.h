@@ -0,0 +1,148 @@
+/**
+ * @file ESPRIC_Log.h
+ * @brief Deferred, tokenized log in a RAM ring buffer.
+ *
+ * `log()` stores a message id and its integer arguments as a frame of
+ * `ESPRIC_LogFormat.h`, typically 3 to 12 bytes, and returns. Nothing is formatted and nothing
+ * is written to the UART on the boot path. The application drains the ring later, e.g. after
+ * `setup()` or before deep sleep, to the UART, a file or a socket. `tools/LogExpander` turns
+ * the bytes back into text with the same catalog.
+ *
+ * @code{.cpp}
+ * static ESPRIC_Log bootLog;
+ * analyzer.setLog(&bootLog);                          // Boot context and analysis result
+ * bootLog.log(APP_LOG_SENSOR, millivolts);            // Application message
+ * ...
+ * bootLog.drainTo(Serial);                            // Binary frames, see tools/LogExpander
+ * @endcode
+ *
+ * `log()` is safe to call from several tasks; it holds a spinlock (a mutex on a host) only
+ * while copying the frame.
+ */
+
+#ifndef ESPRIC_LOG_H
+#define ESPRIC_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ESPRIC_LogFormat.h"
+
+#if defined(ESPRIC_HOST)
+#include <mutex>
+#else
+#include <freertos/FreeRTOS.h>
+#endif
+
+/**
+ * @brief Size of the ring buffer in bytes.
+ *
+ * When the ring is full, new records are dropped and counted. The count is reported as an
+ * `ESPRIC_LOG_DROPPED` record in stream order: before the next record that fits, or at the end
+ * of the drain.
+ */
+#ifndef ESPRIC_LOG_BUFFER_SIZE
+#define ESPRIC_LOG_BUFFER_SIZE 512
+#endif
+
+static_assert(ESPRIC_LOG_BUFFER_SIZE >= 2 * ESPRIC_LOG_MAX_FRAME, "ESPRIC_LOG_BUFFER_SIZE too small");
+
+/**
+ * @class ESPRIC_Log
+ * @brief Ring buffer of tokenized log records.
+ */
+class ESPRIC_Log {
+public:
+    /**
+     * @brief Creates an empty log whose first record is the catalog hash (`ESPRIC_LOG_CATALOG`).
+     */
+    ESPRIC_Log();
+
+    ESPRIC_Log(const ESPRIC_Log&) = delete;
+    ESPRIC_Log& operator=(const ESPRIC_Log&) = delete;
+
+    /**
+     * @brief Appends a record.
+     *
+     * @param id An `ESPRIC_LogId` or an application id from `ESPRIC_LOG_APP_FIRST`.
+     * @param args Integer or enum arguments, converted to `uint32_t`; at most `ESPRIC_LOG_MAX_ARGS`.
+     * @return `false` if the ring is full and the record was dropped.
+     */
+    template <typename... Args>
+    bool log(uint16_t id, Args... args) {
+        static_assert(sizeof...(Args) <= ESPRIC_LOG_MAX_ARGS, "Too many arguments for ESPRIC_Log::log()");
+        const uint32_t values[sizeof...(Args) + 1] = {static_cast<uint32_t>(args)..., 0};
+        return write(id, values, sizeof...(Args));
+    }
+
+    /**
+     * @brief Appends a record with arguments from an array.
+     *
+     * @return `false` if the ring is full or `count` exceeds `ESPRIC_LOG_MAX_ARGS`.
+     */
+    bool write(uint16_t id, const uint32_t* args, size_t count);
+
+    /**
+     * @brief Moves whole frames out of the ring.
+     *
+     * @param buffer Destination; at least `ESPRIC_LOG_MAX_FRAME` bytes to make progress.
+     * @return Bytes copied, 0 if the ring is empty.
+     *
+     * Once the ring is empty, pending drops are reported as an `ESPRIC_LOG_DROPPED` frame.
+     */
+    size_t read(uint8_t* buffer, size_t capacity);
+
+    /**
+     * @brief Drains the ring into any output with `write(const uint8_t*, size_t)`, e.g. `Serial`.
+     *
+     * @return Bytes written.
+     */
+    template <typename Output>
+    size_t drainTo(Output& output) {
+        uint8_t chunk[64];
+        size_t total = 0;
+        for (size_t size = read(chunk, sizeof(chunk)); size != 0; size = read(chunk, sizeof(chunk))) {
+            output.write(chunk, size);
+            total += size;
+        }
+        return total;
+    }
+
+    /**
+     * @brief Returns the bytes waiting in the ring.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the number of dropped records not reported yet.
+     */
+    uint32_t dropped() const;
+
+private:
+    /**
+     * @brief Copies `size` bytes to the head of the ring; the caller holds the lock.
+     */
+    void push(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Takes the spinlock (mutex on a host); also callable from an ISR on the ESP32.
+     */
+    void lock() const;
+
+    /**
+     * @brief Releases the lock taken by `lock()`.
+     */
+    void unlock() const;
+
+    uint8_t ring_[ESPRIC_LOG_BUFFER_SIZE]; ///< Frames, oldest at `tail_`.
+    size_t tail_ = 0;                      ///< Index of the oldest byte.
+    size_t used_ = 0;                      ///< Bytes in the ring.
+    uint32_t dropped_ = 0;                 ///< Dropped records not reported yet.
+
+#if defined(ESPRIC_HOST)
+    mutable std::mutex lock_; ///< Protects the ring.
+#else
+    mutable portMUX_TYPE lock_ = portMUX_INITIALIZER_UNLOCKED; ///< Protects the ring.
+#endif
+};
+
+#endif // ESPRIC_LOG_H
@@ -0,0 +1,319 @@
+/**
+ * @file ESPRIC_LogFormat.h
+ * @brief Message catalog and frame format of the tokenized ESPRIC log.
+ *
+ * A log record carries a message id and up to `ESPRIC_LOG_MAX_ARGS` integer arguments, never a
+ * format string. The strings live only in this catalog, which the device and the host expander
+ * (`tools/LogExpander`) compile from the same header. Records travel in frames:
+ *
+ * | Size | Field |
+ * |---|---|
+ * | 1 | sync byte `0xEC` |
+ * | 1 | payload length n (1 to `ESPRIC_LOG_MAX_PAYLOAD`) |
+ * | n | message id, then the arguments, each as unsigned LEB128 (7 bits per byte, low first) |
+ * | 1 | CRC-8 (polynomial 0x07) over the length and the payload |
+ *
+ * A reader that starts in the middle of a stream, or hits a corrupted byte, skips to the next
+ * sync byte whose frame passes the CRC.
+ *
+ * Format specifiers: `%u`, `%d` (argument as `int32_t`), `%x`, `%R` / `%W` (name of a reset
+ * reason / wakeup cause), `%r` / `%w` (its message) and `%%`.
+ *
+ * Application messages use ids from `ESPRIC_LOG_APP_FIRST`, so new library messages never shift
+ * them. They are listed in a header of the application that defines `ESPRIC_LOG_APP_MESSAGES(X)`
+ * with `X(id, "format")` entries and declares the ids with `ESPRIC_LOG_APP_IDS();`. The expander
+ * is built with `-DESPRIC_LOG_APP_CATALOG='"path/to/that/header.h"'`.
+ *
+ * This header depends on the C++ standard library only.
+ */
+
+#ifndef ESPRIC_LOGFORMAT_H
+#define ESPRIC_LOGFORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "ESPRIC_CauseNames.h"
+
+/**
+ * @brief Library messages as `X(id, "format")` entries. Append only: the position is the id.
+ */
+#define ESPRIC_LOG_MESSAGES(X)                                                                   \
+    X(ESPRIC_LOG_CATALOG, "log: catalog %x")                                                     \
+    X(ESPRIC_LOG_DROPPED, "log: %u records dropped, buffer full")                                \
+    X(ESPRIC_LOG_BOOT, "boot: reset %R, wakeup %W, uptime %u us")                                \
+    X(ESPRIC_LOG_BOOT_LOOP, "boot loop: state %u, %u recent crashes")                            \
+    X(ESPRIC_LOG_ANALYSIS, "analyze: %u matched, %u unmatched, %u skipped, %u deferred, %u gated") \
+    X(ESPRIC_LOG_RESET_REASON, "%r")                                                             \
+    X(ESPRIC_LOG_WAKEUP_CAUSE, "%w")                                                             \
+    X(ESPRIC_LOG_POWER_DOWN, "power-down: profile %u, failed domains 0x%x")
+
+#define ESPRIC_LOG_ENUM_ENTRY(id, format) id,
+#define ESPRIC_LOG_CATALOG_ENTRY(id, format) {id, format},
+
+/**
+ * @enum ESPRIC_LogId
+ * @brief Ids of the library messages.
+ */
+enum ESPRIC_LogId : uint16_t {
+    ESPRIC_LOG_MESSAGES(ESPRIC_LOG_ENUM_ENTRY)
+    ESPRIC_LOG_LIBRARY_END ///< Number of library messages.
+};
+
+static constexpr uint16_t ESPRIC_LOG_APP_FIRST = 0x100; ///< First id of the application messages.
+
+/**
+ * @brief Declares the ids of `ESPRIC_LOG_APP_MESSAGES`, starting at `ESPRIC_LOG_APP_FIRST`.
+ */
+#define ESPRIC_LOG_APP_IDS() \
+    enum : uint16_t { ESPRIC_LOG_APP_BASE_ = ESPRIC_LOG_APP_FIRST - 1, ESPRIC_LOG_APP_MESSAGES(ESPRIC_LOG_ENUM_ENTRY) }
+
+static constexpr uint8_t ESPRIC_LOG_SYNC = 0xEC;    ///< First byte of every frame.
+static constexpr size_t ESPRIC_LOG_MAX_ARGS = 8;     ///< Arguments per record.
+static constexpr size_t ESPRIC_LOG_MAX_PAYLOAD = 3 + 5 * ESPRIC_LOG_MAX_ARGS; ///< LEB128 id and arguments.
+static constexpr size_t ESPRIC_LOG_MAX_FRAME = ESPRIC_LOG_MAX_PAYLOAD + 3;     ///< Payload plus sync, length and CRC.
+
+/**
+ * @struct ESPRIC_LogMessage
+ * @brief Catalog entry: message id and format string.
+ */
+struct ESPRIC_LogMessage {
+    uint16_t id;        ///< Message id.
+    const char* format; ///< printf-like format, see the file description.
+};
+
+/**
+ * @brief Library catalog, indexed by `ESPRIC_LogId`.
+ */
+static constexpr ESPRIC_LogMessage ESPRIC_LOG_LIBRARY_CATALOG[] = {ESPRIC_LOG_MESSAGES(ESPRIC_LOG_CATALOG_ENTRY)};
+
+/**
+ * @brief FNV-1a over all library format strings, logged as `ESPRIC_LOG_CATALOG` so the expander
+ *        can detect a catalog that does not match the firmware.
+ */
+constexpr uint32_t espricLogCatalogHash() {
+    uint32_t hash = 2166136261u;
+    for (const ESPRIC_LogMessage& message : ESPRIC_LOG_LIBRARY_CATALOG) {
+        for (const char* c = message.format; *c != '\0'; c++) {
+            hash = (hash ^ static_cast<uint8_t>(*c)) * 16777619u;
+        }
+        hash = (hash ^ 0u) * 16777619u; // Separator, so moving text between messages changes the hash
+    }
+    return hash;
+}
+
+/**
+ * @brief CRC-8 with polynomial 0x07, initial value 0.
+ */
+inline uint8_t espricLogCrc8(const uint8_t* data, size_t size) {
+    uint8_t crc = 0;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80) ? static_cast<uint8_t>((crc << 1) ^ 0x07) : static_cast<uint8_t>(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief Writes `value` as unsigned LEB128.
+ *
+ * @param out At least 5 bytes.
+ * @return Bytes written, 1 to 5.
+ */
+inline size_t espricLogPutVarint(uint8_t* out, uint32_t value) {
+    size_t size = 0;
+    while (value >= 0x80) {
+        out[size++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    out[size++] = static_cast<uint8_t>(value);
+    return size;
+}
+
+/**
+ * @brief Encodes one record as a frame.
+ *
+ * @param out At least `ESPRIC_LOG_MAX_FRAME` bytes.
+ * @param count Number of arguments, at most `ESPRIC_LOG_MAX_ARGS`.
+ * @return Frame size, 0 if `count` is too large.
+ */
+inline size_t espricLogEncodeFrame(uint8_t* out, uint16_t id, const uint32_t* args, size_t count) {
+    if (count > ESPRIC_LOG_MAX_ARGS) {
+        return 0;
+    }
+    size_t size = 2;
+    size += espricLogPutVarint(out + size, id);
+    for (size_t i = 0; i < count; i++) {
+        size += espricLogPutVarint(out + size, args[i]);
+    }
+    out[0] = ESPRIC_LOG_SYNC;
+    out[1] = static_cast<uint8_t>(size - 2);
+    out[size] = espricLogCrc8(out + 1, size - 1);
+    return size + 1;
+}
+
+/**
+ * @struct ESPRIC_LogRecord
+ * @brief Decoded record.
+ */
+struct ESPRIC_LogRecord {
+    uint16_t id = 0;                         ///< Message id.
+    uint8_t count = 0;                       ///< Number of valid entries in `args`.
+    uint32_t args[ESPRIC_LOG_MAX_ARGS] = {}; ///< Arguments in order.
+};
+
+/**
+ * @enum ESPRIC_LogFrameStatus
+ * @brief Result of `espricLogDecodeFrame()`.
+ */
+enum class ESPRIC_LogFrameStatus : uint8_t {
+    Valid,      ///< A record was decoded.
+    Incomplete, ///< The data ends inside the frame; read more and retry.
+    Invalid     ///< No frame starts here; skip one byte and retry.
+};
+
+/**
+ * @brief Decodes the frame at the start of `data`.
+ *
+ * @param[out] record The decoded record if the frame is valid.
+ * @param[out] consumed Frame size if valid, otherwise unchanged.
+ */
+inline ESPRIC_LogFrameStatus espricLogDecodeFrame(const uint8_t* data, size_t size, ESPRIC_LogRecord& record,
+                                                  size_t& consumed) {
+    if (size < 1) {
+        return ESPRIC_LogFrameStatus::Incomplete;
+    }
+    if (data[0] != ESPRIC_LOG_SYNC) {
+        return ESPRIC_LogFrameStatus::Invalid;
+    }
+    if (size < 2) {
+        return ESPRIC_LogFrameStatus::Incomplete;
+    }
+    const size_t length = data[1];
+    if (length == 0 || length > ESPRIC_LOG_MAX_PAYLOAD) {
+        return ESPRIC_LogFrameStatus::Invalid;
+    }
+    if (size < length + 3) {
+        return ESPRIC_LogFrameStatus::Incomplete;
+    }
+    if (espricLogCrc8(data + 1, length + 1) != data[length + 2]) {
+        return ESPRIC_LogFrameStatus::Invalid;
+    }
+    uint32_t values[ESPRIC_LOG_MAX_ARGS + 1] = {};
+    size_t count = 0;
+    const uint8_t* in = data + 2;
+    const uint8_t* end = in + length;
+    while (in != end) {
+        uint32_t value = 0;
+        unsigned shift = 0;
+        uint8_t byte;
+        do {
+            if (in == end || shift > 28 || count > ESPRIC_LOG_MAX_ARGS) {
+                return ESPRIC_LogFrameStatus::Invalid;
+            }
+            byte = *in++;
+            value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+        values[count++] = value;
+    }
+    if (values[0] > 0xFFFF) {
+        return ESPRIC_LogFrameStatus::Invalid;
+    }
+    record.id = static_cast<uint16_t>(values[0]);
+    record.count = static_cast<uint8_t>(count - 1);
+    for (size_t i = 1; i < count; i++) {
+        record.args[i - 1] = values[i];
+    }
+    consumed = length + 3;
+    return ESPRIC_LogFrameStatus::Valid;
+}
+
+/**
+ * @brief Looks up the format of a message id.
+ *
+ * @param app Application catalog, searched for ids from `ESPRIC_LOG_APP_FIRST`; may be `nullptr`.
+ * @return The format, or `nullptr` if the id is unknown.
+ */
+inline const char* espricLogFormatOf(uint16_t id, const ESPRIC_LogMessage* app = nullptr, size_t appCount = 0) {
+    if (id < ESPRIC_LOG_LIBRARY_END) {
+        return ESPRIC_LOG_LIBRARY_CATALOG[id].format;
+    }
+    for (size_t i = 0; app != nullptr && i < appCount; i++) {
+        if (app[i].id == id) {
+            return app[i].format;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Expands a record into text, like `snprintf()`.
+ *
+ * Unknown ids are written as `#<id>` followed by the arguments in hex; missing arguments as `?`.
+ *
+ * @return Length of the text (truncated to `capacity - 1`).
+ */
+inline size_t espricLogExpand(const ESPRIC_LogRecord& record, char* out, size_t capacity,
+                              const ESPRIC_LogMessage* app = nullptr, size_t appCount = 0) {
+    if (capacity == 0) {
+        return 0;
+    }
+    size_t size = 0;
+    auto append = [&](const char* text) {
+        while (*text != '\0' && size + 1 < capacity) {
+            out[size++] = *text++;
+        }
+    };
+    char number[16];
+    const char* format = espricLogFormatOf(record.id, app, appCount);
+    if (format == nullptr) {
+        snprintf(number, sizeof(number), "#%u", static_cast<unsigned>(record.id));
+        append(number);
+        for (size_t i = 0; i < record.count; i++) {
+            snprintf(number, sizeof(number), " 0x%lx", static_cast<unsigned long>(record.args[i]));
+            append(number);
+        }
+        out[size] = '\0';
+        return size;
+    }
+    size_t arg = 0;
+    for (const char* c = format; *c != '\0'; c++) {
+        if (*c != '%' || c[1] == '\0') {
+            const char single[2] = {*c, '\0'};
+            append(single);
+            continue;
+        }
+        const char spec = *++c;
+        if (spec == '%') {
+            append("%");
+            continue;
+        }
+        if (arg >= record.count) {
+            append("?");
+            continue;
+        }
+        const uint32_t value = record.args[arg++];
+        const char* text = nullptr;
+        switch (spec) {
+        case 'd': snprintf(number, sizeof(number), "%ld", static_cast<long>(static_cast<int32_t>(value))); break;
+        case 'x': snprintf(number, sizeof(number), "%lx", static_cast<unsigned long>(value)); break;
+        case 'R': text = espricResetReasonName(value); break;
+        case 'r': text = espricResetReasonMessage(value); break;
+        case 'W': text = espricWakeupCauseName(value); break;
+        case 'w': text = espricWakeupCauseMessage(value); break;
+        default: snprintf(number, sizeof(number), "%lu", static_cast<unsigned long>(value)); break;
+        }
+        if (text == nullptr && (spec == 'R' || spec == 'r' || spec == 'W' || spec == 'w')) {
+            snprintf(number, sizeof(number), "%c%lu", spec == 'R' || spec == 'r' ? 'R' : 'W',
+                     static_cast<unsigned long>(value)); // Cause newer than the name table
+        }
+        append(text != nullptr ? text : number);
+    }
+    out[size] = '\0';
+    return size;
+}
+
+#endif // ESPRIC_LOGFORMAT_H
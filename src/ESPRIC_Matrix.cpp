@@ -0,0 +1,133 @@
+/**
+ * @file ESPRIC_Matrix.cpp
+ * @brief Implementation of the combined reset x wakeup matrix analyzer.
+ */
+
+#include "ESPRIC_Matrix.h"
+
+/**
+ * @brief Constructs an empty matrix with an optional default callback.
+ * 
+ * @param defaultCallback Callback executed if no bound handler applies.
+ */
+ESPRIC_Matrix::ESPRIC_Matrix(Callback defaultCallback)
+    : defaultCallback_(std::move(defaultCallback)) {}
+
+/**
+ * @brief Binds a handler to one reset reason and wakeup cause combination.
+ * 
+ * @param reason The reset reason (matrix row).
+ * @param cause The wakeup cause (matrix column).
+ * @param callback The handler for this combination.
+ * @return `true` on success, `false` if the combination is outside the matrix.
+ */
+bool ESPRIC_Matrix::on(esp_reset_reason_t reason, esp_sleep_wakeup_cause_t cause, const Callback& callback) {
+    const unsigned row = static_cast<unsigned>(reason);
+    const unsigned column = static_cast<unsigned>(cause);
+    if (row >= ESPRIC_MAX_RESET_REASONS || column >= ESPRIC_MAX_WAKEUP_CAUSES) {
+        return false;
+    }
+    uint16_t slot = (exact_[row] & (1u << column)) ? resolved_[row][column] : 0;
+    resolved_[row][column] = bindHandler(slot, callback);
+    exact_[row] |= 1u << column;
+    return true;
+}
+
+/**
+ * @brief Binds a handler to every wakeup cause of a reset reason.
+ * 
+ * @param reason The reset reason (matrix row).
+ * @param callback The handler for the row.
+ * @return `true` on success, `false` if the reason is outside the matrix.
+ */
+bool ESPRIC_Matrix::onReset(esp_reset_reason_t reason, const Callback& callback) {
+    const unsigned row = static_cast<unsigned>(reason);
+    if (row >= ESPRIC_MAX_RESET_REASONS) {
+        return false;
+    }
+    bindHandler(rows_[row], callback);
+    for (unsigned column = 0; column < ESPRIC_MAX_WAKEUP_CAUSES; ++column) {
+        resolveCell(row, column);
+    }
+    return true;
+}
+
+/**
+ * @brief Binds a handler to every reset reason of a wakeup cause.
+ * 
+ * @param cause The wakeup cause (matrix column).
+ * @param callback The handler for the column.
+ * @return `true` on success, `false` if the cause is outside the matrix.
+ */
+bool ESPRIC_Matrix::onWakeup(esp_sleep_wakeup_cause_t cause, const Callback& callback) {
+    const unsigned column = static_cast<unsigned>(cause);
+    if (column >= ESPRIC_MAX_WAKEUP_CAUSES) {
+        return false;
+    }
+    bindHandler(columns_[column], callback);
+    for (unsigned row = 0; row < ESPRIC_MAX_RESET_REASONS; ++row) {
+        resolveCell(row, column);
+    }
+    return true;
+}
+
+/**
+ * @brief Captures the startup context and runs the resolved handler.
+ * 
+ * @return ESPRIC::AnalysisResult One matched or one unmatched lookup.
+ */
+ESPRIC::AnalysisResult ESPRIC_Matrix::analyze() {
+    return analyze(StartupContext::capture());
+}
+
+/**
+ * @brief Runs the handler resolved for the given reset reason and wakeup cause.
+ * 
+ * @param context The startup state to evaluate.
+ * @return ESPRIC::AnalysisResult One matched or one unmatched lookup.
+ */
+ESPRIC::AnalysisResult ESPRIC_Matrix::analyze(const StartupContext& context) {
+    const unsigned row = static_cast<unsigned>(context.resetReason);
+    const unsigned column = static_cast<unsigned>(context.wakeupCause);
+    const uint16_t index = (row < ESPRIC_MAX_RESET_REASONS && column < ESPRIC_MAX_WAKEUP_CAUSES)
+                              ? resolved_[row][column]
+                              : 0;
+    if (index != 0) {
+        handlers_[index - 1]();
+        return {1, 0};
+    }
+    if (defaultCallback_) {
+        defaultCallback_();
+    }
+    return {0, 1};
+}
+
+/**
+ * @brief Stores a handler, reusing the slot if it is already bound.
+ * 
+ * @param slot 1-based handler index of the binding, 0 if unbound. Updated on return.
+ * @param callback The handler to store.
+ * @return The 1-based handler index.
+ */
+uint16_t ESPRIC_Matrix::bindHandler(uint16_t& slot, const Callback& callback) {
+    if (slot != 0) {
+        handlers_[slot - 1] = callback; // Rebinding replaces the previous handler
+        return slot;
+    }
+    handlers_.push_back(callback);
+    slot = static_cast<uint16_t>(handlers_.size());
+    return slot;
+}
+
+/**
+ * @brief Applies the wildcard precedence to a cell without an exact binding.
+ * 
+ * @param reason The matrix row.
+ * @param cause The matrix column.
+ */
+void ESPRIC_Matrix::resolveCell(unsigned reason, unsigned cause) {
+    if (exact_[reason] & (1u << cause)) {
+        return; // Exact bindings take precedence over wildcards
+    }
+    resolved_[reason][cause] = rows_[reason] != 0 ? rows_[reason] : columns_[cause];
+}
@@ -0,0 +1,105 @@
+/**
+ * @file ESPRIC_Matrix.h
+ * @brief Combined reset reason x wakeup cause analyzer.
+ * 
+ * `ESPRIC_Matrix` binds handlers to combinations of a reset reason and a wakeup cause, e.g. 
+ * `ESP_RST_DEEPSLEEP` with `ESP_SLEEP_WAKEUP_TIMER`. Rows and columns can be bound as 
+ * wildcards. Wildcards are resolved when handlers are registered, so `analyze()` finds the 
+ * handler of a boot with a single indexed lookup instead of scanning two condition lists.
+ */
+
+#ifndef ESPRIC_MATRIX_H
+#define ESPRIC_MATRIX_H
+
+#include <stdint.h>
+#include <vector>
+#include "ESPRIC.h"
+
+/**
+ * @class ESPRIC_Matrix
+ * @brief Analyzer backed by a 2D reset x wakeup handler matrix.
+ * 
+ * Resolution order for a boot with reset reason `r` and wakeup cause `w`:
+ * 1. The handler bound with `on(r, w)`.
+ * 2. The row wildcard bound with `onReset(r)`.
+ * 3. The column wildcard bound with `onWakeup(w)`.
+ * 4. The default callback.
+ * 
+ * Exactly one handler runs per analysis. The resolved matrix has 
+ * `ESPRIC_MAX_RESET_REASONS` x `ESPRIC_MAX_WAKEUP_CAUSES` two-byte cells.
+ */
+class ESPRIC_Matrix {
+public:
+    using Callback = ESPRIC::Callback;
+    using StartupContext = ESPRIC::StartupContext;
+
+    /**
+     * @brief Constructor with an optional default callback.
+     * 
+     * @param defaultCallback (Optional) Callback executed if no cell, row or column matches.
+     */
+    explicit ESPRIC_Matrix(Callback defaultCallback = nullptr);
+
+    /**
+     * @brief Binds a handler to one reset reason and wakeup cause combination.
+     * 
+     * @return `false` if the reason or cause is outside the matrix.
+     */
+    bool on(esp_reset_reason_t reason, esp_sleep_wakeup_cause_t cause, const Callback& callback);
+
+    /**
+     * @brief Binds a handler to a reset reason with any wakeup cause (row wildcard).
+     * 
+     * @return `false` if the reason is outside the matrix.
+     */
+    bool onReset(esp_reset_reason_t reason, const Callback& callback);
+
+    /**
+     * @brief Binds a handler to a wakeup cause with any reset reason (column wildcard).
+     * 
+     * @return `false` if the cause is outside the matrix.
+     */
+    bool onWakeup(esp_sleep_wakeup_cause_t cause, const Callback& callback);
+
+    /**
+     * @brief Captures the startup context and runs the resolved handler.
+     * 
+     * @return `matched` is 1 if a bound handler ran, otherwise `unmatched` is 1.
+     */
+    ESPRIC::AnalysisResult analyze();
+
+    /**
+     * @brief Runs the handler resolved for a given startup context.
+     * 
+     * @param context The startup state to evaluate.
+     * @return `matched` is 1 if a bound handler ran, otherwise `unmatched` is 1.
+     */
+    ESPRIC::AnalysisResult analyze(const StartupContext& context);
+
+private:
+    /**
+     * @brief Stores a handler in a slot, reusing the slot if it is already bound.
+     * 
+     * @return The 1-based handler index of the slot.
+     */
+    uint16_t bindHandler(uint16_t& slot, const Callback& callback);
+
+    /**
+     * @brief Recomputes the resolved index of a cell without an exact binding.
+     */
+    void resolveCell(unsigned reason, unsigned cause);
+
+    static_assert(ESPRIC_MAX_WAKEUP_CAUSES <= 32, "ESPRIC_Matrix tracks exact cells in a 32-bit mask per row");
+    static_assert(ESPRIC_MAX_RESET_REASONS * ESPRIC_MAX_WAKEUP_CAUSES + ESPRIC_MAX_RESET_REASONS +
+                          ESPRIC_MAX_WAKEUP_CAUSES <= UINT16_MAX,
+                  "ESPRIC_Matrix handler indices must hold one binding per cell, row and column");
+
+    Callback defaultCallback_;                          ///< Callback if nothing is bound.
+    std::vector<Callback> handlers_;                    ///< All bound handlers.
+    uint32_t exact_[ESPRIC_MAX_RESET_REASONS] = {};     ///< Per row: wakeup causes bound with `on()`.
+    uint16_t rows_[ESPRIC_MAX_RESET_REASONS] = {};       ///< 1-based handler index bound with `onReset()`.
+    uint16_t columns_[ESPRIC_MAX_WAKEUP_CAUSES] = {};    ///< 1-based handler index bound with `onWakeup()`.
+    uint16_t resolved_[ESPRIC_MAX_RESET_REASONS][ESPRIC_MAX_WAKEUP_CAUSES] = {}; ///< Resolved 1-based handler index.
+};
+
+#endif // ESPRIC_MATRIX_H
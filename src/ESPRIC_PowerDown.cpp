@@ -0,0 +1,109 @@
+/**
+ * @file ESPRIC_PowerDown.cpp
+ * @brief Implementation of the diff-applied power-down profiles.
+ */
+
+#include "ESPRIC_PowerDown.h"
+#include <string.h>
+
+#if !defined(ESPRIC_HOST)
+#include <esp_attr.h>
+#endif
+
+static constexpr uint32_t kMagic = 0x45525044;  ///< "ERPD"
+static constexpr uint16_t kStoreVersion = 1;   ///< Layout version of the store.
+
+#if defined(ESPRIC_HOST)
+static ESPRIC_PowerDownStore rtcStore; ///< Simulated RTC memory.
+#else
+/**
+ * @brief Not initialized by the startup code, so it keeps its content across deep sleep and
+ * software resets. After a power loss it is random and fails the checksum.
+ */
+RTC_NOINIT_ATTR static ESPRIC_PowerDownStore rtcStore;
+#endif
+
+ESPRIC_PowerDownStore& espricPowerDownStore() {
+    return rtcStore;
+}
+
+ESPRIC_PowerDown::ESPRIC_PowerDown(ESPRIC_PowerDownStore& store) : store_(store) {}
+
+/**
+ * @brief FNV-1a over the store up to (excluding) the checksum field.
+ */
+uint32_t ESPRIC_PowerDown::checksumOf(const ESPRIC_PowerDownStore& store) {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&store);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < offsetof(ESPRIC_PowerDownStore, checksum); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+ESPRIC_PowerDown::StoreState ESPRIC_PowerDown::begin() {
+    if (begun_) {
+        return storeState_;
+    }
+    begun_ = true;
+    if (store_.magic != kMagic) {
+        storeState_ = StoreState::Initialized; // Power-on garbage or never written
+    } else if (store_.version != kStoreVersion || store_.domains != ESP_PD_DOMAIN_MAX ||
+               store_.checksum != checksumOf(store_)) {
+        storeState_ = StoreState::Corrupted;
+    } else {
+        storeState_ = StoreState::Valid;
+        previousProfile_ = store_.profile;
+        previousErrors_ = store_.errors;
+    }
+    // ESP-IDF starts every boot with all domains at ESP_PD_OPTION_AUTO, so the options stored
+    // before the reset are history, not the baseline of the next diff.
+    save(0);
+    return storeState_;
+}
+
+uint16_t ESPRIC_PowerDown::apply(const ESPRIC_PowerDownProfile& profile) {
+    begin();
+    errors_ = profile.invalid;
+    issued_ = 0;
+    const uint32_t changed = profile.options ^ options_;
+    for (unsigned domain = 0; domain < ESP_PD_DOMAIN_MAX; domain++) {
+        const uint32_t field = 3u << (2 * domain);
+        if ((changed & field) == 0 || (profile.invalid & (1u << domain))) {
+            continue;
+        }
+        const auto pdDomain = static_cast<esp_sleep_pd_domain_t>(domain);
+        const auto option = static_cast<esp_sleep_pd_option_t>((profile.options & field) >> (2 * domain));
+        const auto current = static_cast<esp_sleep_pd_option_t>((options_ & field) >> (2 * domain));
+        if (current == ESP_PD_OPTION_ON && option == ESP_PD_OPTION_AUTO) {
+            // AUTO does not release the ON reference; OFF does, then AUTO takes effect
+            issued_++;
+            if (esp_sleep_pd_config(pdDomain, ESP_PD_OPTION_OFF) != ESP_OK) {
+                errors_ |= 1u << domain;
+                continue;
+            }
+            options_ = (options_ & ~field) | (static_cast<uint32_t>(ESP_PD_OPTION_OFF) << (2 * domain));
+        }
+        issued_++;
+        if (esp_sleep_pd_config(pdDomain, option) == ESP_OK) {
+            options_ = (options_ & ~field) | (profile.options & field);
+        } else {
+            errors_ |= 1u << domain;
+        }
+    }
+    if (issued_ != 0 || errors_ != store_.errors || profile.id != store_.profile) {
+        save(profile.id); // An unchanged profile leaves the store, and its checksum, as it is
+    }
+    return errors_;
+}
+
+void ESPRIC_PowerDown::save(uint8_t profile) {
+    memset(&store_, 0, sizeof(store_));
+    store_.magic = kMagic;
+    store_.version = kStoreVersion;
+    store_.profile = profile;
+    store_.options = options_;
+    store_.errors = errors_;
+    store_.domains = ESP_PD_DOMAIN_MAX;
+    store_.checksum = checksumOf(store_);
+}
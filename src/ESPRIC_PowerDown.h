@@ -0,0 +1,251 @@
+/**
+ * @file ESPRIC_PowerDown.h
+ * @brief Declarative power-down domain profiles, applied as a diff.
+ *
+ * A profile is a `constexpr` table of domain/option pairs, packed at compile time into one word
+ * with two bits per `esp_sleep_pd_domain_t`. Domains missing from the table stay at
+ * `ESP_PD_OPTION_AUTO`, the ESP-IDF default. `ESPRIC_PowerDown::apply()` compares the profile
+ * with the options issued so far in this boot and calls `esp_sleep_pd_config()` only for the
+ * domains that differ. ESP-IDF 5 counts `ESP_PD_OPTION_ON` requests per domain: `ESP_PD_OPTION_OFF`
+ * releases one, and `ESP_PD_OPTION_AUTO` only takes effect once no reference is left. Reissuing
+ * an unchanged domain is therefore not only slower but also changes the reference count, and a
+ * domain moving from ON to AUTO is first released with OFF. References taken by other code with
+ * `esp_sleep_pd_config()` are not tracked and keep their domain on.
+ *
+ * Failed domains are collected in a bitmask (bit n = domain n) instead of being logged, and keep
+ * their previous option so the next `apply()` retries them. The id, options and errors of the
+ * last applied profile are kept in `RTC_NOINIT_ATTR` memory, so the next boot can report the
+ * configuration the device slept with. ESP-IDF keeps its own configuration in ordinary RAM, so
+ * every boot starts again from `ESP_PD_OPTION_AUTO`.
+ *
+ * @code{.cpp}
+ * static ESPRIC_PowerDown powerDown;
+ * const uint16_t errors = powerDown.apply(ESPRIC_PD_PROFILE_DEEP_SLEEP);
+ * esp_deep_sleep_start();
+ * @endcode
+ */
+
+#ifndef ESPRIC_POWERDOWN_H
+#define ESPRIC_POWERDOWN_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <esp_sleep.h>
+#include <soc/soc_caps.h>
+
+static_assert(ESP_PD_DOMAIN_MAX <= 16, "ESPRIC_PowerDownProfile packs at most 16 domains");
+
+/**
+ * @struct ESPRIC_PowerDownSetting
+ * @brief One domain/option pair of a profile table.
+ */
+struct ESPRIC_PowerDownSetting {
+    esp_sleep_pd_domain_t domain; ///< Power domain.
+    esp_sleep_pd_option_t option; ///< Option of the domain in sleep mode.
+};
+
+/**
+ * @struct ESPRIC_PowerDownProfile
+ * @brief A profile packed into two bits per domain.
+ */
+struct ESPRIC_PowerDownProfile {
+    uint8_t id;       ///< Application-defined id, stored in RTC memory; 0 means none.
+    uint32_t options; ///< `esp_sleep_pd_option_t` of domain n in bits 2n and 2n+1.
+    uint16_t invalid; ///< Domains listed twice or with an out-of-range value; never issued.
+};
+
+/**
+ * @brief Packed options with every domain at `ESP_PD_OPTION_AUTO`.
+ */
+constexpr uint32_t espricPowerDownAutoOptions() {
+    uint32_t options = 0;
+    for (unsigned domain = 0; domain < ESP_PD_DOMAIN_MAX; domain++) {
+        options |= static_cast<uint32_t>(ESP_PD_OPTION_AUTO) << (2 * domain);
+    }
+    return options;
+}
+
+/**
+ * @brief Packs a profile table at compile time.
+ *
+ * @param id Application-defined id of the profile, 1 to 255.
+ * @param settings Domain/option pairs; unlisted domains stay at `ESP_PD_OPTION_AUTO`.
+ */
+template <size_t N>
+constexpr ESPRIC_PowerDownProfile espricPowerDownProfile(uint8_t id, const ESPRIC_PowerDownSetting (&settings)[N]) {
+    ESPRIC_PowerDownProfile profile{id, espricPowerDownAutoOptions(), 0};
+    uint16_t listed = 0;
+    for (size_t i = 0; i < N; i++) {
+        const unsigned domain = settings[i].domain;
+        if (domain >= ESP_PD_DOMAIN_MAX) {
+            continue; // Cannot be represented; a static_assert on `invalid` catches it
+        }
+        if ((listed & (1u << domain)) || settings[i].option > ESP_PD_OPTION_AUTO) {
+            profile.invalid |= 1u << domain;
+        }
+        listed |= 1u << domain;
+        profile.options = (profile.options & ~(3u << (2 * domain))) |
+                          (static_cast<uint32_t>(settings[i].option & 3u) << (2 * domain));
+    }
+    return profile;
+}
+
+/**
+ * @brief Settings of `ESPRIC_PD_PROFILE_DEEP_SLEEP`: RTC memory kept, everything else off.
+ *
+ * The set validated by `timing/ValidatePowerDownDomainConditions`.
+ */
+constexpr ESPRIC_PowerDownSetting ESPRIC_PD_DEEP_SLEEP_SETTINGS[] = {
+    {ESP_PD_DOMAIN_RTC8M, ESP_PD_OPTION_OFF},
+    {ESP_PD_DOMAIN_RTC_FAST_MEM, ESP_PD_OPTION_ON},
+    {ESP_PD_DOMAIN_RTC_SLOW_MEM, ESP_PD_OPTION_ON},
+    {ESP_PD_DOMAIN_RTC_PERIPH, ESP_PD_OPTION_OFF},
+    {ESP_PD_DOMAIN_XTAL, ESP_PD_OPTION_OFF},
+#if SOC_PM_SUPPORT_CPU_PD
+    {ESP_PD_DOMAIN_CPU, ESP_PD_OPTION_OFF},
+#endif
+    {ESP_PD_DOMAIN_VDDSDIO, ESP_PD_OPTION_OFF},
+};
+
+/**
+ * @brief Deep sleep that keeps RTC memory (e.g. `ESPRIC_BootHistory`) and powers down the rest.
+ */
+constexpr ESPRIC_PowerDownProfile ESPRIC_PD_PROFILE_DEEP_SLEEP = espricPowerDownProfile(1, ESPRIC_PD_DEEP_SLEEP_SETTINGS);
+
+/**
+ * @brief Settings of `ESPRIC_PD_PROFILE_RTC_PERIPH`: like deep sleep, with RTC IO and the ULP powered.
+ */
+constexpr ESPRIC_PowerDownSetting ESPRIC_PD_RTC_PERIPH_SETTINGS[] = {
+    {ESP_PD_DOMAIN_RTC8M, ESP_PD_OPTION_OFF},
+    {ESP_PD_DOMAIN_RTC_FAST_MEM, ESP_PD_OPTION_ON},
+    {ESP_PD_DOMAIN_RTC_SLOW_MEM, ESP_PD_OPTION_ON},
+    {ESP_PD_DOMAIN_RTC_PERIPH, ESP_PD_OPTION_ON},
+    {ESP_PD_DOMAIN_XTAL, ESP_PD_OPTION_OFF},
+#if SOC_PM_SUPPORT_CPU_PD
+    {ESP_PD_DOMAIN_CPU, ESP_PD_OPTION_OFF},
+#endif
+    {ESP_PD_DOMAIN_VDDSDIO, ESP_PD_OPTION_OFF},
+};
+
+/**
+ * @brief Deep sleep with EXT0 / touch wakeup or a running ULP program.
+ */
+constexpr ESPRIC_PowerDownProfile ESPRIC_PD_PROFILE_RTC_PERIPH = espricPowerDownProfile(2, ESPRIC_PD_RTC_PERIPH_SETTINGS);
+
+static_assert(ESPRIC_PD_PROFILE_DEEP_SLEEP.invalid == 0 && ESPRIC_PD_PROFILE_RTC_PERIPH.invalid == 0,
+              "Predefined power-down profiles list a domain twice");
+
+/**
+ * @struct ESPRIC_PowerDownStore
+ * @brief Last applied profile as kept in RTC memory.
+ */
+struct ESPRIC_PowerDownStore {
+    uint32_t magic;    ///< Marks an initialized store.
+    uint16_t version;  ///< Layout version.
+    uint8_t profile;   ///< Id of the last applied profile, 0 if none.
+    uint8_t reserved;  ///< Always 0.
+    uint32_t options;  ///< Options in effect after the last `apply()`, packed like the profile.
+    uint16_t errors;   ///< Domains that failed in the last `apply()`.
+    uint16_t domains;  ///< `ESP_PD_DOMAIN_MAX` of the writing firmware.
+    uint32_t checksum; ///< FNV-1a over all preceding bytes.
+};
+
+/**
+ * @brief Returns the store in RTC memory (ordinary memory on a host).
+ */
+ESPRIC_PowerDownStore& espricPowerDownStore();
+
+/**
+ * @class ESPRIC_PowerDown
+ * @brief Applies power-down profiles with one `esp_sleep_pd_config()` call per changed domain.
+ */
+class ESPRIC_PowerDown {
+public:
+    /**
+     * @brief Outcome of the validation of the store by `begin()`.
+     */
+    enum class StoreState : uint8_t {
+        Valid,       ///< The store holds the profile applied before the reset.
+        Initialized, ///< No store yet (power-on or first boot); cleared.
+        Corrupted    ///< Checksum or layout mismatch; cleared.
+    };
+
+    /**
+     * @brief Creates a power-down manager.
+     *
+     * @param store (Optional) Store for the last applied profile, RTC memory by default.
+     */
+    explicit ESPRIC_PowerDown(ESPRIC_PowerDownStore& store = espricPowerDownStore());
+
+    /**
+     * @brief Validates the store and reads the profile applied before the reset.
+     *
+     * Called by the first `apply()` if not called before. Later calls return the first result.
+     */
+    StoreState begin();
+
+    /**
+     * @brief Applies a profile.
+     *
+     * @return Domains whose `esp_sleep_pd_config()` call failed (bit n = domain n), or that the
+     *         profile lists twice or with an invalid option; 0 on success.
+     *
+     * Only domains whose option differs from the options in effect are issued. A domain moving
+     * from `ESP_PD_OPTION_ON` to `ESP_PD_OPTION_AUTO` takes two calls: OFF releases the ON
+     * reference, then AUTO. Failed domains keep the option reached before the failure and are
+     * retried by the next `apply()`.
+     */
+    uint16_t apply(const ESPRIC_PowerDownProfile& profile);
+
+    /**
+     * @brief Returns the error mask of the last `apply()` in this boot.
+     */
+    uint16_t errors() const { return errors_; }
+
+    /**
+     * @brief Returns the number of `esp_sleep_pd_config()` calls of the last `apply()`.
+     */
+    size_t issued() const { return issued_; }
+
+    /**
+     * @brief Returns the options in effect in this boot, packed like a profile.
+     */
+    uint32_t options() const { return options_; }
+
+    /**
+     * @brief Returns the id of the profile applied before the reset, 0 if none.
+     */
+    uint8_t previousProfile() const { return previousProfile_; }
+
+    /**
+     * @brief Returns the error mask of the last `apply()` before the reset.
+     */
+    uint16_t previousErrors() const { return previousErrors_; }
+
+    /**
+     * @brief Returns the result of `begin()`.
+     */
+    StoreState storeState() const { return storeState_; }
+
+    /**
+     * @brief Returns the FNV-1a checksum of a store.
+     */
+    static uint32_t checksumOf(const ESPRIC_PowerDownStore& store);
+
+private:
+    /**
+     * @brief Writes the options and errors in effect to the store.
+     */
+    void save(uint8_t profile);
+
+    ESPRIC_PowerDownStore& store_;                  ///< Store in RTC memory.
+    uint32_t options_ = espricPowerDownAutoOptions(); ///< Options issued in this boot.
+    uint16_t errors_ = 0;                           ///< Errors of the last apply().
+    uint16_t previousErrors_ = 0;                   ///< Errors before the reset.
+    uint8_t previousProfile_ = 0;                   ///< Profile before the reset.
+    uint8_t issued_ = 0;                            ///< Calls of the last apply().
+    bool begun_ = false;                            ///< begin() ran.
+    StoreState storeState_ = StoreState::Initialized; ///< Result of begin().
+};
+
+#endif // ESPRIC_POWERDOWN_H
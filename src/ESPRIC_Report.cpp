@@ -0,0 +1,201 @@
+/**
+ * @file ESPRIC_Report.cpp
+ * @brief Implementation of the report batch and the report sinks.
+ */
+
+#include "ESPRIC_Report.h"
+#include "ESPRIC_LogFormat.h"
+#include <stdio.h>
+#include <string.h>
+
+size_t espricFormatReportEvent(const ESPRIC_ReportEvent& event, char* out, size_t capacity) {
+    if (capacity == 0) {
+        return 0;
+    }
+    int size = 0;
+    ESPRIC_LogRecord record;
+    switch (event.type) {
+    case ESPRIC_ReportEventType::Note:
+        size = event.count == 0 ? snprintf(out, capacity, "%s", event.text != nullptr ? event.text : "")
+                                : snprintf(out, capacity, "%s %ld", event.text != nullptr ? event.text : "",
+                                           static_cast<long>(static_cast<int32_t>(event.values[0])));
+        break;
+    case ESPRIC_ReportEventType::Dropped:
+        size = snprintf(out, capacity, "report: %lu events dropped, batch full", static_cast<unsigned long>(event.values[0]));
+        break;
+    default:
+        // The other types share the wording of the tokenized log; indexed by type.
+        static constexpr uint16_t kIds[] = {ESPRIC_LOG_BOOT, ESPRIC_LOG_BOOT_LOOP, ESPRIC_LOG_RESET_REASON,
+                                            ESPRIC_LOG_WAKEUP_CAUSE, ESPRIC_LOG_ANALYSIS};
+        record.id = kIds[static_cast<size_t>(event.type)];
+        record.count = event.count;
+        memcpy(record.args, event.values, sizeof(event.values));
+        return espricLogExpand(record, out, capacity);
+    }
+    return size < 0 ? 0 : (static_cast<size_t>(size) < capacity ? size : capacity - 1);
+}
+
+bool ESPRIC_TextSink::deliver(const ESPRIC_ReportEvent* events, size_t count) {
+    char block[ESPRIC_REPORT_TEXT_SIZE];
+    char line[160];
+    size_t size = 0;
+    bool ok = true;
+    for (size_t i = 0; i < count; i++) {
+        const size_t length = espricFormatReportEvent(events[i], line, sizeof(line));
+        if (size != 0 && size + length + 1 > sizeof(block)) {
+            ok = output(block, size) && ok; // Only a batch larger than the block takes several writes
+            size = 0;
+        }
+        const size_t fit = length + 1 <= sizeof(block) ? length : sizeof(block) - 1;
+        memcpy(block + size, line, fit);
+        size += fit;
+        block[size++] = '\n';
+    }
+    if (size != 0) {
+        ok = output(block, size) && ok;
+    }
+    return ok;
+}
+
+ESPRIC_BufferSink::ESPRIC_BufferSink(char* buffer, size_t capacity) : buffer_(buffer), capacity_(capacity) {
+    clear();
+}
+
+void ESPRIC_BufferSink::clear() {
+    size_ = 0;
+    truncated_ = 0;
+    if (capacity_ != 0) {
+        buffer_[0] = '\0';
+    }
+}
+
+bool ESPRIC_BufferSink::deliver(const ESPRIC_ReportEvent* events, size_t count) {
+    char line[160];
+    const size_t before = truncated_;
+    for (size_t i = 0; i < count; i++) {
+        const size_t length = espricFormatReportEvent(events[i], line, sizeof(line));
+        if (size_ + length + 2 > capacity_) { // Line, line break and terminator
+            truncated_ += count - i;
+            break;
+        }
+        memcpy(buffer_ + size_, line, length);
+        size_ += length;
+        buffer_[size_++] = '\n';
+        buffer_[size_] = '\0';
+    }
+    return truncated_ == before;
+}
+
+bool ESPRIC_StdoutSink::output(const char* text, size_t size) {
+    const bool ok = fwrite(text, 1, size, stdout) == size;
+    return fflush(stdout) == 0 && ok;
+}
+
+#if !defined(ESPRIC_HOST)
+
+bool ESPRIC_SerialSink::output(const char* text, size_t size) {
+    return out_.write(reinterpret_cast<const uint8_t*>(text), size) == size;
+}
+
+bool ESPRIC_FileSink::deliver(const ESPRIC_ReportEvent* events, size_t count) {
+    file_ = fs_.open(path_, FILE_APPEND, true);
+    if (!file_) {
+        return false;
+    }
+    const bool ok = ESPRIC_TextSink::deliver(events, count);
+    file_.close();
+    return ok;
+}
+
+bool ESPRIC_FileSink::output(const char* text, size_t size) {
+    return file_.write(reinterpret_cast<const uint8_t*>(text), size) == size;
+}
+
+#endif
+
+bool ESPRIC_Report::add(const ESPRIC_ReportEvent& event) {
+    if (count_ >= ESPRIC_REPORT_MAX_EVENTS) {
+        dropped_++;
+        return false;
+    }
+    events_[count_++] = event;
+    return true;
+}
+
+bool ESPRIC_Report::boot(const ESPRIC_StartupContext& context) {
+    ESPRIC_ReportEvent event;
+    event.type = ESPRIC_ReportEventType::Boot;
+    event.count = 3;
+    event.values[0] = static_cast<uint32_t>(context.resetReason);
+    event.values[1] = static_cast<uint32_t>(context.wakeupCause);
+    event.values[2] = static_cast<uint32_t>(context.uptimeUs);
+    return add(event);
+}
+
+bool ESPRIC_Report::bootLoop(const ESPRIC_StartupContext& context) {
+    ESPRIC_ReportEvent event;
+    event.type = ESPRIC_ReportEventType::BootLoop;
+    event.count = 2;
+    event.values[0] = static_cast<uint32_t>(context.bootLoopState);
+    event.values[1] = context.recentCrashes;
+    return add(event);
+}
+
+bool ESPRIC_Report::analysis(size_t matched, size_t unmatched, size_t skipped, size_t deferred, size_t gated) {
+    ESPRIC_ReportEvent event;
+    event.type = ESPRIC_ReportEventType::Analysis;
+    event.count = 5;
+    event.values[0] = static_cast<uint32_t>(matched);
+    event.values[1] = static_cast<uint32_t>(unmatched);
+    event.values[2] = static_cast<uint32_t>(skipped);
+    event.values[3] = static_cast<uint32_t>(deferred);
+    event.values[4] = static_cast<uint32_t>(gated);
+    return add(event);
+}
+
+bool ESPRIC_Report::resetReason(esp_reset_reason_t reason) {
+    ESPRIC_ReportEvent event;
+    event.type = ESPRIC_ReportEventType::ResetReason;
+    event.count = 1;
+    event.values[0] = static_cast<uint32_t>(reason);
+    return add(event);
+}
+
+bool ESPRIC_Report::wakeupCause(esp_sleep_wakeup_cause_t cause) {
+    ESPRIC_ReportEvent event;
+    event.type = ESPRIC_ReportEventType::WakeupCause;
+    event.count = 1;
+    event.values[0] = static_cast<uint32_t>(cause);
+    return add(event);
+}
+
+bool ESPRIC_Report::note(const char* text) {
+    ESPRIC_ReportEvent event;
+    event.text = text;
+    return add(event);
+}
+
+bool ESPRIC_Report::note(const char* text, int32_t value) {
+    ESPRIC_ReportEvent event;
+    event.text = text;
+    event.count = 1;
+    event.values[0] = static_cast<uint32_t>(value);
+    return add(event);
+}
+
+size_t ESPRIC_Report::flush() {
+    size_t count = count_;
+    if (dropped_ != 0) {
+        ESPRIC_ReportEvent& event = events_[count++]; // The spare slot behind the batch
+        event = ESPRIC_ReportEvent();
+        event.type = ESPRIC_ReportEventType::Dropped;
+        event.count = 1;
+        event.values[0] = dropped_;
+    }
+    if (count != 0) {
+        sink_->deliver(events_, count);
+    }
+    count_ = 0;
+    dropped_ = 0;
+    return count;
+}
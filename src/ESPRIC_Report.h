@@ -0,0 +1,297 @@
+/**
+ * @file ESPRIC_Report.h
+ * @brief Batched analysis reports delivered to pluggable sinks.
+ *
+ * The analyzer and the callbacks add structured events (boot context, causes, analysis result,
+ * notes) to an `ESPRIC_Report` instead of printing lines. `flush()` hands the whole batch to an
+ * `ESPRIC_ReportSink` in one call; text sinks format it into one block and write it with a
+ * single call to the transport. With `ESPRIC::setReport()` the analyzer flushes once after all
+ * callbacks ran.
+ *
+ * Sinks:
+ * - `ESPRIC_SerialSink`: any `Print`, e.g. `Serial`, one bulk `write()` per flush.
+ * - `ESPRIC_BufferSink`: text in a caller-provided RAM buffer, e.g. for an upload.
+ * - `ESPRIC_FileSink`: appended to a file, e.g. on LittleFS, one open and write per flush.
+ * - `ESPRIC_StdoutSink`: `stdout`, the stand-in for `Serial` on a host.
+ *
+ * @code{.cpp}
+ * static ESPRIC_SerialSink sink(Serial);
+ * static ESPRIC_Report report(sink);
+ * analyzer.setReport(&report);
+ * analyzer.onResetReason(ESP_RST_PANIC, []() { report.note("Restoring defaults"); });
+ * analyzer.analyze(); // One write to Serial after all callbacks
+ * @endcode
+ */
+
+#ifndef ESPRIC_REPORT_H
+#define ESPRIC_REPORT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ESPRIC_StartupContext.h"
+
+#if !defined(ESPRIC_HOST)
+#include <FS.h>
+#include <Print.h>
+#endif
+
+/**
+ * @brief Events per batch; further events are dropped and counted until the next `flush()`.
+ */
+#ifndef ESPRIC_REPORT_MAX_EVENTS
+#define ESPRIC_REPORT_MAX_EVENTS 16
+#endif
+
+/**
+ * @brief Stack buffer of the text sinks; a batch of more text is written in several blocks.
+ */
+#ifndef ESPRIC_REPORT_TEXT_SIZE
+#define ESPRIC_REPORT_TEXT_SIZE 512
+#endif
+
+/**
+ * @enum ESPRIC_ReportEventType
+ * @brief Kind of a report event and meaning of its values.
+ */
+enum class ESPRIC_ReportEventType : uint8_t {
+    Boot,        ///< Reset reason, wakeup cause, uptime in microseconds.
+    BootLoop,    ///< `ESPRIC_BootLoopState`, recent crashes.
+    ResetReason, ///< Reset reason reported by a handler.
+    WakeupCause, ///< Wakeup cause reported by a handler.
+    Analysis,    ///< Matched, unmatched, skipped, deferred, gated.
+    Note,        ///< Application text, optionally one signed value.
+    Dropped      ///< Events dropped because the batch was full.
+};
+
+/**
+ * @struct ESPRIC_ReportEvent
+ * @brief One structured event; no strings are built when it is added.
+ */
+struct ESPRIC_ReportEvent {
+    ESPRIC_ReportEventType type = ESPRIC_ReportEventType::Note; ///< Kind of event.
+    uint8_t count = 0;                                          ///< Valid entries of `values`.
+    const char* text = nullptr;                                 ///< Text of a note, in static storage.
+    uint32_t values[5] = {};                                    ///< Values in the order of the type.
+};
+
+/**
+ * @brief Formats one event as a line without line break, in the wording of `ESPRIC_LogFormat.h`.
+ *
+ * @return Length of the text (truncated to `capacity - 1`).
+ */
+size_t espricFormatReportEvent(const ESPRIC_ReportEvent& event, char* out, size_t capacity);
+
+/**
+ * @class ESPRIC_ReportSink
+ * @brief Transport of report batches.
+ */
+class ESPRIC_ReportSink {
+public:
+    virtual ~ESPRIC_ReportSink() = default;
+
+    /**
+     * @brief Delivers a batch of events.
+     *
+     * @return `false` if the transport failed.
+     */
+    virtual bool deliver(const ESPRIC_ReportEvent* events, size_t count) = 0;
+};
+
+/**
+ * @class ESPRIC_TextSink
+ * @brief Base of the sinks that write text: formats a batch into one block per `output()` call.
+ */
+class ESPRIC_TextSink : public ESPRIC_ReportSink {
+public:
+    bool deliver(const ESPRIC_ReportEvent* events, size_t count) override;
+
+protected:
+    /**
+     * @brief Writes one block of lines to the transport.
+     */
+    virtual bool output(const char* text, size_t size) = 0;
+};
+
+/**
+ * @class ESPRIC_BufferSink
+ * @brief Appends the text of every batch to a caller-provided buffer.
+ */
+class ESPRIC_BufferSink : public ESPRIC_ReportSink {
+public:
+    /**
+     * @param buffer Text buffer, kept null-terminated.
+     * @param capacity Size of `buffer` in bytes.
+     */
+    ESPRIC_BufferSink(char* buffer, size_t capacity);
+
+    bool deliver(const ESPRIC_ReportEvent* events, size_t count) override;
+
+    /**
+     * @brief Returns the collected text.
+     */
+    const char* text() const { return buffer_; }
+
+    /**
+     * @brief Returns the length of the collected text.
+     */
+    size_t size() const { return size_; }
+
+    /**
+     * @brief Returns the number of lines that did not fit; the buffer holds only whole lines.
+     */
+    size_t truncated() const { return truncated_; }
+
+    /**
+     * @brief Empties the buffer.
+     */
+    void clear();
+
+private:
+    char* buffer_;         ///< Caller-provided text buffer.
+    size_t capacity_;      ///< Size of `buffer_`.
+    size_t size_ = 0;      ///< Length of the text.
+    size_t truncated_ = 0; ///< Lines that did not fit.
+};
+
+/**
+ * @class ESPRIC_StdoutSink
+ * @brief Writes batches to `stdout`, the stand-in for `Serial` on a host.
+ */
+class ESPRIC_StdoutSink : public ESPRIC_TextSink {
+protected:
+    bool output(const char* text, size_t size) override;
+};
+
+#if !defined(ESPRIC_HOST)
+
+/**
+ * @class ESPRIC_SerialSink
+ * @brief Writes batches to a `Print`, e.g. `Serial`, with one `write()` per block.
+ *
+ * With a TX buffer at least as large as a batch (`Serial.setTxBufferSize()` before `begin()`)
+ * the write returns without waiting for the UART.
+ */
+class ESPRIC_SerialSink : public ESPRIC_TextSink {
+public:
+    /**
+     * @param out Destination, e.g. `Serial`.
+     */
+    explicit ESPRIC_SerialSink(Print& out) : out_(out) {}
+
+protected:
+    bool output(const char* text, size_t size) override;
+
+private:
+    Print& out_; ///< Destination.
+};
+
+/**
+ * @class ESPRIC_FileSink
+ * @brief Appends batches to a file, e.g. on LittleFS.
+ */
+class ESPRIC_FileSink : public ESPRIC_TextSink {
+public:
+    /**
+     * @param fs Mounted file system, e.g. `LittleFS`.
+     * @param path File path; the file is created if it does not exist.
+     */
+    ESPRIC_FileSink(fs::FS& fs, const char* path) : fs_(fs), path_(path) {}
+
+    bool deliver(const ESPRIC_ReportEvent* events, size_t count) override;
+
+protected:
+    bool output(const char* text, size_t size) override;
+
+private:
+    fs::FS& fs_;       ///< File system of the file.
+    const char* path_; ///< File path.
+    File file_;        ///< Open during `deliver()` only.
+};
+
+#endif
+
+/**
+ * @class ESPRIC_Report
+ * @brief Collects events in a fixed-size batch and flushes them to a sink.
+ */
+class ESPRIC_Report {
+public:
+    /**
+     * @param sink Transport of the batches; must outlive the report.
+     */
+    explicit ESPRIC_Report(ESPRIC_ReportSink& sink) : sink_(&sink) {}
+
+    /**
+     * @brief Replaces the sink; pending events go to the new sink.
+     */
+    void setSink(ESPRIC_ReportSink& sink) { sink_ = &sink; }
+
+    /**
+     * @brief Adds an event to the batch.
+     *
+     * @return `false` if the batch is full and the event was dropped.
+     */
+    bool add(const ESPRIC_ReportEvent& event);
+
+    /**
+     * @brief Adds the reset reason, wakeup cause and uptime of a context.
+     */
+    bool boot(const ESPRIC_StartupContext& context);
+
+    /**
+     * @brief Adds the boot-loop state and recent crashes of a context.
+     */
+    bool bootLoop(const ESPRIC_StartupContext& context);
+
+    /**
+     * @brief Adds the counts of an `ESPRIC::AnalysisResult`.
+     */
+    bool analysis(size_t matched, size_t unmatched, size_t skipped, size_t deferred, size_t gated);
+
+    /**
+     * @brief Adds a reset reason, e.g. from a dispatch handler.
+     */
+    bool resetReason(esp_reset_reason_t reason);
+
+    /**
+     * @brief Adds a wakeup cause, e.g. from a dispatch handler.
+     */
+    bool wakeupCause(esp_sleep_wakeup_cause_t cause);
+
+    /**
+     * @brief Adds an application note.
+     *
+     * @param text Text in static storage; only the pointer is kept until the flush.
+     */
+    bool note(const char* text);
+
+    /**
+     * @brief Adds an application note with a value, printed after the text.
+     */
+    bool note(const char* text, int32_t value);
+
+    /**
+     * @brief Delivers the batch to the sink in one call and empties it.
+     *
+     * @return Number of events delivered, including a `Dropped` event if events were dropped.
+     */
+    size_t flush();
+
+    /**
+     * @brief Returns the number of events in the batch.
+     */
+    size_t pending() const { return count_; }
+
+    /**
+     * @brief Returns the number of events dropped since the last flush.
+     */
+    uint32_t dropped() const { return dropped_; }
+
+private:
+    ESPRIC_ReportSink* sink_;                           ///< Transport of the batches.
+    ESPRIC_ReportEvent events_[ESPRIC_REPORT_MAX_EVENTS + 1]; ///< Batch plus room for the `Dropped` event.
+    size_t count_ = 0;                                  ///< Events in the batch.
+    uint32_t dropped_ = 0;                              ///< Events dropped since the last flush.
+};
+
+#endif // ESPRIC_REPORT_H
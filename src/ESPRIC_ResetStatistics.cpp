@@ -0,0 +1,176 @@
+/**
+ * @file ESPRIC_ResetStatistics.cpp
+ * @brief Implementation of the write-coalesced reset statistics store.
+ */
+
+#include "ESPRIC_ResetStatistics.h"
+#include <esp_timer.h>
+
+static const char* const kBootsKey = "boots"; ///< NVS key of the boot counter.
+
+/**
+ * @brief Formats the NVS key of counter `index`, e.g. `r4` for reset reason 4 or `w4` for wakeup cause 4.
+ */
+static const char* counterKey(char (&key)[4], char prefix, unsigned index) {
+    key[0] = prefix;
+    key[1] = static_cast<char>(index < 10 ? '0' + index : '0' + index / 10);
+    key[2] = index < 10 ? '\0' : static_cast<char>('0' + index % 10);
+    key[3] = '\0';
+    return key;
+}
+
+ESPRIC_ResetStatistics::ESPRIC_ResetStatistics(const char* nvsNamespace, CommitPolicy policy,
+                                               uint32_t commitDelayMs)
+    : namespace_(nvsNamespace), policy_(policy), commitDelayMs_(commitDelayMs) {}
+
+/**
+ * @brief Loads every counter; a missing key is a counter of 0.
+ */
+bool ESPRIC_ResetStatistics::begin() {
+    if (!open_) {
+        open_ = preferences_.begin(namespace_, false);
+        if (!open_) {
+            return false;
+        }
+    }
+    char key[4];
+    boots_ = preferences_.getUInt(kBootsKey, 0);
+    for (unsigned i = 0; i < ESPRIC_STATISTICS_RESET_REASONS; i++) {
+        reset_[i] = preferences_.getUInt(counterKey(key, 'r', i), 0);
+    }
+    for (unsigned i = 0; i < ESPRIC_STATISTICS_WAKEUP_CAUSES; i++) {
+        wakeup_[i] = preferences_.getUInt(counterKey(key, 'w', i), 0);
+    }
+    dirtyBoots_ = false;
+    dirtyReasons_ = 0;
+    dirtyCauses_ = 0;
+    return boots_ != 0;
+}
+
+void ESPRIC_ResetStatistics::end() {
+    if (open_) {
+        commit();
+        preferences_.end();
+        open_ = false;
+    }
+}
+
+void ESPRIC_ResetStatistics::record(const ESPRIC_StartupContext& context) {
+    markDirty();
+    boots_++;
+    dirtyBoots_ = true;
+    const unsigned reason = static_cast<unsigned>(context.resetReason);
+    if (reason < ESPRIC_STATISTICS_RESET_REASONS) {
+        reset_[reason]++;
+        dirtyReasons_ |= 1UL << reason;
+    }
+    const unsigned cause = static_cast<unsigned>(context.wakeupCause);
+    if (cause < ESPRIC_STATISTICS_WAKEUP_CAUSES) {
+        wakeup_[cause]++;
+        dirtyCauses_ |= 1UL << cause;
+    }
+}
+
+void ESPRIC_ResetStatistics::analysisDone() {
+    if (policy_ == CommitPolicy::AfterAnalyze) {
+        commit();
+    }
+}
+
+bool ESPRIC_ResetStatistics::poll() {
+    if (!dirty() || policy_ != CommitPolicy::Delayed) {
+        return false;
+    }
+    if (esp_timer_get_time() - dirtySinceUs_ < static_cast<int64_t>(commitDelayMs_) * 1000) {
+        return false;
+    }
+    return commit();
+}
+
+/**
+ * @brief Writes the counters that changed, one `putUInt` (one NVS entry) each.
+ *
+ * A counter that fails to write stays dirty, so the next commit retries it.
+ */
+bool ESPRIC_ResetStatistics::commit() {
+    if (!dirty()) {
+        return true;
+    }
+    if (!open_) {
+        return false; // begin() was not called or failed
+    }
+    char key[4];
+    if (dirtyBoots_ && store(kBootsKey, boots_)) {
+        dirtyBoots_ = false;
+    }
+    for (unsigned i = 0; i < ESPRIC_STATISTICS_RESET_REASONS; i++) {
+        if ((dirtyReasons_ & (1UL << i)) != 0 && store(counterKey(key, 'r', i), reset_[i])) {
+            dirtyReasons_ &= ~(1UL << i);
+        }
+    }
+    for (unsigned i = 0; i < ESPRIC_STATISTICS_WAKEUP_CAUSES; i++) {
+        if ((dirtyCauses_ & (1UL << i)) != 0 && store(counterKey(key, 'w', i), wakeup_[i])) {
+            dirtyCauses_ &= ~(1UL << i);
+        }
+    }
+    return !dirty();
+}
+
+bool ESPRIC_ResetStatistics::store(const char* key, uint32_t value) {
+    bool stored;
+    if (value == 0) {
+        preferences_.remove(key); // fails only if the key is absent, which also reads as 0
+        stored = true;
+    } else {
+        stored = preferences_.putUInt(key, value) == sizeof(value);
+    }
+    if (stored) {
+        commits_++;
+    }
+    return stored;
+}
+
+uint32_t ESPRIC_ResetStatistics::resetCount(esp_reset_reason_t reason) const {
+    const unsigned index = static_cast<unsigned>(reason);
+    return index < ESPRIC_STATISTICS_RESET_REASONS ? reset_[index] : 0;
+}
+
+uint32_t ESPRIC_ResetStatistics::wakeupCount(esp_sleep_wakeup_cause_t cause) const {
+    const unsigned index = static_cast<unsigned>(cause);
+    return index < ESPRIC_STATISTICS_WAKEUP_CAUSES ? wakeup_[index] : 0;
+}
+
+void ESPRIC_ResetStatistics::clear() {
+    markDirty();
+    if (boots_ != 0) {
+        boots_ = 0;
+        dirtyBoots_ = true;
+    }
+    for (unsigned i = 0; i < ESPRIC_STATISTICS_RESET_REASONS; i++) {
+        if (reset_[i] != 0) {
+            reset_[i] = 0;
+            dirtyReasons_ |= 1UL << i;
+        }
+    }
+    for (unsigned i = 0; i < ESPRIC_STATISTICS_WAKEUP_CAUSES; i++) {
+        if (wakeup_[i] != 0) {
+            wakeup_[i] = 0;
+            dirtyCauses_ |= 1UL << i;
+        }
+    }
+}
+
+void ESPRIC_ResetStatistics::clear(esp_reset_reason_t reason) {
+    const unsigned index = static_cast<unsigned>(reason);
+    if (index < ESPRIC_STATISTICS_RESET_REASONS && reset_[index] != 0) {
+        markDirty();
+        reset_[index] = 0;
+        dirtyReasons_ |= 1UL << index;
+    }
+}
+
+void ESPRIC_ResetStatistics::markDirty() {
+    if (!dirty()) {
+        dirtySinceUs_ = esp_timer_get_time();
+    }
+}
@@ -0,0 +1,177 @@
+/**
+ * @file ESPRIC_ResetStatistics.h
+ * @brief Per-reason boot counters with write-coalesced NVS persistence.
+ *
+ * `ESPRIC_ResetStatistics` keeps a counter per reset reason and per wakeup cause in RAM. The
+ * counters are loaded once by `begin()`, updated by `ESPRIC::analyze()` (see
+ * `ESPRIC::setResetStatistics()`) or `record()`, and written back through one namespace handle.
+ * Every counter is its own `putUInt` key (one 32-byte NVS entry), and a commit writes only the
+ * counters that changed: a boot costs the boot counter plus the counters of its reason and
+ * cause, three entries, whatever the number of counters. Cleared counters are removed.
+ *
+ * When to commit is selected with `CommitPolicy`:
+ * - `AfterAnalyze`: one commit at the end of every analysis, after all callbacks ran.
+ * - `Delayed`: `poll()` commits once the counters have been dirty for the configured delay.
+ *   Call `commit()` before entering deep sleep.
+ * - `Manual`: only `commit()` writes.
+ */
+
+#ifndef ESPRIC_RESETSTATISTICS_H
+#define ESPRIC_RESETSTATISTICS_H
+
+#include <stdint.h>
+#include <esp_system.h>
+#include <esp_sleep.h>
+#include <Preferences.h>
+#include "ESPRIC_StartupContext.h"
+#include "ESPRIC_CauseNames.h"
+
+/**
+ * @brief Number of reset reasons counted by `ESPRIC_ResetStatistics` (at most 32).
+ */
+#ifndef ESPRIC_STATISTICS_RESET_REASONS
+#define ESPRIC_STATISTICS_RESET_REASONS ESPRIC_RESET_REASON_NAME_COUNT
+#endif
+
+/**
+ * @brief Number of wakeup causes counted by `ESPRIC_ResetStatistics` (at most 32).
+ */
+#ifndef ESPRIC_STATISTICS_WAKEUP_CAUSES
+#define ESPRIC_STATISTICS_WAKEUP_CAUSES ESPRIC_WAKEUP_CAUSE_NAME_COUNT
+#endif
+
+/**
+ * @class ESPRIC_ResetStatistics
+ * @brief RAM counters of reset reasons and wakeup causes, persisting only the counters that changed.
+ */
+class ESPRIC_ResetStatistics {
+public:
+    /**
+     * @enum CommitPolicy
+     * @brief Selects when the counters are written to NVS.
+     */
+    enum class CommitPolicy : uint8_t {
+        AfterAnalyze, ///< Commit once at the end of every `ESPRIC::analyze()`.
+        Delayed,      ///< Commit from `poll()` after the counters have been dirty for the delay.
+        Manual        ///< Commit only when `commit()` is called.
+    };
+
+    /**
+     * @brief Creates the statistics store.
+     *
+     * @param nvsNamespace NVS namespace of the counters (at most 15 characters).
+     * @param policy When the counters are written to NVS.
+     * @param commitDelayMs Delay for `CommitPolicy::Delayed` in milliseconds.
+     */
+    explicit ESPRIC_ResetStatistics(const char* nvsNamespace = "espric_stats",
+                                    CommitPolicy policy = CommitPolicy::AfterAnalyze,
+                                    uint32_t commitDelayMs = 0);
+
+    /**
+     * @brief Opens the NVS namespace and loads the counters.
+     *
+     * The namespace stays open for the commits until `end()`, so a boot costs one namespace
+     * open and the writes of the changed counters.
+     *
+     * @return `true` if stored counters were loaded, `false` if the store starts empty.
+     */
+    bool begin();
+
+    /**
+     * @brief Commits pending changes and closes the NVS namespace.
+     */
+    void end();
+
+    /**
+     * @brief Counts one boot with the reset reason and wakeup cause of `context`.
+     *
+     * Only RAM is touched. Called by `ESPRIC::analyze()` when the store is attached.
+     */
+    void record(const ESPRIC_StartupContext& context);
+
+    /**
+     * @brief Applies the commit policy at the end of an analysis. Called by `ESPRIC::analyze()`.
+     */
+    void analysisDone();
+
+    /**
+     * @brief Commits pending changes once the delay of `CommitPolicy::Delayed` has elapsed.
+     *
+     * @return `true` if a commit was performed.
+     */
+    bool poll();
+
+    /**
+     * @brief Writes the counters to NVS if they changed since the last commit.
+     *
+     * @return `true` if the counters are persisted (or nothing had to be written).
+     */
+    bool commit();
+
+    /**
+     * @brief Returns `true` if the counters changed since the last commit.
+     */
+    bool dirty() const { return dirtyBoots_ || dirtyReasons_ != 0 || dirtyCauses_ != 0; }
+
+    /**
+     * @brief Returns the number of boots counted.
+     */
+    uint32_t boots() const { return boots_; }
+
+    /**
+     * @brief Returns the number of boots with the given reset reason.
+     */
+    uint32_t resetCount(esp_reset_reason_t reason) const;
+
+    /**
+     * @brief Returns the number of boots with the given wakeup cause.
+     */
+    uint32_t wakeupCount(esp_sleep_wakeup_cause_t cause) const;
+
+    /**
+     * @brief Clears all counters in RAM; the next commit persists the change.
+     */
+    void clear();
+
+    /**
+     * @brief Clears the counter of one reset reason in RAM; the next commit persists the change.
+     */
+    void clear(esp_reset_reason_t reason);
+
+    /**
+     * @brief Returns the number of counters written to or removed from NVS, e.g. to watch flash wear.
+     */
+    uint32_t commits() const { return commits_; }
+
+private:
+    static_assert(ESPRIC_STATISTICS_RESET_REASONS <= 32 && ESPRIC_STATISTICS_WAKEUP_CAUSES <= 32,
+                  "the dirty masks hold 32 counters each");
+
+    /**
+     * @brief Remembers when the counters became dirty; call before setting a dirty flag.
+     */
+    void markDirty();
+
+    /**
+     * @brief Writes one counter, or removes its key if the counter is 0.
+     *
+     * @return `true` if NVS holds the value.
+     */
+    bool store(const char* key, uint32_t value);
+
+    Preferences preferences_; ///< NVS namespace handle, open between `begin()` and `end()`.
+    bool open_ = false;      ///< True while `preferences_` is open.
+    const char* namespace_;  ///< NVS namespace of the counters.
+    CommitPolicy policy_;    ///< When to commit.
+    uint32_t commitDelayMs_; ///< Delay for `CommitPolicy::Delayed`.
+    uint32_t boots_ = 0;     ///< Boots counted.
+    uint32_t reset_[ESPRIC_STATISTICS_RESET_REASONS] = {};  ///< Boots per reset reason.
+    uint32_t wakeup_[ESPRIC_STATISTICS_WAKEUP_CAUSES] = {}; ///< Boots per wakeup cause.
+    bool dirtyBoots_ = false;  ///< True if `boots_` differs from NVS.
+    uint32_t dirtyReasons_ = 0; ///< Bit per entry of `reset_` that differs from NVS.
+    uint32_t dirtyCauses_ = 0;  ///< Bit per entry of `wakeup_` that differs from NVS.
+    int64_t dirtySinceUs_ = 0; ///< `esp_timer_get_time()` when the counters became dirty.
+    uint32_t commits_ = 0;   ///< Counters written or removed.
+};
+
+#endif // ESPRIC_RESETSTATISTICS_H
@@ -0,0 +1,43 @@
+/**
+ * @file ESPRIC_StartupContext.cpp
+ * @brief Implementation of the startup context capture.
+ */
+
+#include "ESPRIC_StartupContext.h"
+#include <soc/soc_caps.h>
+#include <esp_rom_sys.h>
+#include <esp_timer.h>
+
+/**
+ * @brief Reads all startup values from the ESP-IDF in one pass.
+ * 
+ * Wakeup masks are only read on SoCs that provide the corresponding wakeup source. 
+ * The remaining fields keep their zero defaults.
+ * 
+ * @return ESPRIC_StartupContext The captured snapshot.
+ */
+ESPRIC_StartupContext ESPRIC_StartupContext::capture() {
+    ESPRIC_StartupContext context;
+    context.resetReason = esp_reset_reason();
+    context.wakeupCause = esp_sleep_get_wakeup_cause();
+
+#if SOC_PM_SUPPORT_EXT1_WAKEUP || SOC_PM_SUPPORT_EXT_WAKEUP
+    if (context.wakeupCause == ESP_SLEEP_WAKEUP_EXT1) {
+        context.ext1WakeupMask = esp_sleep_get_ext1_wakeup_status();
+    }
+#endif
+#if SOC_GPIO_SUPPORT_DEEPSLEEP_WAKEUP
+    if (context.wakeupCause == ESP_SLEEP_WAKEUP_GPIO) {
+        context.gpioWakeupMask = esp_sleep_get_gpio_wakeup_status();
+    }
+#endif
+
+    const int cores = SOC_CPU_CORES_NUM < ESPRIC_MAX_CORES ? SOC_CPU_CORES_NUM : ESPRIC_MAX_CORES;
+    for (int core = 0; core < cores; ++core) {
+        context.rawResetReason[core] = static_cast<uint8_t>(esp_rom_get_reset_reason(core));
+    }
+    context.coreCount = static_cast<uint8_t>(cores);
+
+    context.uptimeUs = esp_timer_get_time();
+    return context;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file ESPRIC_StartupContext.h
+ * @brief Snapshot of the ESP32 startup state that is shared by all ESPRIC conditions.
+ * 
+ * The `ESPRIC_StartupContext` structure collects every value conditions typically query from 
+ * the ESP-IDF (reset reason, wakeup cause, wakeup masks, raw per-core reset reasons, uptime). 
+ * It is captured once per analysis and passed by const reference to each condition, so one 
+ * analysis pass performs each ROM/HAL call only once and evaluates deterministically.
+ */
+
+#ifndef ESPRIC_STARTUPCONTEXT_H
+#define ESPRIC_STARTUPCONTEXT_H
+
+#include <stdint.h>
+#include <esp_system.h>
+#include <esp_sleep.h>
+
+/**
+ * @brief Number of CPU cores whose raw reset reasons are recorded.
+ */
+#ifndef ESPRIC_MAX_CORES
+#define ESPRIC_MAX_CORES 2
+#endif
+
+/**
+ * @enum ESPRIC_BootLoopState
+ * @brief Escalation level of a boot loop, set by `ESPRIC_BootLoopDetector`.
+ *
+ * The levels are ordered, so conditions can compare them, e.g. `>= ESPRIC_BootLoopState::SafeMode`.
+ */
+enum class ESPRIC_BootLoopState : uint8_t {
+    Normal,   ///< No boot loop, or no detector attached.
+    Degraded, ///< Repeated crashes: skip optional features.
+    SafeMode, ///< Boot loop: start only what is needed to recover, e.g. OTA.
+    Halt      ///< Persistent boot loop: stop rebooting until serviced.
+};
+
+/**
+ * @struct ESPRIC_StartupContext
+ * @brief Startup state captured once per boot.
+ * 
+ * The structure is a plain value type. Recorded contexts can be constructed directly, 
+ * e.g. on a Linux host, and passed to `ESPRIC::analyze(const StartupContext&)`.
+ */
+struct ESPRIC_StartupContext {
+    esp_reset_reason_t resetReason = ESP_RST_UNKNOWN;                ///< Result of `esp_reset_reason()`.
+    esp_sleep_wakeup_cause_t wakeupCause = ESP_SLEEP_WAKEUP_UNDEFINED; ///< Result of `esp_sleep_get_wakeup_cause()`.
+    uint64_t ext1WakeupMask = 0;                 ///< GPIOs that caused an EXT1 wakeup (0 if unsupported).
+    uint64_t gpioWakeupMask = 0;                 ///< GPIOs that caused a deep-sleep GPIO wakeup (0 if unsupported).
+    uint8_t rawResetReason[ESPRIC_MAX_CORES] = {}; ///< Raw ROM reset reason (`soc_reset_reason_t`) per core.
+    uint8_t coreCount = 0;                       ///< Number of valid entries in `rawResetReason`.
+    int64_t uptimeUs = 0;                        ///< `esp_timer_get_time()` at capture time in microseconds.
+    ESPRIC_BootLoopState bootLoopState = ESPRIC_BootLoopState::Normal; ///< Set by `ESPRIC_BootLoopDetector`.
+    uint8_t recentCrashes = 0;                   ///< Crash resets in the detector window, including this boot.
+
+    /**
+     * @brief Captures the current startup state from the ESP-IDF.
+     * 
+     * @return A fully populated context.
+     */
+    static ESPRIC_StartupContext capture();
+};
+
+#endif // ESPRIC_STARTUPCONTEXT_H
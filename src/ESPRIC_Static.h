@@ -0,0 +1,152 @@
+/**
+ * @file ESPRIC_Static.h
+ * @brief Compile-time variant of the ESPRIC analyzer with flash-resident condition tables.
+ * 
+ * `StaticESPRIC` evaluates a `constexpr` array of plain function pointer descriptors. The 
+ * table is placed in .rodata, nothing is allocated on the heap, and because the table is a 
+ * template argument the compiler sees every predicate and handler at the call site and can 
+ * inline the whole dispatch.
+ * 
+ * @code{.cpp}
+ * static void onPanic() { Serial.println("Panic reset detected."); }
+ * 
+ * static constexpr ESPRIC_StaticCondition kConditions[] = {
+ *     {espricResetReasonIs<ESP_RST_PANIC>, onPanic},
+ *     {espricWakeupCauseIs<ESP_SLEEP_WAKEUP_TIMER>, []() { Serial.println("Timer wakeup."); }},
+ * };
+ * 
+ * StaticESPRIC<kConditions> espric;
+ * espric.analyze();
+ * @endcode
+ */
+
+#ifndef ESPRIC_STATIC_H
+#define ESPRIC_STATIC_H
+
+#include <stddef.h>
+#include <type_traits>
+#include <utility>
+#include "ESPRIC.h"
+
+/**
+ * @struct ESPRIC_StaticCondition
+ * @brief A predicate/handler descriptor for `StaticESPRIC` tables.
+ * 
+ * Both members are plain function pointers, so arrays of descriptors can be `constexpr`. 
+ * Captureless lambdas convert implicitly. A `nullptr` handler only counts the match.
+ */
+struct ESPRIC_StaticCondition {
+    bool (*predicate)(const ESPRIC_StartupContext&); ///< The condition to evaluate.
+    void (*handler)();                               ///< The handler to execute if the condition is true.
+};
+
+/**
+ * @brief Predicate that matches a specific reset reason.
+ * 
+ * @tparam Reason The reset reason to match.
+ */
+template <esp_reset_reason_t Reason>
+bool espricResetReasonIs(const ESPRIC_StartupContext& context) {
+    return context.resetReason == Reason;
+}
+
+/**
+ * @brief Predicate that matches a specific wakeup cause.
+ * 
+ * @tparam Cause The wakeup cause to match.
+ */
+template <esp_sleep_wakeup_cause_t Cause>
+bool espricWakeupCauseIs(const ESPRIC_StartupContext& context) {
+    return context.wakeupCause == Cause;
+}
+
+/**
+ * @brief Predicate that matches sets of reset reasons and wakeup causes.
+ * 
+ * @tparam ResetMask Accepted reset reasons as a cause mask, 0 for any.
+ * @tparam WakeupMask Accepted wakeup causes as a cause mask, 0 for any.
+ */
+template <uint32_t ResetMask, uint32_t WakeupMask = 0>
+bool espricCauseIn(const ESPRIC_StartupContext& context) {
+    return espricMaskMatches(espricPackState(context.resetReason, context.wakeupCause),
+                             espricPackMask(ResetMask, WakeupMask));
+}
+
+/**
+ * @class StaticESPRIC
+ * @brief Analyzer over a compile-time condition table.
+ * 
+ * @tparam Table A `constexpr` array of `ESPRIC_StaticCondition` with static storage duration.
+ * @tparam DefaultHandler (Optional) Handler executed if no condition is met.
+ * 
+ * The class has no data members. Evaluation order and semantics match `ESPRIC::analyze()`: 
+ * all descriptors are evaluated in table order, the handler of every matching descriptor is 
+ * executed, and the default handler runs if nothing matched.
+ */
+template <const auto& Table, void (*DefaultHandler)() = nullptr>
+class StaticESPRIC {
+    using TableType = typename std::remove_reference<decltype(Table)>::type;
+    static_assert(std::is_array<TableType>::value, "StaticESPRIC requires an array of ESPRIC_StaticCondition");
+    static_assert(std::is_same<typename std::remove_cv<typename std::remove_extent<TableType>::type>::type,
+                               ESPRIC_StaticCondition>::value,
+                  "StaticESPRIC requires an array of ESPRIC_StaticCondition");
+
+public:
+    /**
+     * @brief Number of descriptors in the table.
+     */
+    static constexpr size_t size = std::extent<TableType>::value;
+
+    /**
+     * @brief Captures the startup context and analyzes the table.
+     * 
+     * @return An `ESPRIC::AnalysisResult` with the counts of matched and unmatched conditions.
+     */
+    ESPRIC::AnalysisResult analyze() const {
+        return analyze(ESPRIC_StartupContext::capture());
+    }
+
+    /**
+     * @brief Analyzes the table against a given startup context.
+     * 
+     * @param context The startup state to evaluate.
+     * @return An `ESPRIC::AnalysisResult` with the counts of matched and unmatched conditions.
+     */
+    ESPRIC::AnalysisResult analyze(const ESPRIC_StartupContext& context) const {
+        const size_t matched = evaluate(context, std::make_index_sequence<size>{});
+        if constexpr (DefaultHandler != nullptr) {
+            if (matched == 0) {
+                DefaultHandler();
+            }
+        }
+        return {matched, size - matched};
+    }
+
+private:
+    /**
+     * @brief Evaluates all descriptors in table order (unrolled at compile time).
+     */
+    template <size_t... Index>
+    static size_t evaluate(const ESPRIC_StartupContext& context, std::index_sequence<Index...>) {
+        size_t matched = 0;
+        ((matched += evaluateOne<Index>(context) ? 1 : 0), ...); // Comma fold keeps table order
+        return matched;
+    }
+
+    /**
+     * @brief Evaluates one descriptor and executes its handler on a match.
+     */
+    template <size_t Index>
+    static bool evaluateOne(const ESPRIC_StartupContext& context) {
+        static_assert(Table[Index].predicate != nullptr, "StaticESPRIC descriptors require a predicate");
+        if (!Table[Index].predicate(context)) {
+            return false;
+        }
+        if constexpr (Table[Index].handler != nullptr) {
+            Table[Index].handler();
+        }
+        return true;
+    }
+};
+
+#endif // ESPRIC_STATIC_H
@@ -0,0 +1,81 @@
+/**
+ * @file ESPRIC_TargetTable.h
+ * @brief Layout and helpers for the generated per-target cause tables.
+ *
+ * `variants/ESPRIC_TargetTables.h` is generated by `tools/ConditionTableGenerator` from
+ * `esp_reset_reason_t` and `esp_sleep_wakeup_cause_t` in the ESP-IDF headers. Every target is a
+ * struct with the reset reasons and wakeup causes it can report, their masks and its name:
+ *
+ * @code{.cpp}
+ * struct ESPRIC_Target_ESP32C3 {
+ *     static constexpr const char* kName = "ESP32-C3";
+ *     static constexpr ESPRIC_TargetCause kResetReasons[] = {...};
+ *     static constexpr uint32_t kResetMask = ...;
+ *     static constexpr ESPRIC_TargetCause kWakeupCauses[] = {...};
+ *     static constexpr uint32_t kWakeupMask = ...;
+ * };
+ * @endcode
+ *
+ * The tables are `constexpr` data in flash. `ESPRIC_CurrentTarget` names the table of the
+ * target the sketch is built for.
+ */
+
+#ifndef ESPRIC_TARGETTABLE_H
+#define ESPRIC_TARGETTABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ESPRIC.h"
+
+/**
+ * @struct ESPRIC_TargetCause
+ * @brief One reset reason or wakeup cause of a target.
+ */
+struct ESPRIC_TargetCause {
+    uint8_t value;           ///< Value of the enumerator.
+    const char* name;        ///< Enumerator name, e.g. `ESP_RST_PANIC`.
+    const char* description; ///< Comment of the enumerator in the ESP-IDF header.
+};
+
+/**
+ * @brief Returns the entry of `value` in a cause table, or `nullptr` if the target cannot report it.
+ *
+ * @code{.cpp}
+ * const ESPRIC_TargetCause* cause = espricFindTargetCause(ESPRIC_CurrentTarget::kResetReasons, esp_reset_reason());
+ * @endcode
+ */
+template <size_t N>
+constexpr const ESPRIC_TargetCause* espricFindTargetCause(const ESPRIC_TargetCause (&causes)[N], unsigned value) {
+    for (size_t i = 0; i < N; i++) {
+        if (causes[i].value == value) {
+            return &causes[i];
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Binds `report` to every reset reason and wakeup cause of `Target`.
+ *
+ * @tparam Target A table of `variants/ESPRIC_TargetTables.h`, e.g. `ESPRIC_CurrentTarget`.
+ * @param analyzer The analyzer to register the handlers with.
+ * @param report Called with the table entry of the reset reason and of the wakeup cause.
+ *
+ * The handlers are registered with `ESPRIC::onResetReason()` and `ESPRIC::onWakeupCause()`, so
+ * `analyze()` reaches them by a table lookup. Each handler stores a pointer to its entry and
+ * `report`; nothing is allocated.
+ */
+template <typename Target>
+void espricBindTargetCauses(ESPRIC& analyzer, void (*report)(const ESPRIC_TargetCause&)) {
+    for (const ESPRIC_TargetCause& reason : Target::kResetReasons) {
+        const ESPRIC_TargetCause* entry = &reason;
+        analyzer.onResetReason(static_cast<esp_reset_reason_t>(reason.value), [entry, report]() { report(*entry); });
+    }
+    for (const ESPRIC_TargetCause& cause : Target::kWakeupCauses) {
+        const ESPRIC_TargetCause* entry = &cause;
+        analyzer.onWakeupCause(static_cast<esp_sleep_wakeup_cause_t>(cause.value),
+                               [entry, report]() { report(*entry); });
+    }
+}
+
+#endif // ESPRIC_TARGETTABLE_H
@@ -0,0 +1,48 @@
+/**
+ * @file ESPRIC_Timing.cpp
+ * @brief Time sources of the ESPRIC timing instrumentation.
+ */
+
+#include "ESPRIC_Timing.h"
+
+#if defined(ESPRIC_HOST)
+
+#include <chrono>
+
+uint32_t espricTimingNow() {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+uint32_t espricTimingElapsedNs(uint32_t start, uint32_t stop) {
+    return stop - start; // Ticks are nanoseconds; unsigned subtraction handles the wraparound
+}
+
+#elif defined(ESPRIC_TIMING_CYCLE_COUNTER)
+
+#include <esp_cpu.h>
+#include <esp_rom_sys.h>
+
+uint32_t espricTimingNow() {
+    return static_cast<uint32_t>(esp_cpu_get_cycle_count());
+}
+
+uint32_t espricTimingElapsedNs(uint32_t start, uint32_t stop) {
+    const uint64_t ns = static_cast<uint64_t>(stop - start) * 1000u / esp_rom_get_cpu_ticks_per_us();
+    return ns > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(ns);
+}
+
+#else
+
+#include <esp_timer.h>
+
+uint32_t espricTimingNow() {
+    return static_cast<uint32_t>(esp_timer_get_time());
+}
+
+uint32_t espricTimingElapsedNs(uint32_t start, uint32_t stop) {
+    const uint64_t ns = static_cast<uint64_t>(stop - start) * 1000u;
+    return ns > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(ns);
+}
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * @file ESPRIC_Timing.h
+ * @brief Fixed-size timing report for instrumented ESPRIC analyses.
+ *
+ * `ESPRIC::analyze(ESPRIC_TimingReport&)` takes a timestamp before and after every predicate
+ * and every callback and adds the durations to an `ESPRIC_TimingReport`. The report keeps
+ * count, minimum, maximum and total per condition, so a slow boot can be traced to the
+ * predicate or callback that causes it without reading log timestamps by hand.
+ *
+ * Time source:
+ * - ESP32: `esp_timer_get_time()` (1 us resolution). Define `ESPRIC_TIMING_CYCLE_COUNTER` to
+ *   use the CPU cycle counter instead (ns resolution, valid while the analysis stays on one core).
+ * - Host (`ESPRIC_HOST`): `std::chrono::steady_clock`.
+ */
+
+#ifndef ESPRIC_TIMING_H
+#define ESPRIC_TIMING_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of conditions that get their own entry in an `ESPRIC_TimingReport`.
+ *
+ * Conditions beyond this limit are still included in the aggregate statistics.
+ */
+#ifndef ESPRIC_TIMING_MAX_ENTRIES
+#define ESPRIC_TIMING_MAX_ENTRIES 32
+#endif
+
+/**
+ * @brief Returns the current timestamp in ticks of the configured time source.
+ *
+ * The value wraps around; only differences of two timestamps are meaningful.
+ */
+uint32_t espricTimingNow();
+
+/**
+ * @brief Converts the ticks between two timestamps into nanoseconds.
+ *
+ * @param start Timestamp taken before the measured call.
+ * @param stop Timestamp taken after the measured call.
+ * @return The elapsed time in nanoseconds, saturated at `UINT32_MAX`.
+ */
+uint32_t espricTimingElapsedNs(uint32_t start, uint32_t stop);
+
+/**
+ * @struct ESPRIC_TimingStats
+ * @brief Count, minimum, maximum and total of a series of durations.
+ */
+struct ESPRIC_TimingStats {
+    uint32_t count = 0;           ///< Number of recorded durations.
+    uint32_t minNs = UINT32_MAX;  ///< Shortest duration in nanoseconds (`UINT32_MAX` while empty).
+    uint32_t maxNs = 0;           ///< Longest duration in nanoseconds.
+    uint64_t totalNs = 0;         ///< Sum of all durations in nanoseconds.
+
+    /**
+     * @brief Adds one duration.
+     */
+    void add(uint32_t ns) {
+        ++count;
+        if (ns < minNs) minNs = ns;
+        if (ns > maxNs) maxNs = ns;
+        totalNs += ns;
+    }
+
+    /**
+     * @brief Returns the mean duration in nanoseconds, 0 while empty.
+     */
+    uint32_t averageNs() const { return count ? static_cast<uint32_t>(totalNs / count) : 0; }
+};
+
+/**
+ * @struct ESPRIC_TimingEntry
+ * @brief Predicate and callback durations of one condition.
+ */
+struct ESPRIC_TimingEntry {
+    ESPRIC_TimingStats predicate; ///< Durations of the condition predicate.
+    ESPRIC_TimingStats callback;  ///< Durations of the callback (only recorded on a match).
+};
+
+/**
+ * @struct ESPRIC_TimingReport
+ * @brief Fixed-size timing report filled by `ESPRIC::analyze(ESPRIC_TimingReport&)`.
+ *
+ * Entries are indexed in evaluation order: predicate conditions first, followed by the mask
+ * conditions. Dispatch handlers and the default callback only appear in `callbacks`.
+ * Durations accumulate over several analyses until `reset()` is called.
+ *
+ * The report does not allocate. With the default capacity it occupies about 1.5 KB, so
+ * keep it in static storage rather than on a small task stack.
+ */
+struct ESPRIC_TimingReport {
+    ESPRIC_TimingEntry entries[ESPRIC_TIMING_MAX_ENTRIES]; ///< Per-condition statistics.
+    size_t entryCount = 0;        ///< Number of valid entries.
+    size_t overflow = 0;          ///< Conditions of the last analysis that had no entry left.
+    ESPRIC_TimingStats predicates; ///< All predicate durations.
+    ESPRIC_TimingStats callbacks;  ///< All callback durations, including dispatch and default handlers.
+    ESPRIC_TimingStats analyses;   ///< Durations of complete `analyze()` calls.
+
+    /**
+     * @brief Clears all statistics.
+     */
+    void reset() {
+        for (ESPRIC_TimingEntry& entry : entries) {
+            entry = ESPRIC_TimingEntry();
+        }
+        entryCount = 0;
+        overflow = 0;
+        predicates = ESPRIC_TimingStats();
+        callbacks = ESPRIC_TimingStats();
+        analyses = ESPRIC_TimingStats();
+    }
+};
+
+#endif // ESPRIC_TIMING_H
@@ -0,0 +1,12 @@
+/**
+ * @file AllocationCounter.cpp
+ * @brief Feeds `allocationSnapshot()` from the counting allocator of `src/ESPRIC_HeapUsage.cpp`.
+ */
+
+#include "AllocationCounter.h"
+#include <ESPRIC_HeapUsage.h>
+
+AllocationSnapshot allocationSnapshot() {
+    const ESPRIC_HeapCounters counters = espricHeapCounters();
+    return {counters.allocations, counters.allocatedBytes};
+}
@@ -0,0 +1,28 @@
+/**
+ * @file AllocationCounter.h
+ * @brief Counts heap allocations of a host benchmark.
+ *
+ * Link `AllocationCounter.cpp` and `src/ESPRIC_HeapUsage.cpp`, whose host backend replaces the
+ * global `operator new`, into the benchmark and take snapshots around the code under test.
+ */
+
+#ifndef ESPRIC_HOST_ALLOCATIONCOUNTER_H
+#define ESPRIC_HOST_ALLOCATIONCOUNTER_H
+
+#include <stddef.h>
+
+/**
+ * @struct AllocationSnapshot
+ * @brief Cumulative allocation counters at a point in time.
+ */
+struct AllocationSnapshot {
+    size_t allocations; ///< Number of `operator new` calls.
+    size_t bytes;       ///< Bytes requested through `operator new`.
+};
+
+/**
+ * @brief Returns the current cumulative allocation counters.
+ */
+AllocationSnapshot allocationSnapshot();
+
+#endif // ESPRIC_HOST_ALLOCATIONCOUNTER_H
@@ -0,0 +1,125 @@
+/**
+ * @file BootHistoryBenchmark.cpp
+ * @brief Flash writes and time per boot of an NVS boot log versus `ESPRIC_BootHistory`.
+ *
+ * The NVS variant writes the last boots as one blob on every boot. The history variant appends to
+ * the simulated RTC memory and flushes lazily: on power-on resets and every `kFlushEvery` boots.
+ * Afterwards the simulated RTC memory is put through the paths a device hits in the field:
+ * wraparound of the ring buffer, a flipped bit and random content after a power loss.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <Preferences.h>
+#include <ESPRIC.h>
+#include <ESPRIC_BootHistory.h>
+
+static constexpr int kBoots = 10000;         ///< Simulated boots per variant.
+static constexpr uint32_t kFlushEvery = 8;   ///< Lazy flush interval of the history variant.
+
+/**
+ * @brief Reset reason of simulated boot `boot`: mostly deep sleep, a power-on every 500 boots.
+ */
+static esp_reset_reason_t reasonOf(int boot) {
+    if (boot % 500 == 0) {
+        return ESP_RST_POWERON;
+    }
+    return boot % 50 == 7 ? ESP_RST_PANIC : ESP_RST_DEEPSLEEP;
+}
+
+/**
+ * @brief Runs `kBoots` simulated boots and prints the NVS writes and time per boot.
+ */
+template <typename Boot>
+static void measure(const char* name, Boot boot) {
+    espricHostNvsErase();
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kBoots; ++i) {
+        ESPRIC::StartupContext context;
+        context.resetReason = reasonOf(i);
+        context.wakeupCause = context.resetReason == ESP_RST_DEEPSLEEP ? ESP_SLEEP_WAKEUP_TIMER
+                                                                         : ESP_SLEEP_WAKEUP_UNDEFINED;
+        boot(context);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    std::printf("%-20s %5.3f NVS writes/boot  %8.1f ns/boot (simulated NVS)\n", name,
+                static_cast<double>(espricHostNvsWrites()) / kBoots,
+                std::chrono::duration<double, std::nano>(stop - start).count() / kBoots);
+}
+
+/**
+ * @brief Prints whether `condition` holds.
+ */
+static void check(const char* name, bool condition) {
+    std::printf("  %-44s %s\n", name, condition ? "ok" : "FAILED");
+}
+
+int main() {
+    static ESPRIC_BootRecord log[ESPRIC_BOOT_HISTORY_LENGTH];
+    static size_t logged = 0;
+
+    measure("NVS blob per boot", [](const ESPRIC::StartupContext& context) {
+        if (logged == ESPRIC_BOOT_HISTORY_LENGTH) {
+            std::memmove(log, log + 1, sizeof(log) - sizeof(log[0]));
+            logged--;
+        }
+        log[logged++] = {static_cast<uint8_t>(context.resetReason), static_cast<uint8_t>(context.wakeupCause),
+                         0, 0, 0};
+        Preferences preferences;
+        preferences.begin("boot_log", false);
+        preferences.putBytes("log", log, sizeof(log));
+        preferences.end();
+    });
+
+    ESPRIC_BootHistoryStore rtc;
+    std::memset(&rtc, 0xA5, sizeof(rtc)); // Power-on content of RTC memory
+
+    measure("ESPRIC_BootHistory", [&rtc](const ESPRIC::StartupContext& context) {
+        ESPRIC_BootHistory history(rtc);
+        history.begin();
+        history.setFlushHandler([](const ESPRIC_BootHistory& flushed) {
+            ESPRIC_BootRecord records[ESPRIC_BOOT_HISTORY_LENGTH] = {};
+            for (size_t i = 0; i < flushed.size(); ++i) {
+                records[i] = flushed.at(i);
+            }
+            Preferences preferences;
+            preferences.begin("boot_log", false);
+            const bool written = preferences.putBytes("log", records, sizeof(records)) == sizeof(records);
+            preferences.end();
+            return written;
+        }, kFlushEvery);
+
+        ESPRIC analyzer({
+            {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_PANIC; }, []() {}}
+        });
+        analyzer.setBootHistory(&history);
+        analyzer.analyze(context);
+    });
+
+    std::printf("RTC store paths:\n");
+    ESPRIC_BootHistory history(rtc);
+    check("history survives a reset", history.begin() == ESPRIC_BootHistory::State::Valid);
+    check("ring buffer wrapped and is full", history.size() == ESPRIC_BOOT_HISTORY_LENGTH);
+    check("oldest to newest in boot order",
+          history.newest().bootSequence == static_cast<uint32_t>(kBoots) &&
+          history.at(0).bootSequence == static_cast<uint32_t>(kBoots) - ESPRIC_BOOT_HISTORY_LENGTH + 1);
+
+    reinterpret_cast<uint8_t*>(&rtc.records[3])[5] ^= 0x10;
+    check("flipped bit is detected", history.begin() == ESPRIC_BootHistory::State::Corrupted);
+    check("corrupted history restarts empty", history.size() == 0);
+
+    std::mt19937 random(1);
+    uint8_t* bytes = reinterpret_cast<uint8_t*>(&rtc);
+    for (size_t i = 0; i < sizeof(rtc); ++i) {
+        bytes[i] = static_cast<uint8_t>(random());
+    }
+    check("random content after power loss is rejected", history.begin() != ESPRIC_BootHistory::State::Valid);
+
+    ESPRIC::StartupContext context;
+    context.resetReason = ESP_RST_POWERON;
+    history.append(context);
+    check("first boot after power loss is recorded", history.size() == 1 && history.newest().bootSequence == 1);
+    return 0;
+}
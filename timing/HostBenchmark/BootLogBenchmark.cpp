@@ -0,0 +1,167 @@
+/**
+ * @file BootLogBenchmark.cpp
+ * @brief Flash traffic of the binary boot-event log versus a text log, plus torn-write recovery.
+ *
+ * The text variant appends one `Serial.println`-style line per boot (as the variant templates
+ * print it) to a file. The binary variant writes one 16-byte `ESPRIC_BootLog` record per boot to a
+ * simulated 16 KiB NOR flash (`ESPRIC_BootLogMemory`, 4 KiB sectors), once with one flush per
+ * boot and once batched across boots. Every simulated boot constructs a new log and runs the
+ * storage scan of `begin()`; only the pending batch in (simulated) RTC memory carries over, as
+ * on the device. The log then survives a torn write, an interrupted flush and the loss of the
+ * RTC batch, and is read back with the portable decoder of `ESPRIC_BootLogFormat.h`, as a host
+ * tool reads a flash dump.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <ESPRIC_BootLog.h>
+
+static constexpr int kBoots = 10000;              ///< Simulated boots per variant.
+static constexpr size_t kFlashSize = 16 * 1024;  ///< Simulated partition size.
+
+/**
+ * @brief Reset reason of simulated boot `boot`.
+ */
+static esp_reset_reason_t reasonOf(int boot) {
+    return boot % 20 == 0 ? ESP_RST_POWERON : boot % 20 == 7 ? ESP_RST_PANIC : ESP_RST_DEEPSLEEP;
+}
+
+/**
+ * @brief Prints whether `condition` holds.
+ */
+static void check(const char* name, bool condition) {
+    std::printf("  %-44s %s\n", name, condition ? "ok" : "FAILED");
+}
+
+/**
+ * @brief Logs `kBoots` boots with a new `ESPRIC_BootLog` (scan included) per boot.
+ *
+ * @param flushEveryBoot `true` writes every record at once, `false` leaves it in the RTC batch.
+ */
+static void measureBinary(const char* name, bool flushEveryBoot, std::vector<uint8_t>& flash) {
+    flash.assign(kFlashSize, 0xFF);
+    ESPRIC_BootLogMemory storage(flash.data(), flash.size());
+    ESPRIC_BootLogPending rtc;
+    std::memset(&rtc, 0xA5, sizeof(rtc)); // Power-on content of RTC memory
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kBoots; ++i) {
+        ESPRIC_BootLog log(storage, 0x0102, rtc);
+        log.begin();
+        ESPRIC_StartupContext context;
+        context.resetReason = reasonOf(i);
+        log.append(context);
+        if (flushEveryBoot) {
+            log.flush();
+        }
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    std::printf("%-24s %6.1f bytes/boot  %5.2f reads/boot  %5.3f writes/boot  %6.4f erases/boot  %8.1f ns/boot\n",
+                name, static_cast<double>(ESPRIC_BOOT_EVENT_SIZE), static_cast<double>(storage.reads()) / kBoots,
+                static_cast<double>(storage.writes()) / kBoots, static_cast<double>(storage.erases()) / kBoots,
+                std::chrono::duration<double, std::nano>(stop - start).count() / kBoots);
+}
+
+int main() {
+    std::string text;
+    for (int i = 0; i < kBoots; ++i) {
+        text += reasonOf(i) == ESP_RST_PANIC ? "Panic detected! Reset reason: ESP_RST_PANIC\n"
+                                             : "Deep sleep wakeup. Reset reason: ESP_RST_DEEPSLEEP\n";
+    }
+    std::printf("%-24s %6.1f bytes/boot  (one line per boot, no CRC, needs parsing)\n", "text log",
+                static_cast<double>(text.size()) / kBoots);
+
+    std::vector<uint8_t> flash;
+    measureBinary("ESPRIC_BootLog per boot", true, flash);
+    char batchName[32];
+    std::snprintf(batchName, sizeof(batchName), "ESPRIC_BootLog batch %d", ESPRIC_BOOT_LOG_BATCH);
+    measureBinary(batchName, false, flash);
+
+    std::printf("Recovery paths:\n");
+    ESPRIC_BootLogMemory storage(flash.data(), flash.size());
+    ESPRIC_BootLog log(storage);
+    check("log continues after the newest record", log.begin() && log.nextBootId() == kBoots + 1);
+    // One read per sector, plus the check of the write position.
+    check("scan reads whole sectors", storage.reads() == kFlashSize / storage.sectorSize() + 1);
+    check("full log keeps the newest sectors", log.recordsFound() >= kFlashSize / ESPRIC_BOOT_EVENT_SIZE - 256);
+
+    // Power loss in the middle of a record: half of its bytes reached the flash.
+    uint8_t record[ESPRIC_BOOT_EVENT_SIZE];
+    ESPRIC_BootEvent torn;
+    torn.bootId = kBoots + 1;
+    espricEncodeBootEvent(torn, record);
+    std::vector<uint8_t> before = flash;
+    ESPRIC_BootLog probe(storage);
+    probe.begin();
+    probe.append(torn);
+    probe.flush();
+    size_t tornOffset = 0;
+    for (size_t i = 0; i < flash.size(); i += ESPRIC_BOOT_EVENT_SIZE) {
+        if (std::memcmp(&flash[i], &before[i], ESPRIC_BOOT_EVENT_SIZE) != 0) {
+            tornOffset = i;
+        }
+    }
+    std::memset(&flash[tornOffset + ESPRIC_BOOT_EVENT_SIZE / 2], 0xFF, ESPRIC_BOOT_EVENT_SIZE / 2);
+
+    check("torn record is detected", log.begin() && log.tornFound() == 1);
+    check("torn record is not counted", log.nextBootId() == kBoots + 1);
+    ESPRIC_BootEvent event;
+    event.resetReason = ESP_RST_BROWNOUT;
+    log.append(event);
+    log.flush();
+    check("next record goes behind the torn slot", log.begin() && log.nextBootId() == kBoots + 2);
+
+    uint32_t previous = 0;
+    bool ordered = true;
+    size_t brownouts = 0;
+    log.replay([&](const ESPRIC_BootEvent& replayed) {
+        ordered = ordered && replayed.bootId > previous;
+        previous = replayed.bootId;
+        brownouts += replayed.resetReason == ESP_RST_BROWNOUT;
+    });
+    check("replay is oldest first", ordered && previous == kBoots + 1 && brownouts == 1);
+
+    // A host tool decodes the same bytes in place.
+    size_t valid = 0;
+    size_t tornSlots = 0;
+    for (size_t i = 0; i < flash.size(); i += ESPRIC_BOOT_EVENT_SIZE) {
+        switch (espricDecodeBootEvent(&flash[i], event)) {
+            case ESPRIC_BootEventStatus::Valid: valid++; break;
+            case ESPRIC_BootEventStatus::Torn: tornSlots++; break;
+            case ESPRIC_BootEventStatus::Erased: break;
+        }
+    }
+    check("host decoder agrees with the device log", valid == log.recordsFound() && tornSlots == 1);
+
+    // The batch in RTC memory across resets, an interrupted flush and a power loss.
+    std::vector<uint8_t> fresh(kFlashSize, 0xFF);
+    ESPRIC_BootLogMemory freshStorage(fresh.data(), fresh.size());
+    ESPRIC_BootLogPending rtc;
+    std::memset(&rtc, 0xA5, sizeof(rtc));
+    for (int boot = 0; boot < 3; ++boot) {
+        ESPRIC_BootLog booted(freshStorage, 0, rtc);
+        booted.begin();
+        booted.append(event);
+    }
+    ESPRIC_BootLog resumed(freshStorage, 0, rtc);
+    check("batch survives resets without flash writes",
+          resumed.begin() && resumed.pending() == 3 && resumed.nextBootId() == 4 && freshStorage.writes() == 0);
+
+    const ESPRIC_BootLogPending beforeFlush = rtc;
+    resumed.flush();
+    rtc = beforeFlush; // Reset after the write, before the batch was cleared
+    ESPRIC_BootLog afterFlush(freshStorage, 0, rtc);
+    check("interrupted flush is not logged twice",
+          afterFlush.begin() && afterFlush.pending() == 0 && afterFlush.nextBootId() == 4 &&
+                  afterFlush.replay(nullptr) == 3);
+
+    afterFlush.append(event);
+    afterFlush.append(event);
+    rtc.records[3] ^= 0x01; // Power loss: RTC memory content is random
+    ESPRIC_BootLog afterPowerLoss(freshStorage, 0, rtc);
+    check("power loss drops only the unwritten batch",
+          afterPowerLoss.begin() && afterPowerLoss.pending() == 0 && afterPowerLoss.nextBootId() == 4);
+    return 0;
+}
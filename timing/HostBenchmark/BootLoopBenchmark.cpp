@@ -0,0 +1,121 @@
+/**
+ * @file BootLoopBenchmark.cpp
+ * @brief Cost per boot and escalation of `ESPRIC_BootLoopDetector` on simulated RTC memory.
+ *
+ * Replays a crash loop (a panic or task watchdog reset every 20 seconds) and prints the state after every boot, then
+ * checks expiry of old crashes, the reset on power-on, the attached analyzer and the recovery
+ * from corrupted or random RTC memory. The timing loop measures one update per boot, the work a
+ * device does before any other initialization.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <random>
+#include <ESPRIC.h>
+#include <ESPRIC_BootLoop.h>
+
+static constexpr int kBoots = 1000000; ///< Simulated boots of the timing loop.
+
+/**
+ * @brief Returns the name of a state.
+ */
+static const char* nameOf(ESPRIC_BootLoopState state) {
+    switch (state) {
+        case ESPRIC_BootLoopState::Normal: return "Normal";
+        case ESPRIC_BootLoopState::Degraded: return "Degraded";
+        case ESPRIC_BootLoopState::SafeMode: return "SafeMode";
+        case ESPRIC_BootLoopState::Halt: return "Halt";
+    }
+    return "?";
+}
+
+/**
+ * @brief Simulates one boot: a new detector object on the same store, as after a reset.
+ */
+static ESPRIC_BootLoopState boot(ESPRIC_BootLoopStore& store, esp_reset_reason_t reason, uint32_t now) {
+    ESPRIC_BootLoopDetector detector(ESPRIC_BootLoopDetector::Config(), store);
+    return detector.update(reason, now);
+}
+
+/**
+ * @brief Prints whether `condition` holds.
+ */
+static void check(const char* name, bool condition) {
+    std::printf("  %-44s %s\n", name, condition ? "ok" : "FAILED");
+}
+
+int main() {
+    static ESPRIC_BootLoopStore store;
+    std::printf("Store: %zu bytes of RTC memory, window of %d crashes\n", sizeof(store), ESPRIC_BOOT_LOOP_WINDOW);
+
+    std::printf("\nCrash loop, default thresholds (2/3/5 crashes in 600 s):\n");
+    boot(store, ESP_RST_POWERON, 0);
+    for (uint32_t i = 1; i <= 6; i++) {
+        const ESPRIC_BootLoopState state = boot(store, i % 2 ? ESP_RST_PANIC : ESP_RST_TASK_WDT, i * 20);
+        std::printf("  t=%3u s  %-9s -> %s\n", i * 20, i % 2 ? "PANIC" : "TASK_WDT", nameOf(state));
+    }
+
+    std::printf("\nChecks:\n");
+    check("deep-sleep wakeups do not count", boot(store, ESP_RST_DEEPSLEEP, 130) == ESPRIC_BootLoopState::Halt);
+    check("old crashes expire", boot(store, ESP_RST_DEEPSLEEP, 20 + 600 + 40) == ESPRIC_BootLoopState::SafeMode);
+    check("everything expires", boot(store, ESP_RST_SW, 5000) == ESPRIC_BootLoopState::Normal);
+    boot(store, ESP_RST_PANIC, 5001);
+    boot(store, ESP_RST_PANIC, 5002);
+    check("power-on clears the window", boot(store, ESP_RST_POWERON, 5003) == ESPRIC_BootLoopState::Normal);
+
+    boot(store, ESP_RST_PANIC, 6000);
+    ESPRIC_BootLoopDetector stable(ESPRIC_BootLoopDetector::Config(), store);
+    stable.update(ESP_RST_PANIC, 6001);
+    check("second update in one boot is ignored",
+          stable.update(ESP_RST_PANIC, 6002) == ESPRIC_BootLoopState::Degraded && stable.crashes() == 2);
+    stable.markStable();
+    check("markStable() clears the window", boot(store, ESP_RST_SW, 6003) == ESPRIC_BootLoopState::Normal);
+
+    const uint32_t now = static_cast<uint32_t>(time(nullptr)); // analyze() uses the real clock
+    boot(store, ESP_RST_PANIC, now - 2);
+    boot(store, ESP_RST_PANIC, now - 1);
+    ESPRIC_BootLoopDetector attached(ESPRIC_BootLoopDetector::Config(), store);
+    ESPRIC analyzer({});
+    analyzer.setBootLoopDetector(&attached);
+    bool safeMode = false;
+    analyzer.addCondition([](const ESPRIC::StartupContext& context) {
+        return context.bootLoopState >= ESPRIC_BootLoopState::SafeMode && context.recentCrashes == 3;
+    }, [&safeMode]() { safeMode = true; });
+    ESPRIC::StartupContext context;
+    context.resetReason = ESP_RST_INT_WDT;
+    analyzer.analyze(context);
+    check("conditions see the state", safeMode && context.bootLoopState == ESPRIC_BootLoopState::Normal);
+
+    ESPRIC_BootLoopDetector flipped(ESPRIC_BootLoopDetector::Config(), store);
+    reinterpret_cast<uint8_t*>(&store)[20] ^= 0x04;
+    flipped.update(ESP_RST_PANIC, now + 1);
+    check("bit flip detected and reinitialized",
+          flipped.storeState() == ESPRIC_BootLoopDetector::StoreState::Corrupted && flipped.crashes() == 1);
+
+    std::mt19937 random(42);
+    int recovered = 0;
+    for (int i = 0; i < 1000; i++) {
+        uint8_t* bytes = reinterpret_cast<uint8_t*>(&store);
+        for (size_t b = 0; b < sizeof(store); b++) {
+            bytes[b] = static_cast<uint8_t>(random());
+        }
+        ESPRIC_BootLoopDetector detector(ESPRIC_BootLoopDetector::Config(), store);
+        detector.update(ESP_RST_BROWNOUT, 1);
+        recovered += detector.storeState() != ESPRIC_BootLoopDetector::StoreState::Valid && detector.crashes() == 0;
+    }
+    check("random content after power loss (1000 runs)", recovered == 1000);
+
+    boot(store, ESP_RST_POWERON, 0);
+    const auto start = std::chrono::steady_clock::now();
+    uint32_t halts = 0;
+    for (int i = 0; i < kBoots; i++) {
+        halts += boot(store, i % 3 == 0 ? ESP_RST_PANIC : ESP_RST_DEEPSLEEP, static_cast<uint32_t>(i) * 30)
+                 == ESPRIC_BootLoopState::Halt;
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    std::printf("\nUpdate: %.1f ns/boot (%u halts)\n",
+                std::chrono::duration<double, std::nano>(stop - start).count() / kBoots, halts);
+    return 0;
+}
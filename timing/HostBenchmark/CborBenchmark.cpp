@@ -0,0 +1,198 @@
+/**
+ * @file CborBenchmark.cpp
+ * @brief Text and JSON boot reports versus `espricEncodeBootReport()` into a fixed buffer.
+ *
+ * All three variants serialize one analysis: boot context, analysis result and the boot
+ * counter of `ESPRIC_ResetStatistics`. The text variant formats these lines with
+ * `ESPRIC_BufferSink`. The JSON variant also carries the matched condition indices, the mean
+ * analysis time and the reset count, built with string concatenation as sketches commonly do
+ * with `String` before an MQTT publish. The CBOR variant encodes all keys, predicate and
+ * callback times included, into a stack buffer. The output is CPU time, heap allocations (AllocationCounter.cpp) and payload
+ * bytes per report.
+ *
+ * Afterwards the exact encoding of a minimal report, the round trip through the decoder of
+ * `tools/CborReportDecoder`, the overflow handling, skipping of unknown keys and the rejection
+ * of truncated input are checked.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <ESPRIC.h>
+#include <ESPRIC_CauseNames.h>
+#include <ESPRIC_Cbor.h>
+#include <ESPRIC_Report.h>
+#include "AllocationCounter.h"
+
+static constexpr int kReports = 200000; ///< Reports per variant.
+
+static volatile size_t sink = 0; ///< Side effect of every report, keeps the work alive.
+
+/**
+ * @brief Runs `kReports` reports and prints CPU time, allocations and payload bytes per report.
+ */
+template <typename Encode>
+static void measure(const char* name, Encode encode) {
+    size_t bytes = 0;
+    const AllocationSnapshot before = allocationSnapshot();
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kReports; i++) {
+        bytes += encode();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    const AllocationSnapshot after = allocationSnapshot();
+    sink = sink + bytes;
+    std::printf("%-6s %7.1f ns/report  %5.2f allocs/report  %6.1f bytes/report\n", name,
+                std::chrono::duration<double, std::nano>(stop - start).count() / kReports,
+                static_cast<double>(after.allocations - before.allocations) / kReports,
+                static_cast<double>(bytes) / kReports);
+}
+
+int main() {
+    ESPRIC::StartupContext context;
+    context.resetReason = ESP_RST_PANIC;
+    context.wakeupCause = ESP_SLEEP_WAKEUP_UNDEFINED;
+    context.uptimeUs = 48213;
+
+    ESPRIC analyzer({
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_BROWNOUT; }, []() {}},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.uptimeUs > 0; }, []() {}},
+    });
+    analyzer.addMaskCondition(ESPRIC_RESET_MASK_ANY_CRASH, 0, []() {});
+    analyzer.onResetReason(ESP_RST_PANIC, []() {});
+
+    ESPRIC_ResetStatistics statistics;
+    statistics.begin();
+    for (int boot = 0; boot < 7; boot++) {
+        statistics.record(context);
+    }
+
+    static ESPRIC_TimingReport timing;
+    const ESPRIC::AnalysisResult result = analyzer.analyze(context, timing);
+
+    measure("text", [&]() {
+        char text[256];
+        ESPRIC_BufferSink buffer(text, sizeof(text));
+        ESPRIC_ReportEvent events[3];
+        events[0].type = ESPRIC_ReportEventType::Boot;
+        events[0].count = 3;
+        events[0].values[0] = context.resetReason;
+        events[0].values[1] = context.wakeupCause;
+        events[0].values[2] = static_cast<uint32_t>(context.uptimeUs);
+        events[1].type = ESPRIC_ReportEventType::Analysis;
+        events[1].count = 5;
+        events[1].values[0] = static_cast<uint32_t>(result.matched);
+        events[1].values[1] = static_cast<uint32_t>(result.unmatched);
+        events[1].values[2] = static_cast<uint32_t>(result.skipped);
+        events[1].values[3] = static_cast<uint32_t>(result.deferred);
+        events[1].values[4] = static_cast<uint32_t>(result.gated);
+        events[2].text = "boots";
+        events[2].count = 1;
+        events[2].values[0] = statistics.boots();
+        buffer.deliver(events, 3);
+        return buffer.size();
+    });
+
+    measure("json", [&]() {
+        std::string json = "{\"reset\":\"";
+        json += espricResetReasonName(context.resetReason);
+        json += "\",\"wakeup\":\"";
+        json += espricWakeupCauseName(context.wakeupCause);
+        json += "\",\"uptime_us\":" + std::to_string(context.uptimeUs);
+        json += ",\"matched\":" + std::to_string(result.matched);
+        json += ",\"unmatched\":" + std::to_string(result.unmatched);
+        json += ",\"skipped\":" + std::to_string(result.skipped);
+        json += ",\"matched_ids\":[";
+        for (size_t i = 0; i < timing.entryCount; i++) {
+            if (timing.entries[i].callback.count != 0) {
+                json += std::to_string(i) + ",";
+            }
+        }
+        json.back() = ']';
+        json += ",\"analysis_ns\":" + std::to_string(timing.analyses.averageNs());
+        json += ",\"boots\":" + std::to_string(statistics.boots());
+        json += ",\"resets\":" + std::to_string(statistics.resetCount(context.resetReason)) + "}";
+        return json.size();
+    });
+
+    measure("cbor", [&]() {
+        uint8_t payload[ESPRIC_CBOR_REPORT_SIZE];
+        return espricEncodeBootReport(payload, sizeof(payload), context, result, &timing, &statistics);
+    });
+
+    std::printf("\nChecks:\n");
+
+    // Minimal report: map(5) {0: 1, 1: 4, 2: 0, 3: 48213, 4: [3, 0, 0, 0, 0, 0]}.
+    const uint8_t expected[] = {0xA5, 0x00, 0x01, 0x01, 0x04, 0x02, 0x00, 0x03, 0x19, 0xBC, 0x55,
+                                0x04, 0x86, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00};
+    const ESPRIC::AnalysisResult minimal = {3, 0};
+    uint8_t bytes[ESPRIC_CBOR_REPORT_SIZE];
+    size_t size = espricEncodeBootReport(bytes, sizeof(bytes), context, minimal);
+    std::printf("  %-44s %s\n", "minimal report encoded in shortest form",
+                size == sizeof(expected) && std::memcmp(bytes, expected, size) == 0 ? "ok" : "FAILED");
+
+    // Round trip of a full report.
+    ESPRIC::StartupContext looping = context;
+    looping.bootLoopState = ESPRIC_BootLoopState::Degraded;
+    looping.recentCrashes = 3;
+    const AllocationSnapshot before = allocationSnapshot();
+    size = espricEncodeBootReport(bytes, sizeof(bytes), looping, result, &timing, &statistics);
+    const AllocationSnapshot after = allocationSnapshot();
+    ESPRIC_CborBootReport decoded;
+    size_t consumed = 0;
+    const bool ok = espricCborDecodeBootReport(bytes, size, decoded, consumed);
+    std::printf("  %-44s %s\n", "full report fits in 64 bytes without heap",
+                size != 0 && size <= 64 && after.allocations == before.allocations ? "ok" : "FAILED");
+    std::printf("  %-44s %s\n", "decoded fields equal the analysis",
+                ok && consumed == size && decoded.version == ESPRIC_CBOR_VERSION &&
+                        decoded.resetReason == ESP_RST_PANIC && decoded.wakeupCause == ESP_SLEEP_WAKEUP_UNDEFINED &&
+                        decoded.uptimeUs == 48213 && decoded.matched == result.matched &&
+                        decoded.unmatched == result.unmatched && decoded.matchedIdCount == 2 &&
+                        decoded.matchedIds[0] == 1 && decoded.matchedIds[1] == 2 &&
+                        decoded.hasTiming && decoded.analysisNs == timing.analyses.averageNs() &&
+                        decoded.boots == 7 && decoded.resetCount == 7 && decoded.hasBootLoop &&
+                        decoded.bootLoopState == 1 && decoded.recentCrashes == 3 ? "ok" : "FAILED");
+
+    // Overflow: every capacity below the size fails without writing past it.
+    bool bounded = true;
+    for (size_t capacity = 0; capacity < size; capacity++) {
+        uint8_t guarded[ESPRIC_CBOR_REPORT_SIZE + 1];
+        std::memset(guarded, 0x5A, sizeof(guarded));
+        bounded = bounded && espricEncodeBootReport(guarded, capacity, looping, result, &timing, &statistics) == 0 &&
+                  guarded[capacity] == 0x5A;
+    }
+    std::printf("  %-44s %s\n", "small buffers rejected, never overrun", bounded ? "ok" : "FAILED");
+
+    // Forward compatibility: a key of a newer schema is skipped; a sequence decodes in order.
+    uint8_t newer[2 * sizeof(expected) + 8];
+    std::memcpy(newer, expected, sizeof(expected));
+    newer[0] = 0xA6;                                   // Six pairs
+    const uint8_t extra[] = {0x09, 0x82, 0x61, 'x', 0x20}; // 9: ["x", -1]
+    std::memcpy(newer + sizeof(expected), extra, sizeof(extra));
+    std::memcpy(newer + sizeof(expected) + sizeof(extra), expected, sizeof(expected));
+    const size_t sequence = 2 * sizeof(expected) + sizeof(extra);
+    ESPRIC_CborBootReport first;
+    ESPRIC_CborBootReport second;
+    size_t firstSize = 0;
+    size_t secondSize = 0;
+    const bool skipped = espricCborDecodeBootReport(newer, sequence, first, firstSize) &&
+                         espricCborDecodeBootReport(newer + firstSize, sequence - firstSize, second, secondSize);
+    std::printf("  %-44s %s\n", "unknown key skipped, sequence decoded",
+                skipped && firstSize == sizeof(expected) + sizeof(extra) && secondSize == sizeof(expected) &&
+                        first.matched == 3 && second.uptimeUs == 48213 ? "ok" : "FAILED");
+
+    // Truncated input never decodes.
+    bool rejected = true;
+    for (size_t length = 0; length < size; length++) {
+        rejected = rejected && !espricCborDecodeBootReport(bytes, length, decoded, consumed);
+    }
+    std::printf("  %-44s %s\n", "every truncation rejected", rejected ? "ok" : "FAILED");
+
+    std::printf("\nFull report (%zu bytes):\n ", size);
+    for (size_t i = 0; i < size; i++) {
+        std::printf(" %02x", bytes[i]);
+    }
+    std::printf("\n");
+    return 0;
+}
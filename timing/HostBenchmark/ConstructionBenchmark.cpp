@@ -0,0 +1,139 @@
+/**
+ * @file ConstructionBenchmark.cpp
+ * @brief Counts condition copies and heap allocations of the ESPRIC construction modes.
+ *
+ * Each simulated boot builds an analyzer with 16 conditions and runs `analyze()` once. The
+ * predicates and callbacks are functors that count their copy constructions, so the report
+ * shows how often every condition is copied in each mode. Heap allocations are counted with
+ * AllocationCounter.cpp.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <ESPRIC.h>
+#include "AllocationCounter.h"
+
+static size_t copies = 0;             ///< Copy constructions of counting functors.
+static volatile unsigned handled = 0; ///< Side effect of every callback, keeps calls alive.
+
+/**
+ * @brief Predicate that matches one reset reason and counts its copies.
+ */
+struct CountingPredicate {
+    esp_reset_reason_t reason;
+
+    explicit CountingPredicate(esp_reset_reason_t reason) : reason(reason) {}
+    CountingPredicate(const CountingPredicate& other) : reason(other.reason) { copies++; }
+    CountingPredicate(CountingPredicate&&) = default;
+
+    bool operator()(const ESPRIC::StartupContext& context) const {
+        return context.resetReason == reason;
+    }
+};
+
+/**
+ * @brief Callback that counts its copies.
+ */
+struct CountingCallback {
+    CountingCallback() = default;
+    CountingCallback(const CountingCallback&) { copies++; }
+    CountingCallback(CountingCallback&&) = default;
+
+    void operator()() const {
+        handled = handled + 1;
+    }
+};
+
+static constexpr int kConditionCount = ESP_RST_CPU_LOCKUP + 1; ///< One condition per reset reason.
+static constexpr int kBoots = 200000;                          ///< Simulated boots per mode.
+
+/**
+ * @brief Builds a temporary condition vector like `getResetConditions()`.
+ */
+static std::vector<ESPRIC::ESPRIC_Condition> getResetConditions() {
+    std::vector<ESPRIC::ESPRIC_Condition> conditions;
+    conditions.reserve(kConditionCount);
+    for (int reason = 0; reason < kConditionCount; ++reason) {
+        conditions.push_back({CountingPredicate(static_cast<esp_reset_reason_t>(reason)), CountingCallback()});
+    }
+    return conditions;
+}
+
+/**
+ * @brief Runs `kBoots` simulated boots and reports copies, allocations and time per boot.
+ *
+ * @param name Label printed in the report.
+ * @param boot Function performing one analyzer construction and analysis.
+ */
+template <typename Boot>
+static void measure(const char* name, Boot boot) {
+    ESPRIC::StartupContext context;
+    context.resetReason = ESP_RST_PANIC;
+
+    const size_t copiesBefore = copies;
+    const AllocationSnapshot before = allocationSnapshot();
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kBoots; ++i) {
+        boot(context);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    const AllocationSnapshot after = allocationSnapshot();
+
+    std::printf("%-24s %8.1f ns/boot %6.2f copies/condition %6.2f allocs/boot %8.1f bytes/boot\n", name,
+                std::chrono::duration<double, std::nano>(stop - start).count() / kBoots,
+                static_cast<double>(copies - copiesBefore) / kBoots / kConditionCount,
+                static_cast<double>(after.allocations - before.allocations) / kBoots,
+                static_cast<double>(after.bytes - before.bytes) / kBoots);
+}
+
+int main() {
+    static const std::vector<ESPRIC::ESPRIC_Condition> callerOwned = getResetConditions();
+
+    std::printf("conditions: %d\n", kConditionCount);
+
+    measure("temporary via const&", [](const ESPRIC::StartupContext& context) {
+        const std::vector<ESPRIC::ESPRIC_Condition>& conditions = getResetConditions();
+        ESPRIC espric(conditions); // Copies, as every constructor call did before
+        espric.analyze(context);
+    });
+
+    measure("temporary via &&", [](const ESPRIC::StartupContext& context) {
+        ESPRIC espric(getResetConditions());
+        espric.analyze(context);
+    });
+
+    measure("non-owning range", [](const ESPRIC::StartupContext& context) {
+        ESPRIC espric(callerOwned.data(), callerOwned.size());
+        espric.analyze(context);
+    });
+
+    measure("addCondition const&", [](const ESPRIC::StartupContext& context) {
+        ESPRIC espric({});
+        for (int reason = 0; reason < kConditionCount; ++reason) {
+            const ESPRIC::Condition condition = CountingPredicate(static_cast<esp_reset_reason_t>(reason));
+            const ESPRIC::Callback callback = CountingCallback();
+            espric.addCondition(condition, callback);
+        }
+        espric.analyze(context);
+    });
+
+    measure("addCondition &&", [](const ESPRIC::StartupContext& context) {
+        ESPRIC espric({});
+        for (int reason = 0; reason < kConditionCount; ++reason) {
+            espric.addCondition(ESPRIC::Condition(CountingPredicate(static_cast<esp_reset_reason_t>(reason))),
+                                ESPRIC::Callback(CountingCallback()));
+        }
+        espric.analyze(context);
+    });
+
+    measure("reserve + emplace", [](const ESPRIC::StartupContext& context) {
+        ESPRIC espric({});
+        espric.reserve(kConditionCount);
+        for (int reason = 0; reason < kConditionCount; ++reason) {
+            espric.emplaceCondition(CountingPredicate(static_cast<esp_reset_reason_t>(reason)), CountingCallback());
+        }
+        espric.analyze(context);
+    });
+
+    return handled == 0;
+}
@@ -0,0 +1,164 @@
+/**
+ * @file CoreBenchmark.cpp
+ * @brief Regression benchmark suite for the ESPRIC core with machine-readable output.
+ *
+ * Measures construction, `addCondition` and `analyze()` with 10, 100 and 1000 conditions.
+ * Every measurement is printed as one JSON object per line (JSON Lines), so results can be
+ * appended to a file and compared between commits. Heap allocations are counted with
+ * AllocationCounter.cpp; copies and moves of the conditions are counted by the functors.
+ *
+ * Only the measured operation is timed. Setup work, such as building the source vector for
+ * the move constructor, runs outside the timed region of every iteration.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <ESPRIC.h>
+#include "AllocationCounter.h"
+
+static size_t copies = 0;             ///< Copy constructions of counting predicates.
+static size_t moves = 0;              ///< Move constructions of counting predicates.
+static volatile unsigned handled = 0; ///< Side effect of every callback, keeps calls alive.
+
+/**
+ * @brief Predicate that matches one reset reason and counts its copies and moves.
+ *
+ * Every condition carries exactly one predicate, so its copies and moves count the
+ * transfers of whole `ESPRIC_Condition` records.
+ */
+struct CountingPredicate {
+    esp_reset_reason_t reason;
+
+    explicit CountingPredicate(esp_reset_reason_t reason) : reason(reason) {}
+    CountingPredicate(const CountingPredicate& other) : reason(other.reason) { copies++; }
+    CountingPredicate(CountingPredicate&& other) : reason(other.reason) { moves++; }
+
+    bool operator()(const ESPRIC::StartupContext& context) const {
+        return context.resetReason == reason;
+    }
+};
+
+static constexpr int kReasonCount = ESP_RST_CPU_LOCKUP + 1; ///< Reset reasons in ESP-IDF 5.3.2.
+static constexpr int kConditionCounts[] = {10, 100, 1000};   ///< Table sizes to measure.
+static constexpr long kConditionsPerRun = 2000000;           ///< Conditions processed per measurement.
+
+/**
+ * @brief Returns the predicate of condition `index`; reasons repeat every `kReasonCount` entries.
+ */
+static CountingPredicate predicateAt(int index) {
+    return CountingPredicate(static_cast<esp_reset_reason_t>(index % kReasonCount));
+}
+
+/**
+ * @brief Increments the callback side effect.
+ */
+static void handle() {
+    handled = handled + 1;
+}
+
+/**
+ * @brief Builds a condition vector of the given size.
+ */
+static std::vector<ESPRIC::ESPRIC_Condition> makeConditions(int count) {
+    std::vector<ESPRIC::ESPRIC_Condition> conditions;
+    conditions.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        conditions.push_back({predicateAt(i), handle});
+    }
+    return conditions;
+}
+
+/**
+ * @brief Times `operation` on the state returned by `setup` and prints one JSON line.
+ *
+ * @param name Benchmark name.
+ * @param count Number of conditions.
+ * @param setup Creates the untimed input of one iteration.
+ * @param operation The measured operation.
+ */
+template <typename Setup, typename Operation>
+static void measure(const char* name, int count, Setup setup, Operation operation) {
+    const long iterations = kConditionsPerRun / count;
+    std::chrono::steady_clock::duration elapsed{};
+    size_t allocations = 0;
+    size_t allocatedBytes = 0;
+    size_t copied = 0;
+    size_t moved = 0;
+
+    for (long i = 0; i < iterations; ++i) {
+        auto state = setup();
+
+        const size_t copiesBefore = copies;
+        const size_t movesBefore = moves;
+        const AllocationSnapshot before = allocationSnapshot();
+        const auto start = std::chrono::steady_clock::now();
+        operation(state);
+        const auto stop = std::chrono::steady_clock::now();
+        const AllocationSnapshot after = allocationSnapshot();
+
+        elapsed += stop - start;
+        allocations += after.allocations - before.allocations;
+        allocatedBytes += after.bytes - before.bytes;
+        copied += copies - copiesBefore;
+        moved += moves - movesBefore;
+    }
+
+    const double ns = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+    std::printf("{\"benchmark\":\"%s\",\"conditions\":%d,\"iterations\":%ld,"
+                "\"ns_per_op\":%.1f,\"ns_per_condition\":%.2f,"
+                "\"allocs_per_op\":%.2f,\"alloc_bytes_per_op\":%.1f,"
+                "\"copies_per_op\":%.2f,\"moves_per_op\":%.2f,\"bytes_copied_per_op\":%.1f}\n",
+                name, count, iterations, ns, ns / count,
+                static_cast<double>(allocations) / iterations,
+                static_cast<double>(allocatedBytes) / iterations,
+                static_cast<double>(copied) / iterations,
+                static_cast<double>(moved) / iterations,
+                static_cast<double>(copied + moved) * sizeof(ESPRIC::ESPRIC_Condition) / iterations);
+}
+
+int main() {
+    std::printf("{\"schema\":\"espric-core-benchmark/1\",\"compiler\":\"%s\",\"condition_bytes\":%u}\n",
+                __VERSION__, static_cast<unsigned>(sizeof(ESPRIC::ESPRIC_Condition)));
+
+    ESPRIC::StartupContext context;
+    context.resetReason = ESP_RST_PANIC;
+
+    for (int count : kConditionCounts) {
+        const std::vector<ESPRIC::ESPRIC_Condition> source = makeConditions(count);
+        struct None {};
+
+        measure("construct_copy", count, [] { return None{}; }, [&](None&) {
+            ESPRIC analyzer(source);
+        });
+
+        measure("construct_move", count, [&] { return source; }, [](std::vector<ESPRIC::ESPRIC_Condition>& conditions) {
+            ESPRIC analyzer(std::move(conditions));
+        });
+
+        measure("construct_view", count, [] { return None{}; }, [&](None&) {
+            ESPRIC analyzer(source.data(), source.size());
+        });
+
+        measure("add_condition", count, [] { return None{}; }, [count](None&) {
+            ESPRIC analyzer({});
+            for (int i = 0; i < count; ++i) {
+                analyzer.addCondition(ESPRIC::Condition(predicateAt(i)), ESPRIC::Callback(handle));
+            }
+        });
+
+        measure("reserve_emplace", count, [] { return None{}; }, [count](None&) {
+            ESPRIC analyzer({});
+            analyzer.reserve(count);
+            for (int i = 0; i < count; ++i) {
+                analyzer.emplaceCondition(predicateAt(i), handle);
+            }
+        });
+
+        ESPRIC analyzer(source);
+        measure("analyze", count, [] { return None{}; }, [&](None&) {
+            analyzer.analyze(context);
+        });
+    }
+
+    return handled == 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file FleetBenchmark.cpp
+ * @brief Scaling of `ESPRIC_FleetAggregator` (tools/FleetAggregator) from 1 to N threads.
+ *
+ * Synthetic fleet: 2000 devices with 10000 to 40000 boot-event records each (50 M records,
+ * 0.8 GB), 1 to 3 firmware tags per device in upgrade order, mostly deep-sleep resets with panics,
+ * brownouts and watchdog resets, plus erased and torn slots. Device sizes vary by a factor of
+ * four so that work stealing has something to balance.
+ *
+ * Set `ESPRIC_FLEET_RECORDS` to change the nominal records per device (default 20000). Every
+ * run must produce the same checksum over all histograms.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+#include <ESPRIC_BootLogFormat.h>
+#include <FleetAggregator.h>
+
+static constexpr unsigned kDevices = 2000; ///< Devices in the synthetic fleet.
+
+/**
+ * @brief Builds the log of one device.
+ */
+static void generate(std::vector<uint8_t>& log, size_t records, std::mt19937& random) {
+    log.assign(records * ESPRIC_BOOT_EVENT_SIZE, 0xFF);
+    const unsigned upgrades = random() % 3;
+    ESPRIC_BootEvent event;
+    for (size_t i = 0; i < records; i++) {
+        uint8_t* slot = &log[i * ESPRIC_BOOT_EVENT_SIZE];
+        const unsigned roll = random() % 1000;
+        if (roll < 20) {
+            continue; // Erased slot
+        }
+        event.bootId = static_cast<uint32_t>(i + 1);
+        event.firmwareTag = static_cast<uint16_t>(0x0100 + i * (upgrades + 1) / records);
+        // ESP_RST_PANIC, ESP_RST_BROWNOUT, ESP_RST_TASK_WDT, ESP_RST_POWERON, ESP_RST_DEEPSLEEP
+        event.resetReason = roll < 60 ? 4 : roll < 80 ? 9 : roll < 90 ? 6 : roll < 100 ? 1 : 8;
+        event.wakeupCause = event.resetReason == 8 ? 4 : 0;
+        event.uptimeMs = random();
+        espricEncodeBootEvent(event, slot);
+        if (roll == 999) {
+            slot[9] ^= 0x40; // Torn record
+        }
+    }
+}
+
+/**
+ * @brief Folds all counts of a result into one value.
+ */
+static uint64_t checksum(const std::vector<ESPRIC_FleetDevice>& devices) {
+    uint64_t sum = 0;
+    for (const ESPRIC_FleetDevice& device : devices) {
+        sum = sum * 31 + device.valid * 7 + device.erased * 5 + device.torn * 3;
+        for (const ESPRIC_FleetFirmware& firmware : device.firmware) {
+            for (unsigned reason = 0; reason < 256; reason++) {
+                sum = sum * 131 + firmware.reasons[reason] * (firmware.firmwareTag + reason + 1);
+            }
+        }
+    }
+    return sum;
+}
+
+int main() {
+    const char* configured = std::getenv("ESPRIC_FLEET_RECORDS");
+    const size_t records = configured != nullptr ? std::strtoul(configured, nullptr, 10) : 20000;
+
+    std::mt19937 random(7);
+    std::vector<std::vector<uint8_t>> logs(kDevices);
+    std::vector<ESPRIC_FleetInput> inputs;
+    size_t total = 0;
+    for (unsigned device = 0; device < kDevices; device++) {
+        generate(logs[device], records / 2 + random() % (records * 3 / 2), random);
+        inputs.push_back({"device-" + std::to_string(device), logs[device].data(), logs[device].size()});
+        total += logs[device].size() / ESPRIC_BOOT_EVENT_SIZE;
+    }
+    std::printf("%u devices, %.1f M records, %.2f GB\n", kDevices, total / 1e6,
+                total * ESPRIC_BOOT_EVENT_SIZE / 1e9);
+
+    const unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> counts;
+    for (unsigned threads = 1; threads < maxThreads; threads *= 2) {
+        counts.push_back(threads);
+    }
+    counts.push_back(maxThreads);
+
+    double single[2] = {0, 0};
+    for (int kernel = 0; kernel < 2; kernel++) {
+        const auto mode = kernel == 0 ? ESPRIC_FleetAggregator::Kernel::Scalar : ESPRIC_FleetAggregator::Kernel::Simd;
+        for (unsigned threads : counts) {
+            const ESPRIC_FleetAggregator aggregator(threads, mode);
+            const auto start = std::chrono::steady_clock::now();
+            const std::vector<ESPRIC_FleetDevice> devices = aggregator.aggregate(inputs);
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (threads == 1) {
+                single[kernel] = seconds;
+            }
+            std::printf("%-6s %3u threads  %8.1f M records/s  speedup %5.2f  steals %6llu  checksum %016llx\n",
+                        kernel == 0 ? "scalar" : "simd", threads, total / seconds / 1e6, single[kernel] / seconds,
+                        static_cast<unsigned long long>(aggregator.steals()),
+                        static_cast<unsigned long long>(checksum(devices)));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,193 @@
+/**
+ * @file GroupBenchmark.cpp
+ * @brief Compares a flat condition list with gated condition groups (`ESPRIC_ConditionGroup`).
+ *
+ * Both analyzers hold one condition per reset reason and one per wakeup cause. The flat list
+ * evaluates all of them on every boot. The grouped analyzer puts the wakeup conditions behind a
+ * deep-sleep gate, the crash resets behind a crash gate with a nested watchdog gate, the
+ * power resets behind a power gate and all other resets behind one more gate. The boot mix is that of a deep-sleep sensor: mostly timer
+ * wakeups, some power-on, software and crash resets.
+ *
+ * Afterwards every reset reason x wakeup cause combination is checked to run the same callbacks
+ * in both analyzers, and `PriorityOrdered` is checked to keep members inside their groups.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <ESPRIC.h>
+#include <ESPRIC_ConditionGroup.h>
+
+static constexpr int kReasonCount = ESP_RST_CPU_LOCKUP + 1;   ///< Reset reasons in ESP-IDF 5.3.2.
+static constexpr int kCauseCount = ESP_SLEEP_WAKEUP_BT + 1;   ///< Wakeup causes in ESP-IDF 5.3.2.
+static constexpr int kIterations = 200000;                    ///< analyze() calls per variant.
+
+static unsigned long long fired = 0; ///< Bit per fired callback: reasons in 0..15, causes in 32..44.
+static unsigned long long predicates = 0; ///< Evaluated predicates, gates included.
+
+/**
+ * @brief Condition on one reset reason that records its callback.
+ */
+static ESPRIC::ESPRIC_Condition reasonCondition(int reason) {
+    return {[reason](const ESPRIC::StartupContext& ctx) { predicates++; return ctx.resetReason == reason; },
+            [reason]() { fired |= 1ull << reason; }};
+}
+
+/**
+ * @brief Condition on one wakeup cause that records its callback.
+ */
+static ESPRIC::ESPRIC_Condition causeCondition(int cause) {
+    return {[cause](const ESPRIC::StartupContext& ctx) { predicates++; return ctx.wakeupCause == cause; },
+            [cause]() { fired |= 1ull << (32 + cause); }};
+}
+
+/**
+ * @brief Gate on a reset mask.
+ */
+static ESPRIC::Condition maskGate(uint32_t mask) {
+    return [mask](const ESPRIC::StartupContext& ctx) {
+        predicates++;
+        return (espricCauseBit(ctx.resetReason) & mask) != 0;
+    };
+}
+
+/**
+ * @brief One condition per reset reason and per wakeup cause.
+ */
+static void buildFlat(ESPRIC& analyzer) {
+    for (int reason = 0; reason < kReasonCount; reason++) {
+        analyzer.addCondition(reasonCondition(reason).condition, reasonCondition(reason).callback);
+    }
+    for (int cause = 0; cause < kCauseCount; cause++) {
+        analyzer.addCondition(causeCondition(cause).condition, causeCondition(cause).callback);
+    }
+}
+
+/**
+ * @brief The same conditions, grouped by crash, power and deep-sleep gates.
+ */
+static void buildGrouped(ESPRIC& analyzer, bool prioritized) {
+    ESPRIC_ConditionGroup watchdogs(maskGate(ESPRIC_RESET_MASK_ANY_WATCHDOG));
+    ESPRIC_ConditionGroup crashes(maskGate(ESPRIC_RESET_MASK_ANY_CRASH), prioritized ? -1 : 0);
+    ESPRIC_ConditionGroup power(maskGate(ESPRIC_RESET_MASK_ANY_POWER));
+    ESPRIC_ConditionGroup deepSleep(maskGate(espricResetMask(ESP_RST_DEEPSLEEP)), prioritized ? 20 : 0);
+    ESPRIC_ConditionGroup others(maskGate(~(ESPRIC_RESET_MASK_ANY_CRASH | ESPRIC_RESET_MASK_ANY_POWER |
+                                            espricResetMask(ESP_RST_DEEPSLEEP))));
+    for (int reason = 0; reason < kReasonCount; reason++) {
+        const ESPRIC::ESPRIC_Condition condition = reasonCondition(reason);
+        const int priority = prioritized ? reason : 0; // Reverses the order inside each group
+        if (ESPRIC_RESET_MASK_ANY_WATCHDOG & espricCauseBit(reason)) {
+            watchdogs.add(condition.condition, condition.callback, priority);
+        } else if (ESPRIC_RESET_MASK_ANY_CRASH & espricCauseBit(reason)) {
+            crashes.add(condition.condition, condition.callback, priority);
+        } else if (ESPRIC_RESET_MASK_ANY_POWER & espricCauseBit(reason)) {
+            power.add(condition.condition, condition.callback, priority);
+        } else if (reason == ESP_RST_DEEPSLEEP) {
+            deepSleep.add(condition.condition, condition.callback, priority);
+        } else {
+            others.add(condition.condition, condition.callback, priority);
+        }
+    }
+    for (int cause = 0; cause < kCauseCount; cause++) {
+        deepSleep.add(causeCondition(cause).condition, causeCondition(cause).callback, prioritized ? cause : 0);
+    }
+    crashes.add(watchdogs);
+    analyzer.addGroup(crashes);
+    analyzer.addGroup(power);
+    analyzer.addGroup(deepSleep);
+    analyzer.addGroup(others);
+}
+
+/**
+ * @brief Reset reason and wakeup cause of simulated boot `boot` of a deep-sleep sensor.
+ */
+static ESPRIC::StartupContext bootOf(int boot) {
+    ESPRIC::StartupContext context;
+    const int roll = boot % 100;
+    context.resetReason = roll < 90 ? ESP_RST_DEEPSLEEP : roll < 94 ? ESP_RST_POWERON : roll < 98 ? ESP_RST_SW
+                                                                                      : ESP_RST_PANIC;
+    context.wakeupCause = roll < 85 ? ESP_SLEEP_WAKEUP_TIMER : roll < 90 ? ESP_SLEEP_WAKEUP_EXT0
+                                                                         : ESP_SLEEP_WAKEUP_UNDEFINED;
+    return context;
+}
+
+/**
+ * @brief Measures the duration and the evaluated predicates of `analyze()` over the boot mix.
+ */
+static void measure(const char* name, ESPRIC& analyzer) {
+    predicates = 0;
+    size_t gated = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kIterations; i++) {
+        gated += analyzer.analyze(bootOf(i)).gated;
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    std::printf("%-8s %7.1f ns/analyze  %5.2f predicates/boot  %5.2f entries gated/boot\n", name,
+                std::chrono::duration<double, std::nano>(stop - start).count() / kIterations,
+                static_cast<double>(predicates) / kIterations, static_cast<double>(gated) / kIterations);
+}
+
+/**
+ * @brief Returns true if both analyzers fire the same callbacks for every combination.
+ */
+static bool sameCallbacks(ESPRIC& flat, ESPRIC& grouped, bool deepSleepOnlyWakeups) {
+    for (int reason = 0; reason < kReasonCount; reason++) {
+        for (int cause = 0; cause < kCauseCount; cause++) {
+            ESPRIC::StartupContext context;
+            context.resetReason = static_cast<esp_reset_reason_t>(reason);
+            context.wakeupCause = static_cast<esp_sleep_wakeup_cause_t>(cause);
+            fired = 0;
+            flat.analyze(context);
+            unsigned long long expected = fired;
+            if (deepSleepOnlyWakeups && reason != ESP_RST_DEEPSLEEP) {
+                expected &= (1ull << 32) - 1; // Wakeup conditions are gated on a deep-sleep reset
+            }
+            fired = 0;
+            grouped.analyze(context);
+            if (fired != expected) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main() {
+    ESPRIC flat({});
+    buildFlat(flat);
+    ESPRIC grouped({});
+    buildGrouped(grouped, false);
+
+    measure("flat", flat);
+    measure("grouped", grouped);
+
+    std::printf("\nChecks:\n");
+    std::printf("  %-44s %s\n", "same callbacks for all 16 x 13 boots",
+                sameCallbacks(flat, grouped, true) ? "ok" : "FAILED");
+
+    ESPRIC prioritized({}, nullptr, ESPRIC::EvaluationPolicy::PriorityOrdered);
+    buildGrouped(prioritized, true);
+    ESPRIC firstMatch({}, nullptr, ESPRIC::EvaluationPolicy::FirstMatch);
+    buildGrouped(firstMatch, false);
+    ESPRIC::StartupContext context;
+    context.resetReason = ESP_RST_TASK_WDT;
+    fired = 0;
+    const ESPRIC::AnalysisResult result = prioritized.analyze(context);
+    std::printf("  %-44s %s\n", "PriorityOrdered keeps members in their group",
+                fired == (1ull << ESP_RST_TASK_WDT) && result.matched == 1 ? "ok" : "FAILED");
+    context.resetReason = ESP_RST_DEEPSLEEP;
+    context.wakeupCause = ESP_SLEEP_WAKEUP_TIMER;
+    fired = 0;
+    predicates = 0;
+    prioritized.analyze(context);
+    // Deep-sleep gate, then the causes of priority 12 to 9, then the reason of priority 8 matches
+    std::printf("  %-44s %s\n", "PriorityOrdered evaluates the top group first",
+                fired == (1ull << ESP_RST_DEEPSLEEP) && predicates == 6 ? "ok" : "FAILED");
+    fired = 0;
+    predicates = 0;
+    // Skipped: the wakeup conditions, then the gate of the other resets and its 8 members
+    const ESPRIC::AnalysisResult first = firstMatch.analyze(context);
+    std::printf("  %-44s %s\n", "FirstMatch skips the remaining entries",
+                fired == (1ull << ESP_RST_DEEPSLEEP) && first.matched == 1 && first.skipped == kCauseCount + 1 + 8 ? "ok"
+                                                                                                         : "FAILED");
+    return 0;
+}
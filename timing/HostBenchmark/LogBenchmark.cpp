@@ -0,0 +1,206 @@
+/**
+ * @file LogBenchmark.cpp
+ * @brief Formatted text lines versus tokenized `ESPRIC_Log` records per boot.
+ *
+ * The baseline formats the lines a sketch prints at boot (the boot context, the message of the
+ * reset reason and of the wakeup cause, the analysis result) with `snprintf()`, as `Serial.printf()`
+ * does. The tokenized variant stores the same information with `ESPRIC_Log::log()` and drains the
+ * frames once. Both report the CPU time per boot and the bytes that reach the UART, with the
+ * resulting wire time at 115200 baud (10 bits per byte), the time a blocking print waits once
+ * the UART FIFO is full.
+ *
+ * Afterwards the round trip through `tools/LogExpander`'s decoder, the drop accounting, the
+ * resynchronization after garbage and corrupted frames and the expansion of unknown ids are
+ * checked.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <ESPRIC.h>
+#include <ESPRIC_Log.h>
+
+static constexpr int kBoots = 200000;       ///< Simulated boots per variant.
+static constexpr double kUsPerByte = 86.8;  ///< 115200 baud, 8N1.
+
+/**
+ * @brief Output that keeps the bytes, like the `Serial` of `drainTo()`.
+ */
+struct ByteSink {
+    std::vector<uint8_t> bytes; ///< Everything written.
+
+    size_t write(const uint8_t* data, size_t size) {
+        bytes.insert(bytes.end(), data, data + size);
+        return size;
+    }
+};
+
+/**
+ * @brief Output that only counts bytes.
+ */
+struct CountingSink {
+    size_t total = 0; ///< Bytes written.
+
+    size_t write(const uint8_t*, size_t size) {
+        total += size;
+        return size;
+    }
+};
+
+/**
+ * @brief Decodes and expands a byte stream as the LogExpander does.
+ *
+ * @param skipped Bytes outside valid frames.
+ */
+static std::vector<std::string> expand(const std::vector<uint8_t>& bytes, size_t* skipped = nullptr) {
+    std::vector<std::string> lines;
+    size_t offset = 0;
+    size_t garbage = 0;
+    while (offset < bytes.size()) {
+        ESPRIC_LogRecord record;
+        size_t consumed = 0;
+        if (espricLogDecodeFrame(bytes.data() + offset, bytes.size() - offset, record, consumed) ==
+            ESPRIC_LogFrameStatus::Valid) {
+            char text[256];
+            espricLogExpand(record, text, sizeof(text));
+            lines.push_back(text);
+            offset += consumed;
+        } else {
+            offset++;
+            garbage++;
+        }
+    }
+    if (skipped != nullptr) {
+        *skipped = garbage;
+    }
+    return lines;
+}
+
+/**
+ * @brief Prints CPU time and UART bytes per boot.
+ */
+static void report(const char* name, std::chrono::steady_clock::time_point start, size_t bytes) {
+    const auto stop = std::chrono::steady_clock::now();
+    const double perBoot = static_cast<double>(bytes) / kBoots;
+    std::printf("%-12s %7.1f ns/boot  %6.1f UART bytes/boot  %7.1f us on the wire\n", name,
+                std::chrono::duration<double, std::nano>(stop - start).count() / kBoots, perBoot, perBoot * kUsPerByte);
+}
+
+int main() {
+    ESPRIC::StartupContext context;
+    context.resetReason = ESP_RST_PANIC;
+    context.wakeupCause = ESP_SLEEP_WAKEUP_UNDEFINED;
+    context.uptimeUs = 48213;
+    const ESPRIC::AnalysisResult result = {2, 14};
+
+    size_t textBytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int boot = 0; boot < kBoots; boot++) {
+        char line[128];
+        textBytes += std::snprintf(line, sizeof(line), "boot: reset %s, wakeup %s, uptime %lu us\n",
+                                   espricResetReasonName(context.resetReason), espricWakeupCauseName(context.wakeupCause),
+                                   static_cast<unsigned long>(context.uptimeUs));
+        textBytes += std::snprintf(line, sizeof(line), "%s\n", espricResetReasonMessage(context.resetReason));
+        textBytes += std::snprintf(line, sizeof(line), "%s\n", espricWakeupCauseMessage(context.wakeupCause));
+        textBytes += std::snprintf(line, sizeof(line), "analyze: %u matched, %u unmatched, %u skipped, %u deferred, %u gated\n",
+                                   static_cast<unsigned>(result.matched), static_cast<unsigned>(result.unmatched),
+                                   static_cast<unsigned>(result.skipped), static_cast<unsigned>(result.deferred),
+                                   static_cast<unsigned>(result.gated));
+    }
+    report("text", start, textBytes);
+
+    CountingSink counter;
+    ESPRIC_Log timed;
+    timed.drainTo(counter); // Not part of a boot: the catalog record is written once per log
+    counter.total = 0;
+    start = std::chrono::steady_clock::now();
+    for (int boot = 0; boot < kBoots; boot++) {
+        timed.log(ESPRIC_LOG_BOOT, context.resetReason, context.wakeupCause, context.uptimeUs);
+        timed.log(ESPRIC_LOG_RESET_REASON, context.resetReason);
+        timed.log(ESPRIC_LOG_WAKEUP_CAUSE, context.wakeupCause);
+        timed.log(ESPRIC_LOG_ANALYSIS, result.matched, result.unmatched, result.skipped, result.deferred, result.gated);
+        timed.drainTo(counter);
+    }
+    report("tokenized", start, counter.total);
+
+    std::printf("\nChecks:\n");
+
+    // Round trip: analyzer output through the host expander.
+    ESPRIC_Log log;
+    ESPRIC analyzer({});
+    analyzer.setLog(&log);
+    analyzer.onResetReason(ESP_RST_PANIC, [&log]() { log.log(ESPRIC_LOG_RESET_REASON, ESP_RST_PANIC); });
+    analyzer.analyze(context);
+    ByteSink sink;
+    log.drainTo(sink);
+    const std::vector<std::string> lines = expand(sink.bytes);
+    char catalog[32];
+    std::snprintf(catalog, sizeof(catalog), "log: catalog %lx", static_cast<unsigned long>(espricLogCatalogHash()));
+    const std::vector<std::string> expected = {
+        catalog,
+        "boot: reset ESP_RST_PANIC, wakeup ESP_SLEEP_WAKEUP_UNDEFINED, uptime 48213 us",
+        "Panic reset detected.",
+        "analyze: 1 matched, 0 unmatched, 0 skipped, 0 deferred, 0 gated",
+    };
+    std::printf("  %-44s %s\n", "analyzer records expand to the text lines", lines == expected ? "ok" : "FAILED");
+    std::printf("  %-44s %s\n", "tokenized boot is smaller than the text",
+                sink.bytes.size() * 4 < textBytes / kBoots ? "ok" : "FAILED");
+
+    // Overflow: records that do not fit are counted and reported in stream order.
+    ESPRIC_Log full;
+    unsigned accepted = 0;
+    for (unsigned i = 0; i < 1000; i++) {
+        accepted += full.log(ESPRIC_LOG_POWER_DOWN, 1, i);
+    }
+    const uint32_t dropped = full.dropped();
+    ByteSink first;
+    uint8_t chunk[64];
+    first.write(chunk, full.read(chunk, sizeof(chunk))); // Makes room for new records
+    full.log(ESPRIC_LOG_POWER_DOWN, 2, 0);
+    full.drainTo(first);
+    const std::vector<std::string> overflow = expand(first.bytes);
+    char droppedLine[64];
+    std::snprintf(droppedLine, sizeof(droppedLine), "log: %u records dropped, buffer full", static_cast<unsigned>(dropped));
+    std::printf("  %-44s %s\n", "dropped records counted",
+                accepted + dropped == 1000 && dropped > 0 && full.dropped() == 0 ? "ok" : "FAILED");
+    std::printf("  %-44s %s\n", "drop count precedes the next record",
+                overflow.size() == accepted + 3 && overflow[overflow.size() - 2] == droppedLine &&
+                        overflow.back() == "power-down: profile 2, failed domains 0x0" ? "ok" : "FAILED");
+
+    // Resynchronization: boot messages on the same UART and a corrupted frame are skipped.
+    std::vector<uint8_t> noisy;
+    const char rom[] = "ets Jun  8 2016 00:22:57\r\nrst:0xc (SW_CPU_RESET),boot:0x13\r\n";
+    noisy.insert(noisy.end(), rom, rom + sizeof(rom) - 1);
+    ESPRIC_Log pieces;
+    pieces.log(ESPRIC_LOG_BOOT_LOOP, 2, 3);
+    pieces.log(ESPRIC_LOG_BOOT_LOOP, 1, 2);
+    ByteSink frames;
+    pieces.drainTo(frames);
+    const size_t catalogFrame = frames.bytes[1] + 3u;
+    frames.bytes[catalogFrame + 3] ^= 0x40; // Bit flip in the first boot-loop frame
+    noisy.insert(noisy.end(), frames.bytes.begin(), frames.bytes.end());
+    size_t skipped = 0;
+    const std::vector<std::string> resynced = expand(noisy, &skipped);
+    std::printf("  %-44s %s\n", "text and corrupted frame skipped",
+                resynced.size() == 2 && resynced[1] == "boot loop: state 1, 2 recent crashes" &&
+                        skipped == sizeof(rom) - 1 + frames.bytes[catalogFrame + 1] + 3u ? "ok" : "FAILED");
+
+    // Expansion details: signed arguments, unknown ids.
+    ESPRIC_LogRecord record;
+    record.id = ESPRIC_LOG_APP_FIRST + 7;
+    record.count = 2;
+    record.args[0] = 5;
+    record.args[1] = static_cast<uint32_t>(-12);
+    char text[64];
+    espricLogExpand(record, text, sizeof(text));
+    const ESPRIC_LogMessage app[] = {{ESPRIC_LOG_APP_FIRST + 7, "sensor %u: %d mV, 100%%"}};
+    char appText[64];
+    espricLogExpand(record, appText, sizeof(appText), app, 1);
+    std::printf("  %-44s %s\n", "unknown id printed with raw arguments",
+                std::strcmp(text, "#263 0x5 0xfffffff4") == 0 ? "ok" : "FAILED");
+    std::printf("  %-44s %s\n", "application catalog and %d expanded",
+                std::strcmp(appText, "sensor 5: -12 mV, 100%") == 0 ? "ok" : "FAILED");
+    return 0;
+}
@@ -0,0 +1,60 @@
+/**
+ * @file MaskBenchmark.cpp
+ * @brief Compares grouped rules written as `||` predicate chains with mask conditions.
+ *
+ * Every rule covers three reset reasons, like "any watchdog" covers `ESP_RST_INT_WDT`,
+ * `ESP_RST_TASK_WDT` and `ESP_RST_WDT`. The predicate version re-queries
+ * `esp_reset_reason()` in every rule, as hand-written conditions do today. The mask version
+ * registers the same rules with `ESPRIC::addMaskCondition()`.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <ESPRIC.h>
+
+static volatile unsigned handled = 0; ///< Side effect of every callback, keeps calls alive.
+
+static constexpr int kReasonCount = ESP_RST_CPU_LOCKUP + 1; ///< Reset reasons in ESP-IDF 5.3.2.
+static constexpr int kRuleCounts[] = {16, 128, 512};         ///< Rule table sizes to measure.
+static constexpr int kIterations = 2000;                     ///< analyze() calls per reason.
+
+/**
+ * @brief Measures the average duration of `analyze()` over all simulated reset reasons.
+ */
+static double measure(ESPRIC& analyzer) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int reason = 0; reason < kReasonCount; ++reason) {
+        espricHostSetResetReason(static_cast<esp_reset_reason_t>(reason));
+        const ESPRIC::StartupContext context = ESPRIC::StartupContext::capture();
+        for (int i = 0; i < kIterations; ++i) {
+            analyzer.analyze(context);
+        }
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() /
+           (static_cast<double>(kIterations) * kReasonCount);
+}
+
+int main() {
+    for (int rules : kRuleCounts) {
+        ESPRIC chains({});
+        ESPRIC masks({});
+        chains.reserve(rules);
+
+        for (int rule = 0; rule < rules; ++rule) {
+            const auto a = static_cast<esp_reset_reason_t>(rule % kReasonCount);
+            const auto b = static_cast<esp_reset_reason_t>((rule * 7 + 3) % kReasonCount);
+            const auto c = static_cast<esp_reset_reason_t>((rule * 11 + 5) % kReasonCount);
+            chains.addCondition(
+                [a, b, c]() { return esp_reset_reason() == a || esp_reset_reason() == b || esp_reset_reason() == c; },
+                []() { handled = handled + 1; });
+            masks.addMaskCondition(espricResetMask(a, b, c), 0, []() { handled = handled + 1; });
+        }
+
+        const double chainNs = measure(chains);
+        const double maskNs = measure(masks);
+        std::printf("rules: %4d  predicate chains: %9.1f ns/analyze (%5.2f ns/rule)  masks: %8.1f ns/analyze (%5.2f ns/rule)\n",
+                    rules, chainNs, chainNs / rules, maskNs, maskNs / rules);
+    }
+    return handled == 0;
+}
@@ -0,0 +1,71 @@
+/**
+ * @file MatrixBenchmark.cpp
+ * @brief Compares two full condition scans with one `ESPRIC_Matrix` lookup.
+ *
+ * The scan version mirrors examples/10-ResetWakeupDemo: one analyzer with a context
+ * condition per reset reason and one with a context condition per wakeup cause. The matrix
+ * version binds the same handlers as row and column wildcards. Every combination of reset
+ * reason and wakeup cause is simulated.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <ESPRIC.h>
+#include <ESPRIC_Matrix.h>
+
+static volatile unsigned handled = 0; ///< Side effect of every handler, keeps calls alive.
+
+static constexpr int kReasonCount = ESP_RST_CPU_LOCKUP + 1; ///< Reset reasons in ESP-IDF 5.3.2.
+static constexpr int kCauseCount = ESP_SLEEP_WAKEUP_BT + 1; ///< Wakeup causes of the Arduino core.
+static constexpr int kIterations = 20000;                   ///< Analyses per combination.
+
+/**
+ * @brief Measures the average duration of one analysis over all combinations.
+ */
+template <typename Analyze>
+static double measure(Analyze analyze) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int reason = 0; reason < kReasonCount; ++reason) {
+        for (int cause = 0; cause < kCauseCount; ++cause) {
+            ESPRIC::StartupContext context;
+            context.resetReason = static_cast<esp_reset_reason_t>(reason);
+            context.wakeupCause = static_cast<esp_sleep_wakeup_cause_t>(cause);
+            for (int i = 0; i < kIterations; ++i) {
+                analyze(context);
+            }
+        }
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() /
+           (static_cast<double>(kIterations) * kReasonCount * kCauseCount);
+}
+
+int main() {
+    ESPRIC resetAnalyzer({});
+    ESPRIC wakeupAnalyzer({});
+    ESPRIC_Matrix matrix;
+
+    for (int reason = 0; reason < kReasonCount; ++reason) {
+        const auto value = static_cast<esp_reset_reason_t>(reason);
+        resetAnalyzer.addCondition([value](const ESPRIC::StartupContext& context) { return context.resetReason == value; },
+                                   []() { handled = handled + 1; });
+        matrix.onReset(value, []() { handled = handled + 1; });
+    }
+    for (int cause = 0; cause < kCauseCount; ++cause) {
+        const auto value = static_cast<esp_sleep_wakeup_cause_t>(cause);
+        wakeupAnalyzer.addCondition([value](const ESPRIC::StartupContext& context) { return context.wakeupCause == value; },
+                                    []() { handled = handled + 1; });
+        matrix.onWakeup(value, []() { handled = handled + 1; });
+    }
+
+    const double scanNs = measure([&](const ESPRIC::StartupContext& context) {
+        resetAnalyzer.analyze(context);
+        wakeupAnalyzer.analyze(context);
+    });
+    const double matrixNs = measure([&](const ESPRIC::StartupContext& context) { matrix.analyze(context); });
+
+    std::printf("conditions: %d reset + %d wakeup\n", kReasonCount, kCauseCount);
+    std::printf("two scans:      %8.1f ns/boot\n", scanNs);
+    std::printf("matrix lookup:  %8.1f ns/boot\n", matrixNs);
+    return handled == 0;
+}
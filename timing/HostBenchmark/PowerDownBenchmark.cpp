@@ -0,0 +1,183 @@
+/**
+ * @file PowerDownBenchmark.cpp
+ * @brief Per-domain `std::function` conditions versus diff-applied `ESPRIC_PowerDown` profiles.
+ *
+ * The baseline is the structure of timing/ValidatePowerDownDomainConditions: one condition per
+ * domain that calls `esp_sleep_pd_config()` and `isError()`, evaluated before every sleep. The
+ * duty cycle is that of a sensor that light-sleeps between samples and switches to the RTC
+ * peripheral profile every tenth cycle. The stub counts the `esp_sleep_pd_config()` calls, the
+ * work that costs a critical section (and log output in verbose builds) on the device, and
+ * models the ESP-IDF 5 reference count of `ESP_PD_OPTION_ON`.
+ *
+ * Afterwards the reference counts, the release of ON domains moving to AUTO, the error mask,
+ * the retry of failed domains, the RTC store across a simulated reset and the rejection of
+ * invalid profiles are checked.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <vector>
+#include <ESPRIC_PowerDown.h>
+
+static constexpr int kCycles = 1000000; ///< Sleep cycles per variant.
+
+/**
+ * @brief One domain of the baseline, as in PowerDownDomainConditions.h.
+ */
+struct PowerDownDomainCondition {
+    const char* conditionName;
+    std::function<bool()> condition;
+    std::function<void()> callback;
+};
+
+static unsigned failures = 0; ///< Failures reported by the baseline callbacks.
+
+/**
+ * @brief Baseline error check, without the log output of the sketch.
+ */
+static bool isError(esp_err_t err, const char* domainName) {
+    (void)domainName;
+    return err != ESP_OK;
+}
+
+/**
+ * @brief Baseline conditions for the settings of a profile table.
+ */
+template <size_t N>
+static std::vector<PowerDownDomainCondition> conditionsOf(const ESPRIC_PowerDownSetting (&settings)[N]) {
+    std::vector<PowerDownDomainCondition> conditions;
+    for (const ESPRIC_PowerDownSetting& setting : settings) {
+        conditions.push_back({"PD Domain",
+                              [setting]() { return isError(esp_sleep_pd_config(setting.domain, setting.option), "PD"); },
+                              []() { failures++; }});
+    }
+    return conditions;
+}
+
+/**
+ * @brief Returns true if the stub holds the options of `profile` for every domain.
+ */
+static bool stubMatches(const ESPRIC_PowerDownProfile& profile) {
+    for (unsigned domain = 0; domain < ESP_PD_DOMAIN_MAX; domain++) {
+        const unsigned option = (profile.options >> (2 * domain)) & 3u;
+        if (espricHostPdOption(static_cast<esp_sleep_pd_domain_t>(domain)) != option) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Returns true if no domain holds more than one ON reference.
+ */
+static bool refsBalanced() {
+    for (unsigned domain = 0; domain < ESP_PD_DOMAIN_MAX; domain++) {
+        if (espricHostPdRefs(static_cast<esp_sleep_pd_domain_t>(domain)) > 1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Prints the duration and `esp_sleep_pd_config()` calls per cycle.
+ */
+static void report(const char* name, std::chrono::steady_clock::time_point start, uint32_t calls) {
+    const auto stop = std::chrono::steady_clock::now();
+    std::printf("%-12s %7.1f ns/cycle  %5.2f pd_config calls/cycle\n", name,
+                std::chrono::duration<double, std::nano>(stop - start).count() / kCycles,
+                static_cast<double>(espricHostPdConfigCalls() - calls) / kCycles);
+}
+
+int main() {
+    const std::vector<PowerDownDomainCondition> deepSleep = conditionsOf(ESPRIC_PD_DEEP_SLEEP_SETTINGS);
+    const std::vector<PowerDownDomainCondition> rtcPeriph = conditionsOf(ESPRIC_PD_RTC_PERIPH_SETTINGS);
+
+    espricHostResetPdConfig();
+    uint32_t calls = espricHostPdConfigCalls();
+    auto start = std::chrono::steady_clock::now();
+    for (int cycle = 0; cycle < kCycles; cycle++) {
+        for (const PowerDownDomainCondition& condition : cycle % 10 == 9 ? rtcPeriph : deepSleep) {
+            if (condition.condition()) {
+                condition.callback();
+            }
+        }
+    }
+    report("conditions", start, calls);
+
+    espricHostResetPdConfig();
+    ESPRIC_PowerDownStore store{};
+    ESPRIC_PowerDown powerDown(store);
+    uint16_t errors = 0;
+    calls = espricHostPdConfigCalls();
+    start = std::chrono::steady_clock::now();
+    for (int cycle = 0; cycle < kCycles; cycle++) {
+        errors |= powerDown.apply(cycle % 10 == 9 ? ESPRIC_PD_PROFILE_RTC_PERIPH : ESPRIC_PD_PROFILE_DEEP_SLEEP);
+    }
+    report("profile", start, calls);
+
+    std::printf("\nChecks:\n");
+    std::printf("  %-44s %s\n", "options in effect match the profile",
+                errors == 0 && failures == 0 && stubMatches(ESPRIC_PD_PROFILE_RTC_PERIPH) ? "ok" : "FAILED");
+    std::printf("  %-44s %s\n", "at most one ON reference per domain", refsBalanced() ? "ok" : "FAILED");
+
+    // ON to AUTO: AUTO alone does not release the ON reference.
+    espricHostResetPdConfig();
+    esp_sleep_pd_config(ESP_PD_DOMAIN_XTAL, ESP_PD_OPTION_ON);
+    esp_sleep_pd_config(ESP_PD_DOMAIN_XTAL, ESP_PD_OPTION_AUTO);
+    const bool stuck = espricHostPdOption(ESP_PD_DOMAIN_XTAL) == ESP_PD_OPTION_ON;
+    espricHostResetPdConfig();
+    constexpr ESPRIC_PowerDownSetting kXtalOn[] = {{ESP_PD_DOMAIN_XTAL, ESP_PD_OPTION_ON}};
+    constexpr ESPRIC_PowerDownSetting kAllAuto[] = {{ESP_PD_DOMAIN_XTAL, ESP_PD_OPTION_AUTO}};
+    ESPRIC_PowerDownStore autoStore{};
+    ESPRIC_PowerDown toAuto(autoStore);
+    toAuto.apply(espricPowerDownProfile(4, kXtalOn));
+    errors = toAuto.apply(espricPowerDownProfile(5, kAllAuto));
+    std::printf("  %-44s %s\n", "ON released before AUTO",
+                stuck && errors == 0 && toAuto.issued() == 2 && espricHostPdOption(ESP_PD_DOMAIN_XTAL) == ESP_PD_OPTION_AUTO &&
+                        espricHostPdRefs(ESP_PD_DOMAIN_XTAL) == 0 && toAuto.options() == espricPowerDownAutoOptions()
+                        ? "ok" : "FAILED");
+
+    // A new object on the same store, as after a reset: the stored profile is history and the
+    // diff starts again from ESP_PD_OPTION_AUTO.
+    espricHostResetPdConfig(); // ESP-IDF keeps its configuration in ordinary RAM
+    ESPRIC_PowerDown rebooted(store);
+    const ESPRIC_PowerDown::StoreState state = rebooted.begin();
+    std::printf("  %-44s %s\n", "previous profile survives the reset",
+                state == ESPRIC_PowerDown::StoreState::Valid &&
+                        rebooted.previousProfile() == ESPRIC_PD_PROFILE_RTC_PERIPH.id ? "ok" : "FAILED");
+
+    espricHostSetPdConfigFailures(1u << ESP_PD_DOMAIN_XTAL);
+    errors = rebooted.apply(ESPRIC_PD_PROFILE_DEEP_SLEEP);
+    const size_t firstIssued = rebooted.issued();
+    std::printf("  %-44s %s\n", "first apply after reset issues all domains",
+                firstIssued == sizeof(ESPRIC_PD_DEEP_SLEEP_SETTINGS) / sizeof(ESPRIC_PowerDownSetting) ? "ok" : "FAILED");
+    std::printf("  %-44s %s\n", "failed domain reported in the error mask",
+                errors == (1u << ESP_PD_DOMAIN_XTAL) ? "ok" : "FAILED");
+    ESPRIC_PowerDown next(store);
+    next.begin();
+    std::printf("  %-44s %s\n", "errors before the reset are kept",
+                next.previousErrors() == (1u << ESP_PD_DOMAIN_XTAL) &&
+                        next.previousProfile() == ESPRIC_PD_PROFILE_DEEP_SLEEP.id ? "ok" : "FAILED");
+    espricHostSetPdConfigFailures(0);
+    errors = rebooted.apply(ESPRIC_PD_PROFILE_DEEP_SLEEP);
+    std::printf("  %-44s %s\n", "failed domain retried, others skipped",
+                errors == 0 && rebooted.issued() == 1 ? "ok" : "FAILED");
+
+    store.options ^= 1; // Bit flip in RTC memory
+    ESPRIC_PowerDown corrupted(store);
+    std::printf("  %-44s %s\n", "corrupted store detected",
+                corrupted.begin() == ESPRIC_PowerDown::StoreState::Corrupted && corrupted.previousProfile() == 0 ? "ok"
+                                                                                                             : "FAILED");
+
+    constexpr ESPRIC_PowerDownSetting kTwice[] = {{ESP_PD_DOMAIN_XTAL, ESP_PD_OPTION_OFF},
+                                                  {ESP_PD_DOMAIN_XTAL, ESP_PD_OPTION_ON}};
+    constexpr ESPRIC_PowerDownProfile kInvalid = espricPowerDownProfile(3, kTwice);
+    static_assert(kInvalid.invalid == (1u << ESP_PD_DOMAIN_XTAL), "duplicate domain not flagged");
+    calls = espricHostPdConfigCalls();
+    std::printf("  %-44s %s\n", "duplicate domain rejected, not issued",
+                corrupted.apply(kInvalid) == (1u << ESP_PD_DOMAIN_XTAL) && espricHostPdConfigCalls() == calls ? "ok"
+                                                                                                           : "FAILED");
+    return 0;
+}
@@ -0,0 +1,167 @@
+/**
+ * @file ReportBenchmark.cpp
+ * @brief One blocking write per line versus one batched `ESPRIC_Report` flush per boot.
+ *
+ * The baseline is the structure of `variants/ESPRIC_Conditions.h`: every callback prints its
+ * line to `Serial` on its own, and the sketch prints the boot context and the result around
+ * `analyze()`. The report variant adds structured events from the same callbacks and lets
+ * `analyze()` flush them once through a text sink. Both write to a counting transport that
+ * stands in for the UART, so the output is the number of transport writes per boot next to the
+ * CPU time. On the device every write of the baseline can block until the UART FIFO drains.
+ *
+ * Afterwards the batch content, the drop accounting, the whole-line truncation of the buffer
+ * sink and the splitting of large batches are checked, and a sample report is written through
+ * `ESPRIC_StdoutSink`.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ESPRIC.h>
+#include <ESPRIC_CauseNames.h>
+#include <ESPRIC_Report.h>
+
+static constexpr int kBoots = 200000; ///< Simulated boots per variant.
+
+/**
+ * @brief Transport stand-in that counts writes and bytes.
+ */
+struct Transport {
+    size_t writes = 0; ///< Calls, i.e. potential UART waits.
+    size_t bytes = 0;  ///< Bytes written.
+
+    void write(const char*, size_t size) {
+        writes++;
+        bytes += size;
+    }
+};
+
+static Transport uart; ///< Shared by both variants.
+
+/**
+ * @brief Text sink on the counting transport.
+ */
+class TransportSink : public ESPRIC_TextSink {
+protected:
+    bool output(const char* text, size_t size) override {
+        uart.write(text, size);
+        return true;
+    }
+};
+
+/**
+ * @brief Baseline `Serial.println()`: one transport write per line.
+ */
+static void println(const char* text) {
+    char line[160];
+    const int size = std::snprintf(line, sizeof(line), "%s\n", text);
+    uart.write(line, static_cast<size_t>(size));
+}
+
+/**
+ * @brief Prints CPU time and transport writes per boot.
+ */
+static void report(const char* name, std::chrono::steady_clock::time_point start, const Transport& before) {
+    const auto stop = std::chrono::steady_clock::now();
+    std::printf("%-10s %7.1f ns/boot  %5.2f writes/boot  %6.1f bytes/boot\n", name,
+                std::chrono::duration<double, std::nano>(stop - start).count() / kBoots,
+                static_cast<double>(uart.writes - before.writes) / kBoots,
+                static_cast<double>(uart.bytes - before.bytes) / kBoots);
+}
+
+int main() {
+    ESPRIC::StartupContext context;
+    context.resetReason = ESP_RST_PANIC;
+    context.wakeupCause = ESP_SLEEP_WAKEUP_UNDEFINED;
+    context.uptimeUs = 48213;
+
+    ESPRIC printing({});
+    printing.onResetReason(ESP_RST_PANIC, []() { println(espricResetReasonMessage(ESP_RST_PANIC)); });
+    printing.onWakeupCause(ESP_SLEEP_WAKEUP_UNDEFINED,
+                           []() { println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_UNDEFINED)); });
+    printing.addMaskCondition(ESPRIC_RESET_MASK_ANY_CRASH, 0, []() { println("Crash before this boot"); });
+
+    Transport before = uart;
+    auto start = std::chrono::steady_clock::now();
+    for (int boot = 0; boot < kBoots; boot++) {
+        char line[160];
+        std::snprintf(line, sizeof(line), "boot: reset %s, wakeup %s, uptime %lu us",
+                      espricResetReasonName(context.resetReason), espricWakeupCauseName(context.wakeupCause),
+                      static_cast<unsigned long>(context.uptimeUs));
+        println(line);
+        const ESPRIC::AnalysisResult result = printing.analyze(context);
+        std::snprintf(line, sizeof(line), "analyze: %u matched, %u unmatched, %u skipped, %u deferred, %u gated",
+                      static_cast<unsigned>(result.matched), static_cast<unsigned>(result.unmatched),
+                      static_cast<unsigned>(result.skipped), static_cast<unsigned>(result.deferred),
+                      static_cast<unsigned>(result.gated));
+        println(line);
+    }
+    report("println", start, before);
+
+    TransportSink sink;
+    ESPRIC_Report batch(sink);
+    ESPRIC reporting({});
+    reporting.setReport(&batch);
+    reporting.onResetReason(ESP_RST_PANIC, [&batch]() { batch.resetReason(ESP_RST_PANIC); });
+    reporting.onWakeupCause(ESP_SLEEP_WAKEUP_UNDEFINED, [&batch]() { batch.wakeupCause(ESP_SLEEP_WAKEUP_UNDEFINED); });
+    reporting.addMaskCondition(ESPRIC_RESET_MASK_ANY_CRASH, 0, [&batch]() { batch.note("Crash before this boot"); });
+
+    before = uart;
+    start = std::chrono::steady_clock::now();
+    for (int boot = 0; boot < kBoots; boot++) {
+        reporting.analyze(context);
+    }
+    report("report", start, before);
+
+    std::printf("\nChecks:\n");
+
+    char text[512];
+    ESPRIC_BufferSink buffer(text, sizeof(text));
+    batch.setSink(buffer);
+    before = uart;
+    reporting.analyze(context);
+    const char* expected = "boot: reset ESP_RST_PANIC, wakeup ESP_SLEEP_WAKEUP_UNDEFINED, uptime 48213 us\n"
+                           "Crash before this boot\n"
+                           "Panic reset detected.\n"
+                           "No defined wakeup cause.\n"
+                           "analyze: 3 matched, 0 unmatched, 0 skipped, 0 deferred, 0 gated\n";
+    std::printf("  %-44s %s\n", "one flush with boot, callbacks and result",
+                std::strcmp(text, expected) == 0 && batch.pending() == 0 && uart.writes == before.writes ? "ok" : "FAILED");
+
+    buffer.clear();
+    for (int i = 0; i < ESPRIC_REPORT_MAX_EVENTS + 5; i++) {
+        batch.note("event", i);
+    }
+    const uint32_t dropped = batch.dropped();
+    const size_t flushed = batch.flush();
+    std::printf("  %-44s %s\n", "overflow reported as last line",
+                dropped == 5 && flushed == ESPRIC_REPORT_MAX_EVENTS + 1 &&
+                        std::strstr(text, "event 15\nreport: 5 events dropped, batch full\n") != nullptr ? "ok" : "FAILED");
+
+    char small[40];
+    ESPRIC_BufferSink tight(small, sizeof(small));
+    batch.setSink(tight);
+    batch.note("first line");
+    batch.note("second line");
+    batch.note("third line, too long for the rest");
+    batch.flush();
+    std::printf("  %-44s %s\n", "buffer sink keeps whole lines only",
+                std::strcmp(small, "first line\nsecond line\n") == 0 && tight.truncated() == 1 ? "ok" : "FAILED");
+
+    batch.setSink(sink);
+    for (int i = 0; i < ESPRIC_REPORT_MAX_EVENTS; i++) {
+        batch.boot(context); // 78 bytes per line
+    }
+    before = uart;
+    batch.flush();
+    const size_t expectedWrites = (ESPRIC_REPORT_MAX_EVENTS * 78 + ESPRIC_REPORT_TEXT_SIZE - 1) / ESPRIC_REPORT_TEXT_SIZE;
+    std::printf("  %-44s %s\n", "large batch split into text-size blocks",
+                uart.writes - before.writes <= expectedWrites + 1 && uart.bytes - before.bytes == ESPRIC_REPORT_MAX_EVENTS * 78u
+                        ? "ok" : "FAILED");
+
+    std::printf("\nSample report (ESPRIC_StdoutSink):\n");
+    ESPRIC_StdoutSink stdoutSink;
+    batch.setSink(stdoutSink);
+    reporting.analyze(context);
+    return 0;
+}
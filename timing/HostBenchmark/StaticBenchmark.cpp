@@ -0,0 +1,95 @@
+/**
+ * @file StaticBenchmark.cpp
+ * @brief Compares the heap-based `ESPRIC` analyzer with the compile-time `StaticESPRIC`.
+ *
+ * Both analyzers handle the 16 reset reasons of ESP-IDF 5.3.2 with context predicates. For
+ * `ESPRIC` the measured boot path includes building the condition vector, as
+ * `getResetConditions()` does on every boot. Heap allocations are counted with
+ * AllocationCounter.cpp.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <ESPRIC.h>
+#include <ESPRIC_Static.h>
+#include "AllocationCounter.h"
+
+static volatile unsigned handled = 0; ///< Side effect of every handler, keeps calls alive.
+
+static void onReset() {
+    handled = handled + 1;
+}
+
+static constexpr ESPRIC_StaticCondition kResetConditions[] = {
+    {espricResetReasonIs<ESP_RST_UNKNOWN>, onReset},
+    {espricResetReasonIs<ESP_RST_POWERON>, onReset},
+    {espricResetReasonIs<ESP_RST_EXT>, onReset},
+    {espricResetReasonIs<ESP_RST_SW>, onReset},
+    {espricResetReasonIs<ESP_RST_PANIC>, onReset},
+    {espricResetReasonIs<ESP_RST_INT_WDT>, onReset},
+    {espricResetReasonIs<ESP_RST_TASK_WDT>, onReset},
+    {espricResetReasonIs<ESP_RST_WDT>, onReset},
+    {espricResetReasonIs<ESP_RST_DEEPSLEEP>, onReset},
+    {espricResetReasonIs<ESP_RST_BROWNOUT>, onReset},
+    {espricResetReasonIs<ESP_RST_SDIO>, onReset},
+    {espricResetReasonIs<ESP_RST_USB>, onReset},
+    {espricResetReasonIs<ESP_RST_JTAG>, onReset},
+    {espricResetReasonIs<ESP_RST_EFUSE>, onReset},
+    {espricResetReasonIs<ESP_RST_PWR_GLITCH>, onReset},
+    {espricResetReasonIs<ESP_RST_CPU_LOCKUP>, onReset},
+};
+
+static constexpr int kReasonCount = ESP_RST_CPU_LOCKUP + 1; ///< Reset reasons in ESP-IDF 5.3.2.
+static constexpr int kIterations = 100000;                  ///< Boots simulated per reason.
+
+/**
+ * @brief Builds the condition vector like `getResetConditions()` does at boot.
+ */
+static std::vector<ESPRIC::ESPRIC_Condition> getResetConditions() {
+    std::vector<ESPRIC::ESPRIC_Condition> conditions;
+    for (const auto& descriptor : kResetConditions) {
+        conditions.push_back({descriptor.predicate, descriptor.handler});
+    }
+    return conditions;
+}
+
+/**
+ * @brief Runs one simulated boot per iteration and reports time and heap usage.
+ *
+ * @param name Label printed in the report.
+ * @param boot Function performing one analyzer construction and analysis.
+ */
+template <typename Boot>
+static void measure(const char* name, Boot boot) {
+    const AllocationSnapshot before = allocationSnapshot();
+    const auto start = std::chrono::steady_clock::now();
+    for (int reason = 0; reason < kReasonCount; ++reason) {
+        ESPRIC::StartupContext context;
+        context.resetReason = static_cast<esp_reset_reason_t>(reason);
+        for (int i = 0; i < kIterations; ++i) {
+            boot(context);
+        }
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    const AllocationSnapshot after = allocationSnapshot();
+    const double boots = static_cast<double>(kIterations) * kReasonCount;
+    std::printf("%-14s %8.1f ns/boot %8.2f allocs/boot %8.1f bytes/boot\n", name,
+                std::chrono::duration<double, std::nano>(stop - start).count() / boots,
+                (after.allocations - before.allocations) / boots, (after.bytes - before.bytes) / boots);
+}
+
+int main() {
+    std::printf("conditions: %d\n", kReasonCount);
+
+    measure("ESPRIC", [](const ESPRIC::StartupContext& context) {
+        ESPRIC espric(getResetConditions());
+        espric.analyze(context);
+    });
+
+    measure("StaticESPRIC", [](const ESPRIC::StartupContext& context) {
+        StaticESPRIC<kResetConditions> espric;
+        espric.analyze(context);
+    });
+
+    return handled == 0;
+}
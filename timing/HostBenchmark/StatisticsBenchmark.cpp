@@ -0,0 +1,170 @@
+/**
+ * @file StatisticsBenchmark.cpp
+ * @brief Compares the NVS traffic of hand-rolled boot counters with `ESPRIC_ResetStatistics`.
+ *
+ * The hand-rolled variant follows examples/04-ErrorCounterInNVS: every matching callback reads
+ * and writes its own counter with `getInt`/`putInt`, and a brownout callback resets the counters
+ * with one `putInt` each. The blob variant keeps 32 reset and 32 wakeup counters in RAM and
+ * rewrites them as one `putBytes` blob per boot. The statistics variant attaches an
+ * `ESPRIC_ResetStatistics` store with `CommitPolicy::AfterAnalyze`. Flash traffic is counted by
+ * the simulated NVS of the `Preferences` stand-in in 32-byte NVS entries, the unit a device
+ * writes and erases; on a device every write costs milliseconds and wears the flash.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <Preferences.h>
+#include <ESPRIC.h>
+#include <ESPRIC_ResetStatistics.h>
+
+static constexpr int kBoots = 10000; ///< Simulated boots per variant.
+
+/**
+ * @brief Reset reason of simulated boot `boot`: mostly deep sleep, some power-on, panic and brownout.
+ */
+static esp_reset_reason_t reasonOf(int boot) {
+    switch (boot % 20) {
+        case 0:  return ESP_RST_POWERON;
+        case 7:  return ESP_RST_PANIC;
+        case 13: return ESP_RST_BROWNOUT;
+        default: return ESP_RST_DEEPSLEEP;
+    }
+}
+
+/**
+ * @brief Runs `kBoots` simulated boots and prints the NVS traffic per boot.
+ */
+template <typename Boot>
+static void measure(const char* name, Boot boot) {
+    espricHostNvsErase();
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kBoots; ++i) {
+        ESPRIC::StartupContext context;
+        context.resetReason = reasonOf(i);
+        boot(context);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    std::printf("%-22s %5.2f namespace opens/boot  %5.2f NVS writes/boot  %5.2f NVS entries/boot  "
+                "%6.1f bytes/boot  %8.1f ns/boot (simulated NVS)\n", name,
+                static_cast<double>(espricHostNvsOpens()) / kBoots,
+                static_cast<double>(espricHostNvsWrites()) / kBoots,
+                static_cast<double>(espricHostNvsEntries()) / kBoots,
+                static_cast<double>(espricHostNvsEntries()) * 32 / kBoots,
+                std::chrono::duration<double, std::nano>(stop - start).count() / kBoots);
+}
+
+/**
+ * @brief Prints whether `condition` holds.
+ */
+static void check(const char* name, bool condition) {
+    std::printf("  %-44s %s\n", name, condition ? "ok" : "FAILED");
+}
+
+static Preferences preferences; ///< Namespace handle of the hand-rolled variant.
+
+/**
+ * @brief Increments one hand-rolled counter with a read and a write.
+ */
+static void increment(const char* key) {
+    preferences.putInt(key, preferences.getInt(key, 0) + 1);
+}
+
+int main() {
+    measure("hand-rolled putInt", [](const ESPRIC::StartupContext& context) {
+        preferences.begin("errorAnalyzer", false);
+        ESPRIC analyzer({
+            {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_PANIC; },
+             []() { increment("panicCount"); }},
+            {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_POWERON; },
+             []() { increment("powerOnCount"); }},
+            {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_DEEPSLEEP; },
+             []() { increment("sleepCount"); }},
+            {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_BROWNOUT; },
+             []() {
+                 preferences.putInt("panicCount", 0);
+                 preferences.putInt("powerOnCount", 0);
+             }},
+            {[](const ESPRIC::StartupContext&) { return true; },
+             []() { increment("bootCount"); }}
+        });
+        analyzer.analyze(context);
+        preferences.end();
+    });
+
+    measure("268-byte blob per boot", [](const ESPRIC::StartupContext& context) {
+        struct {
+            uint32_t header[2];
+            uint32_t boots;
+            uint32_t reset[32];
+            uint32_t wakeup[32];
+        } blob;
+        preferences.begin("errorAnalyzer", false);
+        if (preferences.getBytes("counters", &blob, sizeof(blob)) != sizeof(blob)) {
+            std::memset(&blob, 0, sizeof(blob));
+        }
+        blob.boots++;
+        blob.reset[context.resetReason]++;
+        blob.wakeup[context.wakeupCause]++;
+        if (context.resetReason == ESP_RST_BROWNOUT) {
+            blob.reset[ESP_RST_PANIC] = 0;
+            blob.reset[ESP_RST_POWERON] = 0;
+        }
+        preferences.putBytes("counters", &blob, sizeof(blob));
+        preferences.end();
+    });
+
+    measure("ESPRIC_ResetStatistics", [](const ESPRIC::StartupContext& context) {
+        static ESPRIC_ResetStatistics* current = nullptr;
+        ESPRIC_ResetStatistics statistics("errorAnalyzer");
+        statistics.begin();
+        current = &statistics;
+
+        ESPRIC analyzer({
+            {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_BROWNOUT; },
+             []() {
+                 current->clear(ESP_RST_PANIC);
+                 current->clear(ESP_RST_POWERON);
+             }}
+        });
+        analyzer.setResetStatistics(&statistics);
+        analyzer.analyze(context);
+    });
+
+    // The counters survive the simulated reboots: reload them as the next boot would.
+    ESPRIC_ResetStatistics reloaded("errorAnalyzer");
+    const bool loaded = reloaded.begin();
+    uint32_t sleeps = 0;
+    uint32_t brownouts = 0;
+    for (int i = 0; i < kBoots; ++i) {
+        sleeps += reasonOf(i) == ESP_RST_DEEPSLEEP;
+        brownouts += reasonOf(i) == ESP_RST_BROWNOUT;
+    }
+    check("counters reloaded from NVS", loaded && reloaded.boots() == kBoots);
+    check("per-reason counters persisted", reloaded.resetCount(ESP_RST_DEEPSLEEP) == sleeps &&
+                                                reloaded.resetCount(ESP_RST_BROWNOUT) == brownouts &&
+                                                reloaded.wakeupCount(ESP_SLEEP_WAKEUP_UNDEFINED) == kBoots);
+    // The last brownout (boot 9993) came after the last panic and power-on and cleared both.
+    check("cleared counters persisted", reloaded.resetCount(ESP_RST_PANIC) == 0 &&
+                                             reloaded.resetCount(ESP_RST_POWERON) == 0);
+
+    // A boot writes only the counters it changed: boots, its reason and its cause.
+    espricHostNvsErase();
+    ESPRIC_ResetStatistics store("espric_check");
+    store.begin();
+    for (int i = 0; i < 3; ++i) {
+        ESPRIC::StartupContext context;
+        context.resetReason = ESP_RST_DEEPSLEEP;
+        context.wakeupCause = ESP_SLEEP_WAKEUP_TIMER;
+        store.record(context);
+        store.commit();
+    }
+    check("three NVS entries per boot", espricHostNvsEntries() == 9);
+    store.clear(ESP_RST_DEEPSLEEP);
+    const size_t entries = espricHostNvsEntries();
+    check("cleared counter removed, not written", store.commit() && espricHostNvsEntries() == entries &&
+                                                      !store.dirty());
+    store.end();
+
+    return 0;
+}
@@ -0,0 +1,224 @@
+/**
+ * @file HostStubs.cpp
+ * @brief Simulated cause providers and NVS for host builds of the ESPRIC library.
+ *
+ * The getters are deliberately defined out of line, like the ESP-IDF functions they
+ * replace, so a benchmark pays one real call per HAL query.
+ */
+
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <vector>
+#include "esp_system.h"
+#include "esp_sleep.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+#include "Preferences.h"
+
+static esp_reset_reason_t hostResetReason = ESP_RST_POWERON;          ///< Simulated reset reason.
+static esp_sleep_wakeup_cause_t hostWakeupCause = ESP_SLEEP_WAKEUP_UNDEFINED; ///< Simulated wakeup cause.
+static uint64_t hostExt1WakeupMask = 0;                               ///< Simulated EXT1 wakeup mask.
+static esp_sleep_pd_option_t hostPdOptions[ESP_PD_DOMAIN_MAX] = {};    ///< Power-down options in effect.
+static bool hostPdSet[ESP_PD_DOMAIN_MAX] = {};                         ///< Domains with an option in effect.
+static uint32_t hostPdRefs[ESP_PD_DOMAIN_MAX] = {};                    ///< ESP_PD_OPTION_ON references per domain.
+static uint32_t hostPdFailures = 0;                                   ///< Domains whose configuration fails.
+static uint32_t hostPdCalls = 0;                                      ///< Calls of esp_sleep_pd_config().
+static const auto hostStart = std::chrono::steady_clock::now();       ///< Simulated boot time.
+
+extern "C" esp_reset_reason_t esp_reset_reason(void) {
+    return hostResetReason;
+}
+
+extern "C" void espricHostSetResetReason(esp_reset_reason_t reason) {
+    hostResetReason = reason;
+}
+
+extern "C" esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause(void) {
+    return hostWakeupCause;
+}
+
+extern "C" void espricHostSetWakeupCause(esp_sleep_wakeup_cause_t cause) {
+    hostWakeupCause = cause;
+}
+
+extern "C" uint64_t esp_sleep_get_ext1_wakeup_status(void) {
+    return hostExt1WakeupMask;
+}
+
+extern "C" void espricHostSetExt1WakeupMask(uint64_t mask) {
+    hostExt1WakeupMask = mask;
+}
+
+extern "C" esp_err_t esp_sleep_pd_config(esp_sleep_pd_domain_t domain, esp_sleep_pd_option_t option) {
+    hostPdCalls++;
+    if (domain >= ESP_PD_DOMAIN_MAX || option > ESP_PD_OPTION_AUTO) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (hostPdFailures & (1u << domain)) {
+        return ESP_FAIL;
+    }
+    // As in ESP-IDF 5: ON takes a reference, OFF releases one, the option changes at zero
+    if (option == ESP_PD_OPTION_ON) {
+        hostPdRefs[domain]++;
+    } else if (option == ESP_PD_OPTION_OFF && hostPdRefs[domain] != 0) {
+        hostPdRefs[domain]--;
+    }
+    if (option == ESP_PD_OPTION_ON || hostPdRefs[domain] == 0) {
+        hostPdOptions[domain] = option;
+        hostPdSet[domain] = true;
+    }
+    return ESP_OK;
+}
+
+extern "C" void espricHostSetPdConfigFailures(uint32_t domainMask) {
+    hostPdFailures = domainMask;
+}
+
+extern "C" uint32_t espricHostPdConfigCalls(void) {
+    return hostPdCalls;
+}
+
+extern "C" esp_sleep_pd_option_t espricHostPdOption(esp_sleep_pd_domain_t domain) {
+    return hostPdSet[domain] ? hostPdOptions[domain] : ESP_PD_OPTION_AUTO;
+}
+
+extern "C" uint32_t espricHostPdRefs(esp_sleep_pd_domain_t domain) {
+    return hostPdRefs[domain];
+}
+
+extern "C" void espricHostResetPdConfig(void) {
+    for (unsigned domain = 0; domain < ESP_PD_DOMAIN_MAX; domain++) {
+        hostPdOptions[domain] = ESP_PD_OPTION_AUTO;
+        hostPdSet[domain] = false;
+        hostPdRefs[domain] = 0;
+    }
+}
+
+extern "C" soc_reset_reason_t esp_rom_get_reset_reason(int cpu_no) {
+    (void)cpu_no;
+    switch (hostResetReason) {
+        case ESP_RST_POWERON:   return RESET_REASON_CHIP_POWER_ON;
+        case ESP_RST_DEEPSLEEP: return RESET_REASON_CORE_DEEP_SLEEP;
+        default:                return RESET_REASON_CORE_SW;
+    }
+}
+
+extern "C" int64_t esp_timer_get_time(void) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - hostStart).count();
+}
+
+// Simulated NVS for the Preferences stand-in
+
+static std::map<std::string, std::vector<uint8_t>> hostNvs; ///< Simulated NVS content by "namespace/key".
+static size_t hostNvsOpens = 0;                             ///< Simulated namespace opens.
+static size_t hostNvsWrites = 0;                            ///< Simulated NVS writes.
+static size_t hostNvsEntries = 0;                           ///< Simulated 32-byte NVS entries written.
+static constexpr size_t kHostNvsEntrySize = 32;             ///< Size of one NVS entry.
+
+bool Preferences::begin(const char* name, bool readOnly, const char*) {
+    namespace_ = name;
+    readOnly_ = readOnly;
+    open_ = true;
+    hostNvsOpens++;
+    return true;
+}
+
+void Preferences::end() {
+    open_ = false;
+}
+
+bool Preferences::clear() {
+    if (!open_ || readOnly_) {
+        return false;
+    }
+    const std::string prefix = namespace_ + "/";
+    for (auto it = hostNvs.begin(); it != hostNvs.end();) {
+        it = it->first.compare(0, prefix.size(), prefix) == 0 ? hostNvs.erase(it) : std::next(it);
+    }
+    hostNvsWrites++;
+    return true;
+}
+
+bool Preferences::remove(const char* key) {
+    if (!open_ || readOnly_) {
+        return false;
+    }
+    hostNvsWrites++;
+    return hostNvs.erase(path(key)) > 0;
+}
+
+size_t Preferences::putInt(const char* key, int32_t value) {
+    return store(key, &value, sizeof(value), 1);
+}
+
+int32_t Preferences::getInt(const char* key, int32_t defaultValue) {
+    int32_t value = defaultValue;
+    return getBytes(key, &value, sizeof(value)) == sizeof(value) ? value : defaultValue;
+}
+
+size_t Preferences::putUInt(const char* key, uint32_t value) {
+    return store(key, &value, sizeof(value), 1);
+}
+
+uint32_t Preferences::getUInt(const char* key, uint32_t defaultValue) {
+    uint32_t value = defaultValue;
+    return getBytes(key, &value, sizeof(value)) == sizeof(value) ? value : defaultValue;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t length) {
+    // Chunk header, data entries and blob index (NVS blob layout of ESP-IDF 4 and later)
+    return store(key, value, length, 2 + (length + kHostNvsEntrySize - 1) / kHostNvsEntrySize);
+}
+
+size_t Preferences::getBytes(const char* key, void* buffer, size_t maxLength) {
+    const auto it = hostNvs.find(path(key));
+    if (!open_ || it == hostNvs.end() || it->second.size() > maxLength) {
+        return 0;
+    }
+    std::memcpy(buffer, it->second.data(), it->second.size());
+    return it->second.size();
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    const auto it = hostNvs.find(path(key));
+    return open_ && it != hostNvs.end() ? it->second.size() : 0;
+}
+
+std::string Preferences::path(const char* key) const {
+    return namespace_ + "/" + key;
+}
+
+/**
+ * @brief Stores a value occupying `entries` NVS entries.
+ */
+size_t Preferences::store(const char* key, const void* value, size_t length, size_t entries) {
+    if (!open_ || readOnly_) {
+        return 0;
+    }
+    const uint8_t* bytes = static_cast<const uint8_t*>(value);
+    hostNvs[path(key)].assign(bytes, bytes + length);
+    hostNvsWrites++;
+    hostNvsEntries += entries;
+    return length;
+}
+
+size_t espricHostNvsOpens() {
+    return hostNvsOpens;
+}
+
+size_t espricHostNvsWrites() {
+    return hostNvsWrites;
+}
+
+size_t espricHostNvsEntries() {
+    return hostNvsEntries;
+}
+
+void espricHostNvsErase() {
+    hostNvs.clear();
+    hostNvsOpens = 0;
+    hostNvsWrites = 0;
+    hostNvsEntries = 0;
+}
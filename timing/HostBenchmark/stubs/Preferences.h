@@ -0,0 +1,66 @@
+/**
+ * @file Preferences.h
+ * @brief Host stand-in for the Arduino-ESP32 `Preferences` NVS wrapper.
+ *
+ * Values are kept in process memory. Every `begin()` counts as one namespace open and every
+ * `put*()` as one NVS write (the Arduino library commits after each put). Each write also counts
+ * the 32-byte NVS entries it occupies: one for an integer, and for a blob a chunk header, one
+ * entry per 32 data bytes and the blob index. Benchmarks can so compare the flash traffic of
+ * different persistence strategies by volume, not just by calls.
+ */
+
+#ifndef ESPRIC_HOST_PREFERENCES_H
+#define ESPRIC_HOST_PREFERENCES_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+/**
+ * @brief Subset of the Arduino `Preferences` API used by the ESPRIC library and examples.
+ */
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false, const char* partitionLabel = nullptr);
+    void end();
+    bool clear();
+    bool remove(const char* key);
+
+    size_t putInt(const char* key, int32_t value);
+    int32_t getInt(const char* key, int32_t defaultValue = 0);
+    size_t putUInt(const char* key, uint32_t value);
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0);
+    size_t putBytes(const char* key, const void* value, size_t length);
+    size_t getBytes(const char* key, void* buffer, size_t maxLength);
+    size_t getBytesLength(const char* key);
+
+private:
+    std::string path(const char* key) const;
+    size_t store(const char* key, const void* value, size_t length, size_t entries);
+
+    std::string namespace_;
+    bool open_ = false;
+    bool readOnly_ = false;
+};
+
+/**
+ * @brief Returns the number of simulated namespace opens since start.
+ */
+size_t espricHostNvsOpens();
+
+/**
+ * @brief Returns the number of simulated NVS writes since start.
+ */
+size_t espricHostNvsWrites();
+
+/**
+ * @brief Returns the number of simulated 32-byte NVS entries written since start.
+ */
+size_t espricHostNvsEntries();
+
+/**
+ * @brief Erases all simulated NVS content and resets the counters.
+ */
+void espricHostNvsErase();
+
+#endif // ESPRIC_HOST_PREFERENCES_H
@@ -0,0 +1,15 @@
+/**
+ * @file esp_err.h
+ * @brief Host stand-in for the ESP-IDF error codes.
+ */
+
+#ifndef ESPRIC_HOST_ESP_ERR_H
+#define ESPRIC_HOST_ESP_ERR_H
+
+typedef int esp_err_t;
+
+#define ESP_OK              0       ///< Success.
+#define ESP_FAIL            -1      ///< Generic failure.
+#define ESP_ERR_INVALID_ARG 0x102   ///< Invalid argument.
+
+#endif // ESPRIC_HOST_ESP_ERR_H
@@ -0,0 +1,19 @@
+/**
+ * @file esp_idf_version.h
+ * @brief Host stand-in for the ESP-IDF version macros (ESP-IDF 5.3.2).
+ */
+
+#ifndef ESPRIC_HOST_ESP_IDF_VERSION_H
+#define ESPRIC_HOST_ESP_IDF_VERSION_H
+
+#define ESP_IDF_VERSION_MAJOR   5
+#define ESP_IDF_VERSION_MINOR   3
+#define ESP_IDF_VERSION_PATCH   2
+
+#define ESP_IDF_VERSION_VAL(major, minor, patch) ((major << 16) | (minor << 8) | (patch))
+
+#define ESP_IDF_VERSION  ESP_IDF_VERSION_VAL(ESP_IDF_VERSION_MAJOR, \
+                                             ESP_IDF_VERSION_MINOR, \
+                                             ESP_IDF_VERSION_PATCH)
+
+#endif // ESPRIC_HOST_ESP_IDF_VERSION_H
@@ -0,0 +1,33 @@
+/**
+ * @file esp_rom_sys.h
+ * @brief Host stand-in for the ROM reset reason query.
+ */
+
+#ifndef ESPRIC_HOST_ESP_ROM_SYS_H
+#define ESPRIC_HOST_ESP_ROM_SYS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Raw ROM reset reason (subset of `soc_reset_reason_t`).
+ */
+typedef enum {
+    RESET_REASON_CHIP_POWER_ON = 0x01, //!< Power on reset
+    RESET_REASON_CORE_SW       = 0x03, //!< Software resets the digital core
+    RESET_REASON_CORE_DEEP_SLEEP = 0x05, //!< Deep sleep reset the digital core
+} soc_reset_reason_t;
+
+/**
+ * @brief Returns the simulated raw reset reason of a core.
+ */
+soc_reset_reason_t esp_rom_get_reset_reason(int cpu_no);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ESPRIC_HOST_ESP_ROM_SYS_H
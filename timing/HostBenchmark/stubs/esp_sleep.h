@@ -0,0 +1,125 @@
+/**
+ * @file esp_sleep.h
+ * @brief Host stand-in for the ESP-IDF `esp_sleep.h` wakeup cause and power-down API.
+ *
+ * The enumerations mirror resources/Arduino-IDE/esp_sleep.h. `esp_sleep_get_wakeup_cause()`
+ * returns the value set with `espricHostSetWakeupCause()`. `esp_sleep_pd_config()` models the
+ * reference count of ESP-IDF 5: `ESP_PD_OPTION_ON` takes a reference, `ESP_PD_OPTION_OFF`
+ * releases one, and OFF or AUTO only take effect once no reference is left. It fails for the
+ * domains set with `espricHostSetPdConfigFailures()`.
+ */
+
+#ifndef ESPRIC_HOST_ESP_SLEEP_H
+#define ESPRIC_HOST_ESP_SLEEP_H
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "soc/soc_caps.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Power domains which can be powered down in sleep mode
+ */
+typedef enum {
+    ESP_PD_DOMAIN_RTC_PERIPH,      //!< RTC IO, sensors and ULP co-processor
+    ESP_PD_DOMAIN_RTC_SLOW_MEM,    //!< RTC slow memory
+    ESP_PD_DOMAIN_RTC_FAST_MEM,    //!< RTC fast memory
+    ESP_PD_DOMAIN_XTAL,            //!< XTAL oscillator
+#if SOC_PM_SUPPORT_CPU_PD
+    ESP_PD_DOMAIN_CPU,             //!< CPU core
+#endif
+    ESP_PD_DOMAIN_RTC8M,           //!< Internal 8M oscillator
+    ESP_PD_DOMAIN_VDDSDIO,         //!< VDD_SDIO
+    ESP_PD_DOMAIN_MAX              //!< Number of domains
+} esp_sleep_pd_domain_t;
+
+/**
+ * @brief Power down options
+ */
+typedef enum {
+    ESP_PD_OPTION_OFF,      //!< Power down the power domain in sleep mode
+    ESP_PD_OPTION_ON,       //!< Keep power domain enabled during sleep mode
+    ESP_PD_OPTION_AUTO      //!< Keep power domain enabled in sleep mode, if it is needed by one of the wakeup options. Otherwise power it down.
+} esp_sleep_pd_option_t;
+
+/**
+ * @brief Sleep wakeup cause (Arduino-ESP32 core).
+ */
+typedef enum {
+    ESP_SLEEP_WAKEUP_UNDEFINED,    //!< In case of deep sleep, reset was not caused by exit from deep sleep
+    ESP_SLEEP_WAKEUP_ALL,          //!< Not a wakeup cause, used to disable all wakeup sources with esp_sleep_disable_wakeup_source
+    ESP_SLEEP_WAKEUP_EXT0,         //!< Wakeup caused by external signal using RTC_IO
+    ESP_SLEEP_WAKEUP_EXT1,         //!< Wakeup caused by external signal using RTC_CNTL
+    ESP_SLEEP_WAKEUP_TIMER,        //!< Wakeup caused by timer
+    ESP_SLEEP_WAKEUP_TOUCHPAD,     //!< Wakeup caused by touchpad
+    ESP_SLEEP_WAKEUP_ULP,          //!< Wakeup caused by ULP program
+    ESP_SLEEP_WAKEUP_GPIO,         //!< Wakeup caused by GPIO (light sleep only)
+    ESP_SLEEP_WAKEUP_UART,         //!< Wakeup caused by UART (light sleep only)
+    ESP_SLEEP_WAKEUP_WIFI,              //!< Wakeup caused by WIFI (light sleep only)
+    ESP_SLEEP_WAKEUP_COCPU,             //!< Wakeup caused by COCPU int
+    ESP_SLEEP_WAKEUP_COCPU_TRAP_TRIG,   //!< Wakeup caused by COCPU crash
+    ESP_SLEEP_WAKEUP_BT,           //!< Wakeup caused by BT (light sleep only)
+} esp_sleep_source_t;
+
+/* Leave this type define for compatibility */
+typedef esp_sleep_source_t esp_sleep_wakeup_cause_t;
+
+/**
+ * @brief Returns the simulated wakeup cause.
+ */
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause(void);
+
+/**
+ * @brief Returns the simulated EXT1 wakeup GPIO mask.
+ */
+uint64_t esp_sleep_get_ext1_wakeup_status(void);
+
+/**
+ * @brief Updates the reference count and option of `domain`; fails for the domains set with
+ *        `espricHostSetPdConfigFailures()`.
+ */
+esp_err_t esp_sleep_pd_config(esp_sleep_pd_domain_t domain, esp_sleep_pd_option_t option);
+
+/**
+ * @brief Makes `esp_sleep_pd_config()` fail for the domains in `domainMask` (bit n = domain n).
+ */
+void espricHostSetPdConfigFailures(uint32_t domainMask);
+
+/**
+ * @brief Returns the number of `esp_sleep_pd_config()` calls so far.
+ */
+uint32_t espricHostPdConfigCalls(void);
+
+/**
+ * @brief Returns the option in effect for `domain`, `ESP_PD_OPTION_AUTO` if never set.
+ */
+esp_sleep_pd_option_t espricHostPdOption(esp_sleep_pd_domain_t domain);
+
+/**
+ * @brief Returns the number of `ESP_PD_OPTION_ON` references held on `domain`.
+ */
+uint32_t espricHostPdRefs(esp_sleep_pd_domain_t domain);
+
+/**
+ * @brief Clears all options and references, as a reset does on the device.
+ */
+void espricHostResetPdConfig(void);
+
+/**
+ * @brief Sets the value returned by `esp_sleep_get_wakeup_cause()`.
+ */
+void espricHostSetWakeupCause(esp_sleep_wakeup_cause_t cause);
+
+/**
+ * @brief Sets the value returned by `esp_sleep_get_ext1_wakeup_status()`.
+ */
+void espricHostSetExt1WakeupMask(uint64_t mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ESPRIC_HOST_ESP_SLEEP_H
@@ -0,0 +1,24 @@
+/**
+ * @file esp_timer.h
+ * @brief Host stand-in for the ESP-IDF high resolution timer.
+ */
+
+#ifndef ESPRIC_HOST_ESP_TIMER_H
+#define ESPRIC_HOST_ESP_TIMER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Returns microseconds since the host process started, from a steady clock.
+ */
+int64_t esp_timer_get_time(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ESPRIC_HOST_ESP_TIMER_H
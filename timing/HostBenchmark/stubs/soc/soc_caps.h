@@ -0,0 +1,14 @@
+/**
+ * @file soc_caps.h
+ * @brief Host stand-in for the SoC capability macros, modeled on a dual-core ESP32.
+ */
+
+#ifndef ESPRIC_HOST_SOC_CAPS_H
+#define ESPRIC_HOST_SOC_CAPS_H
+
+#define SOC_CPU_CORES_NUM                   2
+#define SOC_PM_SUPPORT_EXT1_WAKEUP          1
+#define SOC_GPIO_SUPPORT_DEEPSLEEP_WAKEUP   0
+#define SOC_PM_SUPPORT_CPU_PD               0
+
+#endif // ESPRIC_HOST_SOC_CAPS_H
@@ -78,7 +78,6 @@ void testPowerDownDomainConditions(const std::vector<PowerDownDomainCondition>&
 void setup() {
   Serial.begin(115200);
   delay(1000);  // Wait for Serial monitor to initialize
-  while (!Serial) {}
 
   // Retrieve the conditions defined in the header file
   auto conditions = definePowerDownDomainConditions();
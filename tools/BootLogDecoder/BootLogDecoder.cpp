@@ -0,0 +1,238 @@
+/**
+ * @file BootLogDecoder.cpp
+ * @brief Host CLI that decodes ESPRIC boot-event logs from flash dumps and log files.
+ *
+ * Files are memory-mapped in fixed-size windows and standard input (`-`) is read in fixed-size
+ * blocks, so memory use stays constant for multi-GB concatenated dumps. Records are decoded in
+ * place with `espricDecodeBootEvent()` from `src/ESPRIC_BootLogFormat.h`; reason and cause names
+ * come from `src/ESPRIC_CauseNames.h`, the tables used by `variants/ESPRIC_Conditions.h`.
+ *
+ * Usage: `BootLogDecoder [--records] <file|-> ...`
+ */
+
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ESPRIC_BootLogFormat.h"
+#include "ESPRIC_CauseNames.h"
+
+static constexpr size_t kMapWindow = 64u << 20;   ///< Bytes mapped at a time (multiple of the page size).
+static constexpr size_t kStreamBlock = 1u << 20;  ///< Bytes read at a time from a stream.
+static constexpr unsigned kValues = 256;          ///< Reason and cause fields are one byte.
+
+/**
+ * @struct ReasonStats
+ * @brief Aggregate of all valid records with one reset reason or wakeup cause.
+ */
+struct ReasonStats {
+    uint64_t count = 0;       ///< Records.
+    uint32_t firstId = 0;     ///< Lowest boot id.
+    uint32_t lastId = 0;      ///< Highest boot id.
+    uint32_t minUptimeMs = 0; ///< Shortest known uptime of the previous run.
+    uint32_t maxUptimeMs = 0; ///< Longest uptime of the previous run.
+    uint64_t uptimeCount = 0; ///< Records with a known (non-zero) uptime.
+    uint64_t totalUptimeMs = 0; ///< Sum of the known uptimes.
+
+    /**
+     * @brief Adds one record.
+     */
+    void add(const ESPRIC_BootEvent& event) {
+        if (count == 0 || event.bootId < firstId) {
+            firstId = event.bootId;
+        }
+        if (count == 0 || event.bootId > lastId) {
+            lastId = event.bootId;
+        }
+        count++;
+        if (event.uptimeMs != 0) {
+            if (uptimeCount == 0 || event.uptimeMs < minUptimeMs) {
+                minUptimeMs = event.uptimeMs;
+            }
+            if (event.uptimeMs > maxUptimeMs) {
+                maxUptimeMs = event.uptimeMs;
+            }
+            uptimeCount++;
+            totalUptimeMs += event.uptimeMs;
+        }
+    }
+};
+
+/**
+ * @struct Decoder
+ * @brief Accumulates the slots of all inputs.
+ */
+struct Decoder {
+    bool printRecords = false; ///< Print every valid record.
+    uint64_t valid = 0;        ///< Records passing magic, version and CRC.
+    uint64_t erased = 0;       ///< Free slots.
+    uint64_t torn = 0;         ///< Torn or corrupted slots.
+    uint64_t trailing = 0;     ///< Bytes after the last complete slot of an input.
+    ReasonStats reasons[kValues];  ///< Per reset reason.
+    ReasonStats causes[kValues];   ///< Per wakeup cause.
+    ReasonStats all;               ///< All valid records.
+
+    /**
+     * @brief Decodes complete slots in `bytes`; `length` is a multiple of the record size.
+     */
+    void decode(const uint8_t* bytes, size_t length, uint64_t offset) {
+        ESPRIC_BootEvent event;
+        for (size_t i = 0; i < length; i += ESPRIC_BOOT_EVENT_SIZE) {
+            switch (espricDecodeBootEvent(bytes + i, event)) {
+                case ESPRIC_BootEventStatus::Valid:
+                    valid++;
+                    reasons[event.resetReason].add(event);
+                    causes[event.wakeupCause].add(event);
+                    all.add(event);
+                    if (printRecords) {
+                        print(event, offset + i);
+                    }
+                    break;
+                case ESPRIC_BootEventStatus::Erased:
+                    erased++;
+                    break;
+                case ESPRIC_BootEventStatus::Torn:
+                    torn++;
+                    break;
+            }
+        }
+    }
+
+    /**
+     * @brief Prints one record.
+     */
+    static void print(const ESPRIC_BootEvent& event, uint64_t offset) {
+        const char* reason = espricResetReasonName(event.resetReason);
+        const char* cause = espricWakeupCauseName(event.wakeupCause);
+        std::printf("%12" PRIu64 "  #%-10" PRIu32 " %-20s %-32s uptime %10" PRIu32 " ms  fw 0x%04x\n", offset,
+                    event.bootId, reason ? reason : "?", cause ? cause : "?", event.uptimeMs, event.firmwareTag);
+    }
+};
+
+/**
+ * @brief Decodes a regular file window by window.
+ */
+static bool decodeMapped(int fd, uint64_t size, Decoder& decoder) {
+    const uint64_t usable = size - size % ESPRIC_BOOT_EVENT_SIZE;
+    for (uint64_t offset = 0; offset < usable; offset += kMapWindow) {
+        const size_t length = static_cast<size_t>(usable - offset < kMapWindow ? usable - offset : kMapWindow);
+        void* map = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(offset));
+        if (map == MAP_FAILED) {
+            return false;
+        }
+        madvise(map, length, MADV_SEQUENTIAL);
+        decoder.decode(static_cast<const uint8_t*>(map), length, offset);
+        munmap(map, length);
+    }
+    decoder.trailing += size - usable;
+    return true;
+}
+
+/**
+ * @brief Decodes a pipe or other stream block by block; a record may span two reads.
+ */
+static bool decodeStream(int fd, Decoder& decoder) {
+    static uint8_t block[kStreamBlock];
+    size_t filled = 0;
+    uint64_t offset = 0;
+    while (true) {
+        const ssize_t count = read(fd, block + filled, sizeof(block) - filled);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        filled += static_cast<size_t>(count);
+        const size_t complete = filled - filled % ESPRIC_BOOT_EVENT_SIZE;
+        if (count == 0 || complete == sizeof(block)) {
+            decoder.decode(block, complete, offset);
+            offset += complete;
+            std::memmove(block, block + complete, filled - complete);
+            filled -= complete;
+        }
+        if (count == 0) {
+            break;
+        }
+    }
+    decoder.trailing += filled;
+    return true;
+}
+
+/**
+ * @brief Prints the records and uptime range of every value with records.
+ */
+static void printTable(const char* title, const ReasonStats* stats, const char* (*nameOf)(unsigned)) {
+    std::printf("\n%-34s %10s %11s %11s %12s %12s %12s\n", title, "count", "first id", "last id",
+                "min uptime", "avg uptime", "max uptime");
+    for (unsigned value = 0; value < kValues; value++) {
+        const ReasonStats& entry = stats[value];
+        if (entry.count == 0) {
+            continue;
+        }
+        char unknown[16];
+        const char* name = nameOf(value);
+        if (name == nullptr) {
+            std::snprintf(unknown, sizeof(unknown), "unknown (%u)", value);
+            name = unknown;
+        }
+        std::printf("%-34s %10" PRIu64 " %11" PRIu32 " %11" PRIu32, name, entry.count, entry.firstId, entry.lastId);
+        if (entry.uptimeCount == 0) {
+            std::printf(" %12s %12s %12s\n", "-", "-", "-");
+        } else {
+            std::printf(" %10" PRIu32 "ms %10" PRIu64 "ms %10" PRIu32 "ms\n", entry.minUptimeMs,
+                        entry.totalUptimeMs / entry.uptimeCount, entry.maxUptimeMs);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    Decoder decoder;
+    int inputs = 0;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--records") == 0) {
+            decoder.printRecords = true;
+            continue;
+        }
+        inputs++;
+        const bool standardInput = std::strcmp(argv[i], "-") == 0;
+        const int fd = standardInput ? STDIN_FILENO : open(argv[i], O_RDONLY);
+        if (fd < 0) {
+            std::fprintf(stderr, "%s: %s\n", argv[i], std::strerror(errno));
+            return 1;
+        }
+        struct stat info;
+        const bool regular = fstat(fd, &info) == 0 && S_ISREG(info.st_mode);
+        const bool ok = regular ? decodeMapped(fd, static_cast<uint64_t>(info.st_size), decoder)
+                                : decodeStream(fd, decoder);
+        if (!standardInput) {
+            close(fd);
+        }
+        if (!ok) {
+            std::fprintf(stderr, "%s: %s\n", argv[i], std::strerror(errno));
+            return 1;
+        }
+    }
+    if (inputs == 0) {
+        std::fprintf(stderr, "Usage: %s [--records] <file|-> ...\n", argv[0]);
+        return 2;
+    }
+
+    std::printf("slots: %" PRIu64 " valid, %" PRIu64 " erased, %" PRIu64 " torn (CRC or magic mismatch)",
+                decoder.valid, decoder.erased, decoder.torn);
+    if (decoder.trailing != 0) {
+        std::printf(", %" PRIu64 " trailing bytes", decoder.trailing);
+    }
+    std::printf("\n");
+    if (decoder.valid != 0) {
+        std::printf("boot ids: %" PRIu32 " to %" PRIu32 "\n", decoder.all.firstId, decoder.all.lastId);
+        printTable("reset reason", decoder.reasons, espricResetReasonName);
+        printTable("wakeup cause", decoder.causes, espricWakeupCauseName);
+    }
+    return 0;
+}
@@ -0,0 +1,195 @@
+/**
+ * @file CborReportDecoder.cpp
+ * @brief Host CLI that prints CBOR boot reports of `espricEncodeBootReport()` as JSON lines.
+ *
+ * Input is binary, one or more concatenated reports per file (a CBOR sequence), or with
+ * `--hex` one report per line as hex digits, e.g. copied from an MQTT client or a serial
+ * console. Reports are decoded with `espricCborDecodeBootReport()` from
+ * `src/ESPRIC_CborFormat.h`; reason and cause names come from `src/ESPRIC_CauseNames.h`.
+ *
+ * Usage: `CborReportDecoder [--hex] <file|-> ...`
+ */
+
+#include <cctype>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "ESPRIC_CauseNames.h"
+#include "ESPRIC_CborFormat.h"
+
+/**
+ * @struct Totals
+ * @brief Counters over all inputs.
+ */
+struct Totals {
+    unsigned long long reports = 0;   ///< Decoded reports.
+    unsigned long long malformed = 0; ///< Hex lines or binary tails that did not decode.
+};
+
+/**
+ * @brief Prints a cause as its enumerator name, or as its number if the name is unknown.
+ */
+static void printName(const char* key, const char* name, uint32_t value) {
+    if (name != nullptr) {
+        std::printf("\"%s\":\"%s\"", key, name);
+    } else {
+        std::printf("\"%s\":%" PRIu32, key, value);
+    }
+}
+
+/**
+ * @brief Prints one report as a JSON object on one line.
+ */
+static void print(const ESPRIC_CborBootReport& report) {
+    static const char* const kPolicies[] = {"EvaluateAll", "FirstMatch", "PriorityOrdered"};
+    static const char* const kStates[] = {"Normal", "Degraded", "SafeMode", "Halt"};
+
+    std::printf("{\"version\":%" PRIu32 ",", report.version);
+    printName("reset", espricResetReasonName(report.resetReason), report.resetReason);
+    std::printf(",");
+    printName("wakeup", espricWakeupCauseName(report.wakeupCause), report.wakeupCause);
+    std::printf(",\"uptime_us\":%" PRId64 ",\"matched\":%" PRIu32 ",\"unmatched\":%" PRIu32 ",\"skipped\":%" PRIu32
+                ",\"deferred\":%" PRIu32 ",\"gated\":%" PRIu32 ",",
+                report.uptimeUs, report.matched, report.unmatched, report.skipped, report.deferred, report.gated);
+    printName("policy", report.policy < 3 ? kPolicies[report.policy] : nullptr, report.policy);
+    if (report.hasMatchedIds) {
+        std::printf(",\"matched_ids\":[");
+        for (uint32_t i = 0; i < report.matchedIdCount; i++) {
+            std::printf(i == 0 ? "%" PRIu32 : ",%" PRIu32, report.matchedIds[i]);
+        }
+        std::printf("]");
+        if (report.matchedIdsTruncated != 0) {
+            std::printf(",\"matched_ids_truncated\":%" PRIu32, report.matchedIdsTruncated);
+        }
+    }
+    if (report.hasTiming) {
+        std::printf(",\"timing_ns\":{\"analysis\":%" PRIu32 ",\"predicates\":%" PRIu32 ",\"callbacks\":%" PRIu32 "}",
+                    report.analysisNs, report.predicatesNs, report.callbacksNs);
+    }
+    if (report.hasCounters) {
+        std::printf(",\"counters\":{\"boots\":%" PRIu32 ",\"reset\":%" PRIu32 ",\"wakeup\":%" PRIu32 "}",
+                    report.boots, report.resetCount, report.wakeupCount);
+    }
+    if (report.hasBootLoop) {
+        std::printf(",\"boot_loop\":{");
+        printName("state", report.bootLoopState < 4 ? kStates[report.bootLoopState] : nullptr, report.bootLoopState);
+        std::printf(",\"recent_crashes\":%" PRIu32 "}", report.recentCrashes);
+    }
+    std::printf("}\n");
+}
+
+/**
+ * @brief Decodes a sequence of reports; stops at the first malformed one.
+ */
+static void decode(const char* path, const std::vector<uint8_t>& data, Totals& totals) {
+    size_t offset = 0;
+    while (offset < data.size()) {
+        ESPRIC_CborBootReport report;
+        size_t consumed = 0;
+        if (!espricCborDecodeBootReport(data.data() + offset, data.size() - offset, report, consumed)) {
+            std::fprintf(stderr, "%s: malformed report at offset %zu, %zu bytes ignored\n", path, offset,
+                         data.size() - offset);
+            totals.malformed++;
+            return; // CBOR has no sync marker to resynchronize on
+        }
+        print(report);
+        totals.reports++;
+        offset += consumed;
+    }
+}
+
+/**
+ * @brief Converts a line of hex digits, spaces allowed, to bytes.
+ *
+ * @return `false` if the line holds other characters or an odd number of digits.
+ */
+static bool parseHex(const std::string& line, std::vector<uint8_t>& bytes) {
+    bytes.clear();
+    int high = -1;
+    for (const char c : line) {
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            continue;
+        }
+        if (!std::isxdigit(static_cast<unsigned char>(c))) {
+            return false;
+        }
+        const int nibble = std::isdigit(static_cast<unsigned char>(c)) ? c - '0' : std::tolower(c) - 'a' + 10;
+        if (high < 0) {
+            high = nibble;
+        } else {
+            bytes.push_back(static_cast<uint8_t>(high << 4 | nibble));
+            high = -1;
+        }
+    }
+    return high < 0;
+}
+
+/**
+ * @brief Decodes one input.
+ *
+ * @return `false` if the input cannot be opened.
+ */
+static bool decodeInput(const char* path, bool hex, Totals& totals) {
+    FILE* file = std::strcmp(path, "-") == 0 ? stdin : std::fopen(path, hex ? "r" : "rb");
+    if (file == nullptr) {
+        std::fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+    std::vector<uint8_t> data;
+    if (hex) {
+        std::string line;
+        int c = 0;
+        while (c != EOF) {
+            c = std::fgetc(file);
+            if (c != '\n' && c != EOF) {
+                line.push_back(static_cast<char>(c));
+                continue;
+            }
+            if (line.find_first_not_of(" \t\r") == std::string::npos) {
+                line.clear();
+                continue;
+            }
+            if (parseHex(line, data)) {
+                decode(path, data, totals);
+            } else {
+                std::fprintf(stderr, "%s: not a hex line: %s\n", path, line.c_str());
+                totals.malformed++;
+            }
+            line.clear();
+        }
+    } else {
+        uint8_t block[4096];
+        size_t got = 0;
+        while ((got = std::fread(block, 1, sizeof(block), file)) != 0) {
+            data.insert(data.end(), block, block + got);
+        }
+        decode(path, data, totals);
+    }
+    if (file != stdin) {
+        std::fclose(file);
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    bool hex = false;
+    int first = 1;
+    if (first < argc && std::strcmp(argv[first], "--hex") == 0) {
+        hex = true;
+        first++;
+    }
+    if (first >= argc) {
+        std::fprintf(stderr, "Usage: %s [--hex] <file|-> ...\n", argv[0]);
+        return 2;
+    }
+    Totals totals;
+    bool ok = true;
+    for (int i = first; i < argc; i++) {
+        ok = decodeInput(argv[i], hex, totals) && ok;
+    }
+    std::fprintf(stderr, "%llu reports, %llu malformed\n", totals.reports, totals.malformed);
+    return ok && totals.malformed == 0 ? 0 : 1;
+}
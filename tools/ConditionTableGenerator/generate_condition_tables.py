@@ -0,0 +1,245 @@
+#!/usr/bin/env python3
+"""Generates variants/ESPRIC_TargetTables.h from the ESP-IDF headers.
+
+The reset reasons are parsed from `esp_reset_reason_t` in esp_system.h, the wakeup causes from
+`esp_sleep_wakeup_cause_t` (a typedef of `esp_sleep_source_t`) in esp_sleep.h. Names, values and
+the `//!<` comments come from the headers; `#if` blocks inside the enums are evaluated per
+target. targets.json lists the SOC capability macros of every target and the rules that decide
+which causes a target can report. With --idf-path the capability macros are read from
+components/soc/<target>/include/soc/soc_caps.h of an ESP-IDF checkout instead.
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+REPO_ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+TOOL_DIR = os.path.relpath(os.path.dirname(os.path.abspath(__file__)), REPO_ROOT)
+
+DEFINE_RE = re.compile(r"^\s*#\s*define\s+(SOC_\w+)\s+\(?\s*(\d+)\s*\)?\s*(?:/[/*].*)?$")
+ENUMERATOR_RE = re.compile(r"^\s*(\w+)\s*(?:=\s*([^,/]+?))?\s*,?\s*(?://!<\s*(.*?)\s*)?$")
+
+
+def strip_block_comments(text):
+    return re.sub(r"/\*.*?\*/", lambda match: "\n" * match.group(0).count("\n"), text, flags=re.S)
+
+
+def evaluate(expression, symbols):
+    """Evaluates a preprocessor expression; unknown macros are 0 like in the C preprocessor."""
+    expression = re.sub(r"//.*", "", expression)
+    expression = re.sub(r"defined\s*\(\s*(\w+)\s*\)|defined\s+(\w+)",
+                        lambda m: "1" if (m.group(1) or m.group(2)) in symbols else "0", expression)
+    expression = re.sub(r"\b(\d+)[uUlL]+\b", r"\1", expression)
+    expression = re.sub(r"\b[A-Za-z_]\w*\b", lambda m: str(int(symbols.get(m.group(0), 0))), expression)
+    expression = re.sub(r"!\s*(\d+)", r"(not \1)", expression)
+    expression = expression.replace("&&", " and ").replace("||", " or ")
+    expression = re.sub(r"!(?!=)", " not ", expression)
+    if not re.fullmatch(r"(?:\s|\d+|and|or|not|[()<>=!+\-*/%&|^~])*", expression):
+        raise ValueError("unsupported preprocessor expression: " + expression)
+    return bool(eval(expression, {"__builtins__": {}}, {}))
+
+
+def find_enum_body(text, type_name):
+    """Returns the body of `typedef enum { ... } type_name;`, following one typedef alias."""
+    alias = re.search(r"typedef\s+(\w+)\s+" + re.escape(type_name) + r"\s*;", text)
+    if alias:
+        type_name = alias.group(1)
+    for match in re.finditer(r"typedef\s+enum\s*(?:\w+\s*)?\{(.*?)\}\s*(\w+)\s*;", text, flags=re.S):
+        if match.group(2) == type_name:
+            return match.group(1)
+    raise ValueError("enum " + type_name + " not found")
+
+
+def parse_enum(path, type_name, symbols):
+    """Returns (name, value, description) of every enumerator enabled for `symbols`."""
+    with open(path, encoding="utf-8") as header:
+        body = find_enum_body(strip_block_comments(header.read()), type_name)
+    enumerators = []
+    stack = []  # (branch active, any branch taken) per nesting level
+    value = 0
+    for line in body.splitlines():
+        directive = re.match(r"^\s*#\s*(\w+)\s*(.*)$", line)
+        if directive:
+            keyword, argument = directive.groups()
+            parent = all(active for active, _ in stack)
+            if keyword in ("if", "ifdef", "ifndef"):
+                if keyword == "if":
+                    taken = evaluate(argument, symbols)
+                else:
+                    taken = (argument.split()[0] in symbols) == (keyword == "ifdef")
+                stack.append((parent and taken, taken))
+            elif keyword == "elif":
+                _, done = stack.pop()
+                parent = all(active for active, _ in stack)
+                taken = not done and evaluate(argument, symbols)
+                stack.append((parent and taken, done or taken))
+            elif keyword == "else":
+                _, done = stack.pop()
+                parent = all(active for active, _ in stack)
+                stack.append((parent and not done, True))
+            elif keyword == "endif":
+                stack.pop()
+            continue
+        if not line.strip() or line.strip().startswith("//"):
+            continue
+        if not all(active for active, _ in stack):
+            continue
+        match = ENUMERATOR_RE.match(line)
+        if not match:
+            raise ValueError(path + ": cannot parse enumerator line: " + line.strip())
+        name, explicit, description = match.groups()
+        if explicit:
+            explicit = explicit.strip()
+            known = {entry[0]: entry[1] for entry in enumerators}
+            value = known[explicit] if explicit in known else int(explicit.rstrip("uUlL"), 0)
+        enumerators.append((name, value, (description or "").strip()))
+        value += 1
+    return enumerators
+
+
+def read_soc_caps(idf_path, target):
+    """Reads the SOC_* macros with a numeric value from soc_caps.h of `target`."""
+    path = os.path.join(idf_path, "components", "soc", target.lower(), "include", "soc", "soc_caps.h")
+    caps = {}
+    with open(path, encoding="utf-8") as header:
+        for line in header:
+            match = DEFINE_RE.match(line)
+            if match:
+                caps[match.group(1)] = int(match.group(2))
+    return caps
+
+
+def display_name(target):
+    return target if target == "ESP32" else "ESP32-" + target[len("ESP32"):]
+
+
+def c_string(text):
+    return '"' + text.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def cause_mask(causes):
+    mask = 0
+    for _, value, _ in causes:
+        mask |= 1 << min(value, 31)
+    return mask
+
+
+def emit_table(lines, member, causes):
+    lines.append("    static constexpr ESPRIC_TargetCause %s[] = {" % member)
+    width = max(len(c_string(name)) for name, _, _ in causes) + 1
+    for index, (name, value, description) in enumerate(causes):
+        separator = "," if index + 1 < len(causes) else ""
+        lines.append("        {%2d, %-*s %s}%s" % (value, width, c_string(name) + ",", c_string(description),
+                                                   separator))
+    lines.append("    };")
+
+
+def generate(args):
+    with open(args.targets, encoding="utf-8") as config_file:
+        config = json.load(config_file)
+    rules = config["rules"]
+    idf_major, idf_minor = (int(part) for part in args.idf_version.split(".")[:2])
+    reset_source = os.path.relpath(os.path.abspath(args.reset_header), REPO_ROOT)
+    wakeup_source = os.path.relpath(os.path.abspath(args.wakeup_header), REPO_ROOT)
+
+    lines = [
+        "/**",
+        " * @file ESPRIC_TargetTables.h",
+        " * @brief Reset reasons and wakeup causes per ESP32 target, generated from the ESP-IDF headers.",
+        " *",
+        " * Generated by %s/generate_condition_tables.py from:" % TOOL_DIR,
+        " * - `esp_reset_reason_t` in %s" % reset_source,
+        " * - `esp_sleep_wakeup_cause_t` in %s" % wakeup_source,
+        " *",
+        " * Do not edit this file; change %s/targets.json or the headers and run the generator again." % TOOL_DIR,
+        " * See `src/ESPRIC_TargetTable.h` for the table layout and `espricBindTargetCauses()`.",
+        " */",
+        "",
+        "#ifndef ESPRIC_TARGETTABLES_H",
+        "#define ESPRIC_TARGETTABLES_H",
+        "",
+        "#include <ESPRIC_TargetTable.h>",
+        "",
+    ]
+    common = None  # Enumerators declared for every target, checked against the framework below
+    selection = []
+    for target, properties in config["targets"].items():
+        symbols = {properties["config"]: 1}
+        symbols.update(properties["caps"])
+        if args.idf_path:
+            symbols.update(read_soc_caps(args.idf_path, target))
+        resets = parse_enum(args.reset_header, "esp_reset_reason_t", symbols)
+        wakeups = parse_enum(args.wakeup_header, "esp_sleep_wakeup_cause_t", symbols)
+        declared = resets + wakeups
+        common = declared if common is None else [cause for cause in common if cause in declared]
+        resets = [cause for cause in resets if evaluate(rules.get(cause[0], "1"), symbols)]
+        wakeups = [cause for cause in wakeups if evaluate(rules.get(cause[0], "1"), symbols)]
+
+        struct = "ESPRIC_Target_" + target
+        lines += [
+            "/**",
+            " * @struct %s" % struct,
+            " * @brief Causes the %s can report." % display_name(target),
+            " */",
+            "struct %s {" % struct,
+            "    static constexpr const char* kName = %s;" % c_string(display_name(target)),
+        ]
+        emit_table(lines, "kResetReasons", resets)
+        lines.append("    static constexpr uint32_t kResetMask = 0x%08Xu;" % cause_mask(resets))
+        emit_table(lines, "kWakeupCauses", wakeups)
+        lines.append("    static constexpr uint32_t kWakeupMask = 0x%08Xu;" % cause_mask(wakeups))
+        lines += ["};", ""]
+        selection.append((properties["config"], struct))
+
+    lines += [
+        "/**",
+        " * @brief Table of the target the sketch is built for.",
+        " *",
+        " * Host builds define no `CONFIG_IDF_TARGET_*` macro and name a table explicitly.",
+        " */",
+    ]
+    for index, (macro, struct) in enumerate(selection):
+        lines.append("%s defined(%s)" % ("#if" if index == 0 else "#elif", macro))
+        lines.append("#define ESPRIC_HAS_CURRENT_TARGET 1")
+        lines.append("using ESPRIC_CurrentTarget = %s;" % struct)
+    lines += ["#endif", ""]
+
+    lines += [
+        "#if defined(ESP_IDF_VERSION) && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(%d, %d, 0)" % (idf_major, idf_minor),
+        "// The tables store plain numbers; the enums of the framework must still agree with them.",
+    ]
+    for name, value, _ in common:
+        lines.append('static_assert(%s == %d, "%s changed, regenerate ESPRIC_TargetTables.h");' % (name, value, name))
+    lines += ["#endif", "", "#endif // ESPRIC_TARGETTABLES_H", ""]
+
+    output = "\n".join(lines)
+    if args.output == "-":
+        sys.stdout.write(output)
+    else:
+        with open(args.output, "w", encoding="utf-8", newline="\n") as header:
+            header.write(output)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--reset-header", default=os.path.join(REPO_ROOT, "resources", "idf-5_3_2", "esp_system.h"),
+                        help="header declaring esp_reset_reason_t")
+    parser.add_argument("--wakeup-header", default=os.path.join(REPO_ROOT, "resources", "Arduino-IDE", "esp_sleep.h"),
+                        help="header declaring esp_sleep_wakeup_cause_t")
+    parser.add_argument("--targets", default=os.path.join(REPO_ROOT, TOOL_DIR, "targets.json"),
+                        help="capability macros and availability rules per target")
+    parser.add_argument("--idf-path", help="ESP-IDF checkout to read soc_caps.h from")
+    parser.add_argument("--idf-version", default="5.3.2",
+                        help="ESP-IDF version of the headers; enables the enum checks from this version on")
+    parser.add_argument("-o", "--output", default=os.path.join(REPO_ROOT, "variants", "ESPRIC_TargetTables.h"),
+                        help="generated header, '-' for standard output")
+    try:
+        generate(parser.parse_args())
+    except (OSError, ValueError) as error:
+        sys.exit("generate_condition_tables.py: " + str(error))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,382 @@
+/**
+ * @file FleetAggregator.cpp
+ * @brief Implementation of the parallel fleet aggregation.
+ */
+
+#include "FleetAggregator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
+#include "ESPRIC_BootLogFormat.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+/**
+ * @struct Chunk
+ * @brief One work item: a run of whole records of one input.
+ */
+struct Chunk {
+    uint32_t input;   ///< Index of the input.
+    size_t offset;    ///< Byte offset of the first record.
+    size_t records;   ///< Number of records.
+};
+
+/**
+ * @struct Partial
+ * @brief Counts of one device collected by one worker.
+ */
+struct Partial {
+    uint64_t valid = 0;  ///< Valid records.
+    uint64_t erased = 0; ///< Erased slots.
+    uint64_t torn = 0;   ///< Torn slots.
+    std::vector<std::unique_ptr<ESPRIC_FleetFirmware>> firmware; ///< Histograms per firmware tag.
+    ESPRIC_FleetFirmware* last = nullptr; ///< Histogram of the previous record.
+
+    /**
+     * @brief Returns the histogram of `tag`, creating it on first use.
+     */
+    uint64_t* histogram(uint16_t tag) {
+        if (last != nullptr && last->firmwareTag == tag) {
+            return last->reasons;
+        }
+        for (auto& entry : firmware) {
+            if (entry->firmwareTag == tag) {
+                last = entry.get();
+                return last->reasons;
+            }
+        }
+        firmware.emplace_back(new ESPRIC_FleetFirmware());
+        last = firmware.back().get();
+        last->firmwareTag = tag;
+        return last->reasons;
+    }
+};
+
+using Table = std::unordered_map<uint32_t, Partial>; ///< Worker-private counts per input index.
+
+/**
+ * @brief Returns `true` if all 16 bytes of a slot are `0xFF`.
+ */
+inline bool erased(const uint8_t* record) {
+    for (size_t i = 0; i < ESPRIC_BOOT_EVENT_SIZE; i++) {
+        if (record[i] != 0xFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Counts one slot.
+ */
+inline void countScalar(const uint8_t* record, Partial& partial) {
+    ESPRIC_BootEvent event;
+    switch (espricDecodeBootEvent(record, event)) {
+        case ESPRIC_BootEventStatus::Valid:
+            partial.valid++;
+            partial.histogram(event.firmwareTag)[event.resetReason]++;
+            break;
+        case ESPRIC_BootEventStatus::Erased:
+            partial.erased++;
+            break;
+        case ESPRIC_BootEventStatus::Torn:
+            partial.torn++;
+            break;
+    }
+}
+
+/**
+ * @brief Scalar kernel: decodes one record at a time.
+ */
+void decodeScalar(const uint8_t* bytes, size_t records, Partial& partial) {
+    for (size_t i = 0; i < records; i++) {
+        countScalar(bytes + i * ESPRIC_BOOT_EVENT_SIZE, partial);
+    }
+}
+
+#if defined(__SSE2__)
+
+static constexpr unsigned kVectorBins = 16; ///< Reason values counted with vector compares.
+
+/**
+ * @struct SlicedCrc
+ * @brief CRC-16 of a record header as 12 independent table lookups.
+ *
+ * The CRC is affine in the message bytes: `crc(m) = crc(0) ^ T0[m0] ^ ... ^ T13[m13]`, where
+ * `Ti[b]` is the CRC (initial value 0) of a message holding only `b` at position `i`. Magic and
+ * version are fixed once the header compare passed, so they are folded into the constant. The
+ * lookups do not depend on each other, unlike the byte-serial table CRC.
+ */
+struct SlicedCrc {
+    uint16_t constant;         ///< CRC of a record with zero payload and the expected magic and version.
+    uint16_t tables[14][256];  ///< Contribution of each byte value per position.
+
+    SlicedCrc() {
+        uint8_t message[14] = {};
+        for (unsigned position = 0; position < 14; position++) {
+            for (unsigned value = 0; value < 256; value++) {
+                message[position] = static_cast<uint8_t>(value);
+                tables[position][value] = static_cast<uint16_t>(espricBootEventCrc(message, 14) ^ zeroCrc());
+            }
+            message[position] = 0;
+        }
+        constant = static_cast<uint16_t>(zeroCrc() ^ tables[0][ESPRIC_BOOT_EVENT_MAGIC] ^
+                                         tables[1][ESPRIC_BOOT_EVENT_VERSION]);
+    }
+
+    /**
+     * @brief CRC of 14 zero bytes, the affine part.
+     */
+    static uint16_t zeroCrc() {
+        const uint8_t zeros[14] = {};
+        return espricBootEventCrc(zeros, 14);
+    }
+
+    /**
+     * @brief CRC of bytes 0 to 13 of a record whose magic and version already matched.
+     */
+    uint16_t operator()(const uint8_t* record) const {
+        uint16_t crc = constant;
+        for (unsigned position = 2; position < 14; position++) {
+            crc ^= tables[position][record[position]];
+        }
+        return crc;
+    }
+};
+
+static const SlicedCrc slicedCrc; ///< Built once at startup (7 KB).
+
+/**
+ * @brief SSE2 kernel: 16 records per step.
+ *
+ * The first and last dword of four records are transposed into one vector each, so magic,
+ * version and firmware tag of four records are checked with one compare. The reasons of 16
+ * records are packed into one byte vector; every reason value below `kVectorBins` is counted
+ * with one compare, a movemask and a popcount. CRCs use `SlicedCrc`. Records with another firmware
+ * tag than the first of the block or a reason outside the vector range are counted one by one.
+ */
+void decodeSimd(const uint8_t* bytes, size_t records, Partial& partial) {
+    const __m128i lowWord = _mm_set1_epi32(0xFFFF);
+    const __m128i header = _mm_set1_epi32(ESPRIC_BOOT_EVENT_MAGIC | (ESPRIC_BOOT_EVENT_VERSION << 8));
+    const __m128i reasonByte = _mm_set1_epi32(0xFF);
+    size_t i = 0;
+    for (; i + 16 <= records; i += 16) {
+        const uint8_t* block = bytes + i * ESPRIC_BOOT_EVENT_SIZE;
+        const uint16_t tag = static_cast<uint16_t>(espricGetLe(block + 12, 2));
+        const __m128i tagVector = _mm_set1_epi32(tag);
+        __m128i reasons32[4];
+        unsigned headerMask = 0;
+        unsigned tagMask = 0;
+        for (int group = 0; group < 4; group++) {
+            const uint8_t* base = block + group * 4 * ESPRIC_BOOT_EVENT_SIZE;
+            const __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(base));
+            const __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(base + 16));
+            const __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(base + 32));
+            const __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(base + 48));
+            const __m128i head = _mm_unpacklo_epi64(_mm_unpacklo_epi32(r0, r1), _mm_unpacklo_epi32(r2, r3));
+            const __m128i tail = _mm_unpackhi_epi64(_mm_unpackhi_epi32(r0, r1), _mm_unpackhi_epi32(r2, r3));
+            const unsigned valid = static_cast<unsigned>(
+                _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(head, lowWord), header))));
+            const unsigned sameTag = static_cast<unsigned>(
+                _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(tail, lowWord), tagVector))));
+            headerMask |= valid << (group * 4);
+            tagMask |= sameTag << (group * 4);
+            reasons32[group] = _mm_and_si128(_mm_srli_epi32(head, 16), reasonByte);
+        }
+        const __m128i reasons = _mm_packus_epi16(_mm_packs_epi32(reasons32[0], reasons32[1]),
+                                                 _mm_packs_epi32(reasons32[2], reasons32[3]));
+
+        // CRC per record with a matching header; everything else is classified by the scalar path.
+        unsigned vectorMask = 0;
+        for (unsigned record = 0; record < 16; record++) {
+            const uint8_t* slot = block + record * ESPRIC_BOOT_EVENT_SIZE;
+            if ((headerMask >> record) & 1) {
+                if (espricGetLe(slot + 14, 2) == slicedCrc(slot)) {
+                    vectorMask |= 1u << record;
+                } else {
+                    partial.torn++;
+                }
+            } else if (erased(slot)) {
+                partial.erased++;
+            } else {
+                partial.torn++;
+            }
+        }
+        const unsigned inRange = static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_cmpeq_epi8(_mm_min_epu8(reasons, _mm_set1_epi8(kVectorBins - 1)), reasons)));
+        const unsigned scalarMask = vectorMask & ~(tagMask & inRange);
+        vectorMask &= tagMask & inRange;
+
+        partial.valid += static_cast<unsigned>(__builtin_popcount(vectorMask | scalarMask));
+        if (vectorMask != 0) {
+            uint64_t* histogram = partial.histogram(tag);
+            for (unsigned value = 0; value < kVectorBins; value++) {
+                const unsigned hits = static_cast<unsigned>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(reasons, _mm_set1_epi8(static_cast<char>(value)))));
+                histogram[value] += static_cast<unsigned>(__builtin_popcount(hits & vectorMask));
+            }
+        }
+        for (unsigned mask = scalarMask; mask != 0; mask &= mask - 1) {
+            const uint8_t* slot = block + __builtin_ctz(mask) * ESPRIC_BOOT_EVENT_SIZE;
+            partial.histogram(static_cast<uint16_t>(espricGetLe(slot + 12, 2)))[slot[2]]++;
+        }
+    }
+    decodeScalar(bytes + i * ESPRIC_BOOT_EVENT_SIZE, records - i, partial);
+}
+
+#endif
+
+/**
+ * @brief Range of chunk indices `[begin, end)` of one worker, packed for single-word CAS.
+ */
+class ChunkRange {
+public:
+    void assign(uint32_t begin, uint32_t end) { range_.store(pack(begin, end)); }
+
+    /**
+     * @brief Owner side: takes the first chunk.
+     */
+    bool takeFront(uint32_t& chunk) {
+        uint64_t current = range_.load();
+        while (begin(current) < end(current)) {
+            if (range_.compare_exchange_weak(current, pack(begin(current) + 1, end(current)))) {
+                chunk = begin(current);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Thief side: takes the last chunk.
+     */
+    bool takeBack(uint32_t& chunk) {
+        uint64_t current = range_.load();
+        while (begin(current) < end(current)) {
+            if (range_.compare_exchange_weak(current, pack(begin(current), end(current) - 1))) {
+                chunk = end(current) - 1;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    static uint64_t pack(uint32_t begin, uint32_t end) { return (static_cast<uint64_t>(end) << 32) | begin; }
+    static uint32_t begin(uint64_t range) { return static_cast<uint32_t>(range); }
+    static uint32_t end(uint64_t range) { return static_cast<uint32_t>(range >> 32); }
+
+    std::atomic<uint64_t> range_{0}; ///< `end << 32 | begin`.
+};
+
+} // namespace
+
+ESPRIC_FleetAggregator::ESPRIC_FleetAggregator(unsigned threads, Kernel kernel, size_t chunkRecords)
+    : threads_(threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency())),
+      kernel_(kernel), chunkRecords_(std::max<size_t>(chunkRecords, 16)) {}
+
+std::vector<ESPRIC_FleetDevice> ESPRIC_FleetAggregator::aggregate(const std::vector<ESPRIC_FleetInput>& inputs) const {
+    std::vector<Chunk> chunks;
+    for (uint32_t input = 0; input < inputs.size(); input++) {
+        const size_t records = inputs[input].size / ESPRIC_BOOT_EVENT_SIZE;
+        for (size_t first = 0; first < records; first += chunkRecords_) {
+            chunks.push_back({input, first * ESPRIC_BOOT_EVENT_SIZE, std::min(chunkRecords_, records - first)});
+        }
+    }
+
+    // Contiguous ranges keep the chunks of one device on one worker unless they are stolen.
+    const unsigned workers = threads_;
+    std::unique_ptr<ChunkRange[]> ranges(new ChunkRange[workers]);
+    for (unsigned worker = 0; worker < workers; worker++) {
+        ranges[worker].assign(static_cast<uint32_t>(chunks.size() * worker / workers),
+                              static_cast<uint32_t>(chunks.size() * (worker + 1) / workers));
+    }
+
+#if defined(__SSE2__)
+    auto* decode = kernel_ == Kernel::Simd ? &decodeSimd : &decodeScalar;
+#else
+    auto* decode = &decodeScalar;
+#endif
+    std::vector<Table> tables(workers);
+    std::atomic<uint64_t> steals{0};
+    auto work = [&](unsigned worker) {
+        Table& table = tables[worker];
+        uint32_t index;
+        while (true) {
+            bool found = ranges[worker].takeFront(index);
+            for (unsigned offset = 1; !found && offset < workers; offset++) {
+                found = ranges[(worker + offset) % workers].takeBack(index);
+                if (found) {
+                    steals.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            if (!found) {
+                return;
+            }
+            const Chunk& chunk = chunks[index];
+            decode(inputs[chunk.input].data + chunk.offset, chunk.records, table[chunk.input]);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (unsigned worker = 1; worker < workers; worker++) {
+        pool.emplace_back(work, worker);
+    }
+    work(0);
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    steals_ = steals.load();
+
+    // Merge: every device is owned by exactly one merge thread, so no locks are needed.
+    std::vector<ESPRIC_FleetDevice> devices(inputs.size());
+    auto merge = [&](unsigned owner) {
+        for (size_t input = owner; input < inputs.size(); input += workers) {
+            ESPRIC_FleetDevice& device = devices[input];
+            device.device = inputs[input].device;
+            for (Table& table : tables) {
+                auto found = table.find(static_cast<uint32_t>(input));
+                if (found == table.end()) {
+                    continue;
+                }
+                Partial& partial = found->second;
+                device.valid += partial.valid;
+                device.erased += partial.erased;
+                device.torn += partial.torn;
+                for (auto& source : partial.firmware) {
+                    auto target = std::find_if(device.firmware.begin(), device.firmware.end(),
+                                               [&](const ESPRIC_FleetFirmware& entry) {
+                                                   return entry.firmwareTag == source->firmwareTag;
+                                               });
+                    if (target == device.firmware.end()) {
+                        device.firmware.push_back(*source);
+                        continue;
+                    }
+                    for (unsigned reason = 0; reason < 256; reason++) {
+                        target->reasons[reason] += source->reasons[reason];
+                    }
+                }
+            }
+            std::sort(device.firmware.begin(), device.firmware.end(),
+                      [](const ESPRIC_FleetFirmware& a, const ESPRIC_FleetFirmware& b) {
+                          return a.firmwareTag < b.firmwareTag;
+                      });
+        }
+    };
+    pool.clear();
+    for (unsigned owner = 1; owner < workers; owner++) {
+        pool.emplace_back(merge, owner);
+    }
+    merge(0);
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    return devices;
+}
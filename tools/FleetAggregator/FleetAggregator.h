@@ -0,0 +1,102 @@
+/**
+ * @file FleetAggregator.h
+ * @brief Parallel aggregation of ESPRIC boot-event logs from many devices (host only).
+ *
+ * Every input is the boot-event log of one device (a flash dump or log file in the format of
+ * `src/ESPRIC_BootLogFormat.h`). `ESPRIC_FleetAggregator` counts the valid records per device,
+ * firmware tag and reset reason:
+ * - The inputs are cut into chunks of whole records. Each worker thread owns a range of chunks
+ *   and steals single chunks from the end of other ranges when its own range is empty. Ranges
+ *   are packed into one atomic word, so taking and stealing are a single compare-and-swap.
+ * - Workers count into private tables. The tables are merged without locks: each merge thread
+ *   owns the devices with `device % threads == thread`.
+ * - The SSE2 kernel decodes 16 records per step: magic, version and firmware tag are compared
+ *   for four records per instruction, the reset reasons are packed into one vector and counted
+ *   with one compare per reason value. CRCs are checked per record.
+ */
+
+#ifndef ESPRIC_FLEETAGGREGATOR_H
+#define ESPRIC_FLEETAGGREGATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/**
+ * @struct ESPRIC_FleetInput
+ * @brief Boot-event log bytes of one device.
+ */
+struct ESPRIC_FleetInput {
+    std::string device;  ///< Device name, e.g. the file name.
+    const uint8_t* data; ///< Log bytes; a trailing partial record is ignored.
+    size_t size;         ///< Number of bytes.
+};
+
+/**
+ * @struct ESPRIC_FleetFirmware
+ * @brief Reset reason histogram of one device and firmware tag.
+ */
+struct ESPRIC_FleetFirmware {
+    uint16_t firmwareTag = 0;     ///< Firmware tag of the records.
+    uint64_t reasons[256] = {};   ///< Valid records per reset reason value.
+};
+
+/**
+ * @struct ESPRIC_FleetDevice
+ * @brief Aggregate of one device.
+ */
+struct ESPRIC_FleetDevice {
+    std::string device;                       ///< Device name of the input.
+    uint64_t valid = 0;                       ///< Records passing magic, version and CRC.
+    uint64_t erased = 0;                      ///< Free (`0xFF`) slots.
+    uint64_t torn = 0;                        ///< Torn or corrupted slots.
+    std::vector<ESPRIC_FleetFirmware> firmware; ///< Histograms, sorted by firmware tag.
+};
+
+/**
+ * @class ESPRIC_FleetAggregator
+ * @brief Shards inputs across worker threads and merges the per-device histograms.
+ */
+class ESPRIC_FleetAggregator {
+public:
+    /**
+     * @enum Kernel
+     * @brief Decoding kernel of the workers.
+     */
+    enum class Kernel : uint8_t {
+        Scalar, ///< One record at a time.
+        Simd    ///< SSE2, 16 records per step (falls back to `Scalar` without SSE2).
+    };
+
+    /**
+     * @param threads Worker threads, 0 for `std::thread::hardware_concurrency()`.
+     * @param kernel Decoding kernel.
+     * @param chunkRecords Records per work item.
+     */
+    explicit ESPRIC_FleetAggregator(unsigned threads = 0, Kernel kernel = Kernel::Simd,
+                                    size_t chunkRecords = 1u << 16);
+
+    /**
+     * @brief Aggregates all inputs; the result has one entry per input, in input order.
+     */
+    std::vector<ESPRIC_FleetDevice> aggregate(const std::vector<ESPRIC_FleetInput>& inputs) const;
+
+    /**
+     * @brief Returns the number of worker threads used.
+     */
+    unsigned threads() const { return threads_; }
+
+    /**
+     * @brief Returns the number of chunks taken from other workers by the last `aggregate()`.
+     */
+    uint64_t steals() const { return steals_; }
+
+private:
+    unsigned threads_;          ///< Worker threads.
+    Kernel kernel_;             ///< Decoding kernel.
+    size_t chunkRecords_;       ///< Records per work item.
+    mutable uint64_t steals_ = 0; ///< Chunks stolen during the last aggregation.
+};
+
+#endif // ESPRIC_FLEETAGGREGATOR_H
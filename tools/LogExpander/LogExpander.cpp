@@ -0,0 +1,128 @@
+/**
+ * @file LogExpander.cpp
+ * @brief Host CLI that expands tokenized ESPRIC logs into text.
+ *
+ * Reads the frames written by `ESPRIC_Log` from files, a serial capture or standard input
+ * (`-`) and prints one line per record. Frames are decoded with `espricLogDecodeFrame()` and
+ * expanded with `espricLogExpand()` from `src/ESPRIC_LogFormat.h`, the catalog the firmware was
+ * built with. Bytes outside valid frames, e.g. ROM boot messages on the same UART, are skipped
+ * and counted. Application messages are expanded if the tool is built with
+ * `-DESPRIC_LOG_APP_CATALOG='"AppLogMessages.h"'`.
+ *
+ * Usage: `LogExpander [--ids] <file|-> ...`
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "ESPRIC_LogFormat.h"
+
+#if defined(ESPRIC_LOG_APP_CATALOG)
+#include ESPRIC_LOG_APP_CATALOG
+static constexpr ESPRIC_LogMessage kAppCatalog[] = {ESPRIC_LOG_APP_MESSAGES(ESPRIC_LOG_CATALOG_ENTRY)};
+static constexpr size_t kAppCount = sizeof(kAppCatalog) / sizeof(kAppCatalog[0]);
+#else
+static constexpr const ESPRIC_LogMessage* kAppCatalog = nullptr;
+static constexpr size_t kAppCount = 0;
+#endif
+
+static constexpr size_t kBlock = 64u << 10; ///< Bytes read at a time.
+
+/**
+ * @struct Totals
+ * @brief Counters over all inputs.
+ */
+struct Totals {
+    unsigned long long records = 0;  ///< Valid frames.
+    unsigned long long skipped = 0;  ///< Bytes outside valid frames.
+    unsigned long long dropped = 0;  ///< Records the device reported as dropped.
+    unsigned long long mismatch = 0; ///< `ESPRIC_LOG_CATALOG` records with a foreign hash.
+};
+
+/**
+ * @brief Prints one record and updates the counters.
+ */
+static void print(const ESPRIC_LogRecord& record, bool ids, Totals& totals) {
+    char text[256];
+    espricLogExpand(record, text, sizeof(text), kAppCatalog, kAppCount);
+    if (ids) {
+        std::printf("%04x  %s\n", static_cast<unsigned>(record.id), text);
+    } else {
+        std::printf("%s\n", text);
+    }
+    totals.records++;
+    if (record.id == ESPRIC_LOG_DROPPED && record.count == 1) {
+        totals.dropped += record.args[0];
+    }
+    if (record.id == ESPRIC_LOG_CATALOG && record.count == 1 && record.args[0] != espricLogCatalogHash()) {
+        totals.mismatch++;
+    }
+}
+
+/**
+ * @brief Expands one input; frames may span read blocks.
+ *
+ * @return `false` if the input cannot be opened.
+ */
+static bool expand(const char* path, bool ids, Totals& totals) {
+    FILE* file = std::strcmp(path, "-") == 0 ? stdin : std::fopen(path, "rb");
+    if (file == nullptr) {
+        std::fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+    std::vector<uint8_t> buffer(kBlock + ESPRIC_LOG_MAX_FRAME);
+    size_t size = 0;
+    bool end = false;
+    while (!end) {
+        const size_t got = std::fread(buffer.data() + size, 1, kBlock, file);
+        end = got == 0;
+        size += got;
+        size_t offset = 0;
+        while (offset < size) {
+            ESPRIC_LogRecord record;
+            size_t consumed = 0;
+            const ESPRIC_LogFrameStatus status = espricLogDecodeFrame(buffer.data() + offset, size - offset, record, consumed);
+            if (status == ESPRIC_LogFrameStatus::Valid) {
+                print(record, ids, totals);
+                offset += consumed;
+            } else if (status == ESPRIC_LogFrameStatus::Incomplete && !end) {
+                break; // Keep the partial frame for the next block
+            } else {
+                offset++; // Resynchronize on the next sync byte
+                totals.skipped++;
+            }
+        }
+        std::memmove(buffer.data(), buffer.data() + offset, size - offset);
+        size -= offset;
+    }
+    if (file != stdin) {
+        std::fclose(file);
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    bool ids = false;
+    int first = 1;
+    if (first < argc && std::strcmp(argv[first], "--ids") == 0) {
+        ids = true;
+        first++;
+    }
+    if (first >= argc) {
+        std::fprintf(stderr, "Usage: %s [--ids] <file|-> ...\n", argv[0]);
+        return 2;
+    }
+    Totals totals;
+    bool ok = true;
+    for (int i = first; i < argc; i++) {
+        ok = expand(argv[i], ids, totals) && ok;
+    }
+    std::fprintf(stderr, "%llu records, %llu bytes skipped, %llu records dropped on the device\n", totals.records,
+                 totals.skipped, totals.dropped);
+    if (totals.mismatch != 0) {
+        std::fprintf(stderr, "warning: %llu logs written with a different catalog (expected %08lx)\n",
+                     totals.mismatch, static_cast<unsigned long>(espricLogCatalogHash()));
+    }
+    return ok ? 0 : 1;
+}
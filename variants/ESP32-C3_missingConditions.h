@@ -5,13 +5,17 @@
 /**
  * @file ESP32-C3_missingConditions.h
  * @brief Enthaelt eine Liste von moeglichen Bedingungen, die aktuell nicht geprueft werden.
+ *
+ * Die Listen sind `constexpr`-Arrays im Flash: kein Heap, keine statischen Konstruktoren vor
+ * `setup()`. Fuer die Abdeckung der Enums von ESP-IDF siehe `ESPRIC_CHECK_COVERAGE` in
+ * `src/ESPRIC_Coverage.h`.
  */
 
-#include <string>
-#include <vector>
+#include <stddef.h>
+#include <string_view>
 
 // Makro-Definitionen
-static const std::vector<std::string> missingMacroConditions = {
+static constexpr std::string_view missingMacroConditions[] = {
     "ESP_RST_BROWNOUT",
     "ESP_RST_DEEPSLEEP",
     "ESP_RST_RTCWDT",
@@ -21,10 +25,13 @@ static const std::vector<std::string> missingMacroConditions = {
 };
 
 // Enum-Eintraege
-static const std::vector<std::string> missingEnumConditions = {
+static constexpr std::string_view missingEnumConditions[] = {
     "ESP_RST_SW_CPU",
     "ESP_SLEEP_WAKEUP_COCPU",
     "ESP_SLEEP_WAKEUP_COCPU_TRAP"
 };
 
+static constexpr size_t missingMacroConditionCount = sizeof(missingMacroConditions) / sizeof(missingMacroConditions[0]);
+static constexpr size_t missingEnumConditionCount = sizeof(missingEnumConditions) / sizeof(missingEnumConditions[0]);
+
 #endif // ESP32_C3_MISSING_CONDITIONS_H
@@ -17,12 +17,47 @@
 #include <ESPRIC.h>
 #include <esp_system.h>			// Arduino version != IDF-Version
 #include <esp_sleep.h>
+#include <esp_idf_version.h>
+#include <ESPRIC_CauseNames.h>
+#include <ESPRIC_ConditionGroup.h>
+#include <ESPRIC_Log.h>
+#include <ESPRIC_Report.h>
+
+// The shared name tables are indexed by the numeric value of the ESP-IDF enums.
+// ESP-IDF < 5.1 (Arduino-ESP32 2.x) ends esp_reset_reason_t at ESP_RST_SDIO.
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+static_assert(ESP_RST_CPU_LOCKUP == 15 && ESPRIC_RESET_REASON_NAME_COUNT == 16,
+              "ESPRIC_RESET_REASON_NAMES does not match esp_reset_reason_t");
+#else
+static_assert(ESP_RST_SDIO == 10 && ESPRIC_RESET_REASON_NAME_COUNT > ESP_RST_SDIO,
+              "ESPRIC_RESET_REASON_NAMES does not match esp_reset_reason_t");
+#endif
+static_assert(ESP_SLEEP_WAKEUP_BT == 12 && ESPRIC_WAKEUP_CAUSE_NAME_COUNT == 13,
+              "ESPRIC_WAKEUP_CAUSE_NAMES does not match esp_sleep_wakeup_cause_t");
+
+/**
+ * @brief Reset reasons handled by `getResetConditions()`, for `ESPRIC_CHECK_COVERAGE`.
+ */
+#ifdef CONFIG_IDF_TARGET_ESP32
+constexpr uint32_t ESPRIC_CONDITIONS_RESET_MASK =
+    espricResetMask(ESP_RST_UNKNOWN, ESP_RST_POWERON, ESP_RST_SW, ESP_RST_PANIC, ESP_RST_INT_WDT, ESP_RST_TASK_WDT,
+                    ESP_RST_WDT, ESP_RST_DEEPSLEEP, ESP_RST_BROWNOUT, ESP_RST_SDIO);
+#else
+constexpr uint32_t ESPRIC_CONDITIONS_RESET_MASK = espricCauseBit(ESP_RST_CPU_LOCKUP + 1) - 1;
+#endif
+
+/**
+ * @brief Wakeup causes handled by `getWakeupConditions()`, all but `ESP_SLEEP_WAKEUP_ALL`.
+ */
+constexpr uint32_t ESPRIC_CONDITIONS_WAKEUP_MASK =
+    (espricCauseBit(ESP_SLEEP_WAKEUP_BT + 1) - 1) & ~espricWakeupMask(ESP_SLEEP_WAKEUP_ALL);
 
 /**
  * @brief Get predefined reset conditions for the ESP32.
  * 
  * This function defines a vector of conditions for various ESP_RST causes.
- * Each condition includes a detection function and an associated callback.
+ * Each condition includes a detection function, evaluated against the startup context
+ * captured once by `ESPRIC::analyze()`, and an associated callback.
  * 
  * @return A vector of `ESPRIC_Condition` objects for reset analysis.
  *
@@ -33,41 +68,41 @@
  */
 std::vector<ESPRIC::ESPRIC_Condition> getResetConditions() {
     return {
-        {[]() { return esp_reset_reason() == ESP_RST_UNKNOWN; }, 
-         []() { Serial.println("Unknown reset detected."); }},
-        {[]() { return esp_reset_reason() == ESP_RST_POWERON; }, 
-         []() { Serial.println("Power-on reset detected."); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_UNKNOWN; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_UNKNOWN)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_POWERON; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_POWERON)); }},
 	#ifndef CONFIG_IDF_TARGET_ESP32
-        {[]() { return esp_reset_reason() == ESP_RST_EXT; }, 
-         []() { Serial.println("External signal reset detected."); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_EXT; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_EXT)); }},
 	#endif
-        {[]() { return esp_reset_reason() == ESP_RST_SW; }, 
-         []() { Serial.println("Software reset detected."); }},
-        {[]() { return esp_reset_reason() == ESP_RST_PANIC; }, 
-         []() { Serial.println("Panic reset detected."); }},
-        {[]() { return esp_reset_reason() == ESP_RST_INT_WDT; }, 
-         []() { Serial.println("Interrupt watchdog reset detected."); }},
-        {[]() { return esp_reset_reason() == ESP_RST_TASK_WDT; }, 
-         []() { Serial.println("Task watchdog reset detected."); }},
-        {[]() { return esp_reset_reason() == ESP_RST_WDT; }, 
-         []() { Serial.println("General watchdog reset detected."); }},
-        {[]() { return esp_reset_reason() == ESP_RST_DEEPSLEEP; }, 
-         []() { Serial.println("Deep sleep wake-up reset detected."); }},
-        {[]() { return esp_reset_reason() == ESP_RST_BROWNOUT; }, 
-         []() { Serial.println("Brownout reset detected."); }},
-        {[]() { return esp_reset_reason() == ESP_RST_SDIO; }, 
-         []() { Serial.println("SDIO reset detected."); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_SW; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_SW)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_PANIC; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_PANIC)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_INT_WDT; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_INT_WDT)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_TASK_WDT; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_TASK_WDT)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_WDT; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_WDT)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_DEEPSLEEP; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_DEEPSLEEP)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_BROWNOUT; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_BROWNOUT)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_SDIO; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_SDIO)); }},
     #ifndef CONFIG_IDF_TARGET_ESP32
-        {[]() { return esp_reset_reason() == ESP_RST_USB; }, 
-         []() { Serial.println("USB reset detected."); }},
-        {[]() { return esp_reset_reason() == ESP_RST_JTAG; }, 
-         []() { Serial.println("JTAG reset detected."); }},
-        {[]() { return esp_reset_reason() == ESP_RST_EFUSE; }, 
-         []() { Serial.println("eFuse reset detected."); }},
-        {[]() { return esp_reset_reason() == ESP_RST_PWR_GLITCH; }, 
-         []() { Serial.println("Power glitch reset detected."); }},
-        {[]() { return esp_reset_reason() == ESP_RST_CPU_LOCKUP; }, 
-         []() { Serial.println("CPU lockup reset detected."); }}
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_USB; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_USB)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_JTAG; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_JTAG)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_EFUSE; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_EFUSE)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_PWR_GLITCH; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_PWR_GLITCH)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_CPU_LOCKUP; }, 
+         []() { Serial.println(espricResetReasonMessage(ESP_RST_CPU_LOCKUP)); }}
     #endif
     };
 }
@@ -76,37 +111,157 @@ std::vector<ESPRIC::ESPRIC_Condition> getResetConditions() {
  * @brief Get predefined wakeup conditions for the ESP32.
  * 
  * This function defines a vector of conditions for various wakeup causes.
- * Each condition includes a detection function and an associated callback.
+ * Each condition includes a detection function, evaluated against the startup context
+ * captured once by `ESPRIC::analyze()`, and an associated callback.
  * 
  * @return A vector of `ESPRIC_Condition` objects for wakeup analysis.
  */
 std::vector<ESPRIC::ESPRIC_Condition> getWakeupConditions() {
     return {
-        {[]() { return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_UNDEFINED; }, 
-         []() { Serial.println("No defined wakeup cause."); }},
-        {[]() { return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT0; }, 
-         []() { Serial.println("Wakeup caused by external signal via RTC_IO."); }},
-        {[]() { return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT1; }, 
-         []() { Serial.println("Wakeup caused by external signal via RTC_CNTL."); }},
-        {[]() { return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER; }, 
-         []() { Serial.println("Wakeup caused by timer."); }},
-        {[]() { return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TOUCHPAD; }, 
-         []() { Serial.println("Wakeup caused by touchpad interrupt."); }},
-        {[]() { return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_ULP; }, 
-         []() { Serial.println("Wakeup caused by ULP program."); }},
-        {[]() { return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_GPIO; }, 
-         []() { Serial.println("Wakeup caused by GPIO (light sleep only)."); }},
-        {[]() { return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_UART; }, 
-         []() { Serial.println("Wakeup caused by UART (light sleep only)."); }},
-        {[]() { return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_WIFI; }, 
-         []() { Serial.println("Wakeup caused by WiFi (light sleep only)."); }},
-        {[]() { return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_COCPU; }, 
-         []() { Serial.println("Wakeup caused by co-processor interrupt."); }},
-        {[]() { return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_COCPU_TRAP_TRIG; }, 
-         []() { Serial.println("Wakeup caused by co-processor crash."); }},
-        {[]() { return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_BT; }, 
-         []() { Serial.println("Wakeup caused by Bluetooth (light sleep only)."); }}
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_UNDEFINED; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_UNDEFINED)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_EXT0; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_EXT0)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_EXT1; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_EXT1)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_TIMER; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_TIMER)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_TOUCHPAD; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_TOUCHPAD)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_ULP; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_ULP)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_GPIO; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_GPIO)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_UART; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_UART)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_WIFI; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_WIFI)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_COCPU; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_COCPU)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_COCPU_TRAP_TRIG; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_COCPU_TRAP_TRIG)); }},
+        {[](const ESPRIC::StartupContext& ctx) { return ctx.wakeupCause == ESP_SLEEP_WAKEUP_BT; }, 
+         []() { Serial.println(espricWakeupCauseMessage(ESP_SLEEP_WAKEUP_BT)); }}
     };
 }
 
+/**
+ * @brief Add grouped reset conditions to an analyzer.
+ * 
+ * Each group covers several reset reasons with one mask condition instead of one 
+ * condition per reason, e.g. all watchdog resets. The groups are matched with a single 
+ * AND operation each.
+ * 
+ * @param analyzer The `ESPRIC` instance that receives the grouped conditions.
+ */
+void addResetGroupConditions(ESPRIC& analyzer) {
+    analyzer.addMaskCondition(ESPRIC_RESET_MASK_ANY_CRASH, 0,
+        []() { Serial.println("Firmware crash detected (panic, watchdog or CPU lockup)."); });
+    analyzer.addMaskCondition(ESPRIC_RESET_MASK_ANY_WATCHDOG, 0,
+        []() { Serial.println("Watchdog reset detected."); });
+    analyzer.addMaskCondition(ESPRIC_RESET_MASK_ANY_POWER, 0,
+        []() { Serial.println("Power supply problem detected."); });
+    analyzer.addMaskCondition(espricResetMask(ESP_RST_DEEPSLEEP), ESPRIC_WAKEUP_MASK_ANY_EXTERNAL,
+        []() { Serial.println("Deep sleep ended by an external signal."); });
+}
+
+/**
+ * @brief Get the wakeup conditions as a group gated on a deep-sleep reset.
+ * 
+ * A wakeup cause is only meaningful after `ESP_RST_DEEPSLEEP`. On every other boot the 
+ * analyzer evaluates the gate only and skips all wakeup conditions with one jump.
+ * 
+ * @return A group with the conditions of `getWakeupConditions()`.
+ */
+ESPRIC_ConditionGroup getDeepSleepWakeupGroup() {
+    ESPRIC_ConditionGroup group([](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_DEEPSLEEP; });
+    group.add(getWakeupConditions());
+    return group;
+}
+
+/**
+ * @brief Get the firmware crash resets as a group with a nested watchdog group.
+ * 
+ * The outer gate matches `ESPRIC_RESET_MASK_ANY_CRASH`, the inner gate 
+ * `ESPRIC_RESET_MASK_ANY_WATCHDOG`. Boots without a crash evaluate one gate.
+ * 
+ * @return A group with the panic, watchdog and CPU lockup conditions.
+ */
+ESPRIC_ConditionGroup getCrashGroup() {
+    ESPRIC_ConditionGroup watchdogs([](const ESPRIC::StartupContext& ctx) {
+        return (espricCauseBit(ctx.resetReason) & ESPRIC_RESET_MASK_ANY_WATCHDOG) != 0;
+    });
+    watchdogs
+        .add([](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_INT_WDT; },
+             []() { Serial.println(espricResetReasonMessage(ESP_RST_INT_WDT)); })
+        .add([](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_TASK_WDT; },
+             []() { Serial.println(espricResetReasonMessage(ESP_RST_TASK_WDT)); })
+        .add([](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_WDT; },
+             []() { Serial.println(espricResetReasonMessage(ESP_RST_WDT)); });
+
+    ESPRIC_ConditionGroup crashes([](const ESPRIC::StartupContext& ctx) {
+        return (espricCauseBit(ctx.resetReason) & ESPRIC_RESET_MASK_ANY_CRASH) != 0;
+    });
+    crashes.add([](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_PANIC; },
+                []() { Serial.println(espricResetReasonMessage(ESP_RST_PANIC)); });
+    crashes.add(watchdogs);
+    #ifndef CONFIG_IDF_TARGET_ESP32
+    crashes.add([](const ESPRIC::StartupContext& ctx) { return ctx.resetReason == ESP_RST_CPU_LOCKUP; },
+                []() { Serial.println(espricResetReasonMessage(ESP_RST_CPU_LOCKUP)); });
+    #endif
+    return crashes;
+}
+
+
+/**
+ * @brief Binds tokenized handlers for all causes of `getResetConditions()` / `getWakeupConditions()`.
+ * 
+ * Instead of printing the message, each handler logs `ESPRIC_LOG_RESET_REASON` or 
+ * `ESPRIC_LOG_WAKEUP_CAUSE` with the cause value. The message text is looked up by 
+ * `tools/LogExpander` on the host, so the boot path neither formats nor waits for the UART.
+ * 
+ * @param analyzer The `ESPRIC` instance that receives the dispatch handlers.
+ * @param log The log that receives the records; must outlive the analysis.
+ */
+void addLoggedCauseHandlers(ESPRIC& analyzer, ESPRIC_Log& log) {
+    for (unsigned reason = 0; reason < ESPRIC_RESET_REASON_NAME_COUNT; reason++) {
+        if (ESPRIC_CONDITIONS_RESET_MASK & espricCauseBit(reason)) {
+            analyzer.onResetReason(static_cast<esp_reset_reason_t>(reason),
+                                   [&log, reason]() { log.log(ESPRIC_LOG_RESET_REASON, reason); });
+        }
+    }
+    for (unsigned cause = 0; cause < ESPRIC_WAKEUP_CAUSE_NAME_COUNT; cause++) {
+        if (ESPRIC_CONDITIONS_WAKEUP_MASK & espricCauseBit(cause)) {
+            analyzer.onWakeupCause(static_cast<esp_sleep_wakeup_cause_t>(cause),
+                                   [&log, cause]() { log.log(ESPRIC_LOG_WAKEUP_CAUSE, cause); });
+        }
+    }
+}
+
+
+/**
+ * @brief Binds reporting handlers for all causes of `getResetConditions()` / `getWakeupConditions()`.
+ * 
+ * Each handler adds a `ResetReason` or `WakeupCause` event to the report instead of printing 
+ * its message. With `ESPRIC::setReport()` the messages are written in one block after 
+ * `analyze()`, by whatever sink the report uses.
+ * 
+ * @param analyzer The `ESPRIC` instance that receives the dispatch handlers.
+ * @param report The report that receives the events; must outlive the analysis.
+ */
+void addReportedCauseHandlers(ESPRIC& analyzer, ESPRIC_Report& report) {
+    for (unsigned reason = 0; reason < ESPRIC_RESET_REASON_NAME_COUNT; reason++) {
+        if (ESPRIC_CONDITIONS_RESET_MASK & espricCauseBit(reason)) {
+            const auto value = static_cast<esp_reset_reason_t>(reason);
+            analyzer.onResetReason(value, [&report, value]() { report.resetReason(value); });
+        }
+    }
+    for (unsigned cause = 0; cause < ESPRIC_WAKEUP_CAUSE_NAME_COUNT; cause++) {
+        if (ESPRIC_CONDITIONS_WAKEUP_MASK & espricCauseBit(cause)) {
+            const auto value = static_cast<esp_sleep_wakeup_cause_t>(cause);
+            analyzer.onWakeupCause(value, [&report, value]() { report.wakeupCause(value); });
+        }
+    }
+}
+
 #endif // ESPRIC_CONDITIONS_H